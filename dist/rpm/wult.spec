@@ -75,10 +75,13 @@ install -pDm755 helpers/ndlrunner/ndlrunner %{buildroot}%{_bindir}/ndlrunner
 %files
 %doc README.md
 %license LICENSE.md js/dist/main.js.LICENSE.txt
+%{_bindir}/interrupts-helper
 %{_bindir}/ipmi-helper
+%{_bindir}/ipmi-inband-helper
 %{_bindir}/ndl
 %{_bindir}/ndlrunner
 %{_bindir}/stc-agent
+%{_bindir}/stream-shim
 %{_bindir}/wult
 %{_datadir}/wult/defs
 %{_datadir}/wult/js
@@ -9,6 +9,10 @@
 
 #include <linux/version.h>
 
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 11, 0)
+#define COMPAT_HAVE_GET_KRETPROBE
+#endif
+
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 14, 0)
 #define COMPAT_HAVE_SET_AFFINITY
 #endif
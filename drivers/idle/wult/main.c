@@ -37,6 +37,12 @@
 /* CPU number to measure wake latency on (module parameter). */
 static unsigned int cpunum;
 
+/*
+ * Include the raw idle history in addition to its summary into the
+ * datapoints (module parameter).
+ */
+static bool idle_hist_raw;
+
 /* The wult driver information object. */
 static struct wult_info *wi;
 
@@ -295,6 +301,7 @@ static void init_wdi(struct wult_device_info *wdi)
 	wi->wdi = wdi;
 	wdi->priv = wi;
 	wi->cpunum = cpunum;
+	wi->idle_hist_raw = idle_hist_raw;
 	wi->ldist_from = max(wdi->ldist_min, DEFAULT_LDIST_FROM);
 	wi->ldist_to = min(wdi->ldist_max, DEFAULT_LDIST_TO);
 	mutex_init(&wi->enable_mutex);
@@ -431,6 +438,8 @@ module_exit(wult_exit);
 
 module_param(cpunum, uint, 0444);
 MODULE_PARM_DESC(cpunum, "CPU number to measure wake latency on, default is CPU0.");
+module_param(idle_hist_raw, bool, 0444);
+MODULE_PARM_DESC(idle_hist_raw, "Include the raw idle history into the datapoints, default is N.");
 
 MODULE_VERSION(WULT_VERSION);
 MODULE_DESCRIPTION("wake up latency measurement driver.");
@@ -6,12 +6,15 @@
 
 #include <linux/err.h>
 #include <linux/errno.h>
+#include <linux/kprobes.h>
 #include <linux/slab.h>
 #include <linux/string.h>
 #include <linux/tracepoint.h>
 #include <linux/trace_events.h>
 #include <trace/events/power.h>
 #include <asm/cpu_device_id.h>
+#include <asm/msr.h>
+#include <asm/tsc.h>
 #include "cstates.h"
 #include "tracer.h"
 #include "wult.h"
@@ -19,12 +22,24 @@
 /* Name of the tracepoint we hook to. */
 #define TRACEPOINT_NAME "cpu_idle"
 
+/*
+ * Name of the function returning the index of the C-state the CPU actually
+ * entered, which may be different to the requested one.
+ */
+#define CPUIDLE_ENTER_NAME "cpuidle_enter"
+
 /*
  * Name of the wult synthetic event which is used for sending measurement data
  * to user-space.
  */
 #define TRACE_EVENT_NAME "wult_cpu_idle"
 
+/*
+ * Name of the ftrace instance wult user-space creates for the wult events. If
+ * it does not exist, the global trace buffer is used.
+ */
+#define TRACE_INSTANCE_NAME "wult"
+
 
 /* The common, platform-independent wult event fields. */
 static struct synth_field_desc common_fields[] = {
@@ -37,6 +52,7 @@ static struct synth_field_desc common_fields[] = {
 	{ .type = "u64", .name = "TIntr" },
 	{ .type = "u64", .name = "TIntrAdj" },
 	{ .type = "unsigned int", .name = "ReqCState" },
+	{ .type = "unsigned int", .name = "EntCState" },
 	{ .type = "u64", .name = "AITS1" },
 	{ .type = "u64", .name = "AITS2" },
 	{ .type = "u64", .name = "IntrTS1" },
@@ -45,6 +61,13 @@ static struct synth_field_desc common_fields[] = {
 	{ .type = "u64", .name = "CC0Cyc" },
 	{ .type = "u64", .name = "SMICnt" },
 	{ .type = "u64", .name = "NMICnt" },
+	{ .type = "u64", .name = "EffFreq" },
+	{ .type = "unsigned int", .name = "IdleHistCnt" },
+	{ .type = "u64", .name = "IdleHistLast" },
+	{ .type = "u64", .name = "IdleHistMin" },
+	{ .type = "u64", .name = "IdleHistMax" },
+	{ .type = "u64", .name = "IdleHistAvg" },
+	{ .type = "unsigned int", .name = "IdleHistWult" },
 };
 
 static inline unsigned int get_smi_count(void)
@@ -56,6 +79,43 @@ static inline unsigned int get_smi_count(void)
 	return smicnt;
 }
 
+/*
+ * Take an APERF and MPERF snapshot after idle. The first snapshot is taken by
+ * whichever runs first after wake up, 'after_idle()' or the interrupt handler,
+ * and the second snapshot is taken by the other one.
+ */
+static void snap_wake_freq(struct wult_tracer_info *ti)
+{
+	unsigned int snum = ti->wake_snaps;
+
+	if (snum >= ARRAY_SIZE(ti->wake_aperf))
+		return;
+
+	ti->wake_aperf[snum] = __rdmsr(MSR_IA32_APERF);
+	ti->wake_mperf[snum] = __rdmsr(MSR_IA32_MPERF);
+	ti->wake_snaps += 1;
+}
+
+/*
+ * Returns the effective CPU frequency in MHz between the two wake up APERF and
+ * MPERF snapshots, or 0 if it is unknown. MPERF counts at the base frequency,
+ * same as in the kernel 'aperfmperf' code.
+ */
+static u64 get_wake_freq(const struct wult_tracer_info *ti)
+{
+	u64 daperf, dmperf;
+
+	if (ti->wake_snaps < ARRAY_SIZE(ti->wake_aperf))
+		return 0;
+
+	daperf = ti->wake_aperf[1] - ti->wake_aperf[0];
+	dmperf = ti->wake_mperf[1] - ti->wake_mperf[0];
+	if (!dmperf)
+		return 0;
+
+	return div64_u64(daperf * cpu_khz, dmperf * 1000);
+}
+
 /* Get measurement data before idle .*/
 static void before_idle(struct wult_info *wi)
 {
@@ -70,6 +130,13 @@ static void before_idle(struct wult_info *wi)
 	wult_cstates_snap_tsc(&ti->csinfo, 0);
 	wult_cstates_snap_mperf(&ti->csinfo, 0);
 
+	/*
+	 * The entered C-state is the requested one, unless 'cpuidle_enter()'
+	 * reports otherwise.
+	 */
+	ti->ent_cstate = ti->req_cstate;
+	ti->ent_pending = true;
+
 	ti->tbi = wi->wdi->ops->get_time_before_idle(wi->wdi, &ti->tbi_adj);
 
 	if (wi->early_intr)
@@ -85,6 +152,7 @@ static void after_idle(struct wult_info *wi)
 	ti->ai_ts1 = ktime_get_raw_ns();
 
 	ti->tai = wdi->ops->get_time_after_idle(wdi, &ti->tai_adj);
+	snap_wake_freq(ti);
 
 	if (ti->armed) {
 		/* The interrupt handler did not run yet. */
@@ -105,6 +173,7 @@ void wult_tracer_interrupt(struct wult_info *wi)
 
 	ti->intr_ts1 = ktime_get_raw_ns();
 	ti->tintr = wdi->ops->get_time_after_idle(wdi, &ti->tintr_adj);
+	snap_wake_freq(ti);
 
 	if (ti->armed) {
 		/* 'after_idle()' did not run yet. */
@@ -124,6 +193,30 @@ void wult_tracer_interrupt(struct wult_info *wi)
 	ti->nmi_intr = per_cpu(irq_stat, wi->cpunum).__nmi_count;
 }
 
+/*
+ * Add the last idle period to the idle history and start a new one. This is
+ * called on idle entry, so that the history does not include the current idle
+ * period until the measurement data are sent.
+ */
+static void idle_hist_enter(struct wult_idle_hist *hist)
+{
+	u64 ts = ktime_get_raw_ns();
+
+	if (hist->enter_ts && hist->exit_ts > hist->enter_ts) {
+		hist->dur[hist->idx] = hist->exit_ts - hist->enter_ts;
+		if (hist->exit_wult)
+			hist->wult_mask |= BIT(hist->idx);
+		else
+			hist->wult_mask &= ~BIT(hist->idx);
+
+		hist->idx = (hist->idx + 1) % WULT_IDLE_HIST_LEN;
+		if (hist->cnt < WULT_IDLE_HIST_LEN)
+			hist->cnt += 1;
+	}
+
+	hist->enter_ts = ts;
+}
+
 static void cpu_idle_hook(void *data, unsigned int req_cstate, unsigned int cpu_id)
 {
 	struct wult_info *wi = data;
@@ -137,8 +230,12 @@ static void cpu_idle_hook(void *data, unsigned int req_cstate, unsigned int cpu_
 	if (req_cstate == PWR_EVENT_EXIT) {
 		if (bi_finished)
 			after_idle(wi);
+		/* Take the time stamp after the measurements to avoid affecting them. */
+		ti->hist.exit_ts = ktime_get_raw_ns();
+		ti->hist.exit_wult = bi_finished && ti->event_happened;
 		bi_finished = false;
 	} else {
+		idle_hist_enter(&ti->hist);
 		ti->req_cstate = req_cstate;
 		if (ti->armed) {
 			before_idle(data);
@@ -147,6 +244,82 @@ static void cpu_idle_hook(void *data, unsigned int req_cstate, unsigned int cpu_
 	}
 }
 
+/* Get the wult information object from a 'cpuidle_enter()' probe instance. */
+static struct wult_info *krp_to_wi(struct kretprobe_instance *ri)
+{
+	struct wult_tracer_info *ti;
+
+#ifdef COMPAT_HAVE_GET_KRETPROBE
+	ti = container_of(get_kretprobe(ri), struct wult_tracer_info, krp);
+#else
+	ti = container_of(ri->rp, struct wult_tracer_info, krp);
+#endif
+	return container_of(ti, struct wult_info, ti);
+}
+
+/*
+ * The 'cpuidle_enter()' entry probe handler. Returning non-zero skips the
+ * return probe, so that only the measured CPU pays for it.
+ */
+static int cpuidle_enter_entry_hook(struct kretprobe_instance *ri,
+				    struct pt_regs *regs)
+{
+	return smp_processor_id() != krp_to_wi(ri)->cpunum;
+}
+
+/*
+ * The 'cpuidle_enter()' return probe handler. Save the index of the C-state
+ * the CPU actually entered. Cpuidle may enter a shallower C-state than the
+ * requested one, for example when the requested C-state stops the local timer
+ * and the broadcast timer is not available.
+ */
+static int cpuidle_enter_ret_hook(struct kretprobe_instance *ri,
+				  struct pt_regs *regs)
+{
+	struct wult_info *wi = krp_to_wi(ri);
+	struct wult_tracer_info *ti = &wi->ti;
+	int ret;
+
+	if (smp_processor_id() != wi->cpunum || !ti->ent_pending)
+		return 0;
+
+	ret = regs_return_value(regs);
+	if (ret >= 0)
+		ti->ent_cstate = ret;
+	ti->ent_pending = false;
+	return 0;
+}
+
+/*
+ * Register the 'cpuidle_enter()' return probe. The entered C-state is optional,
+ * if the probe cannot be registered, the requested C-state is reported instead.
+ */
+static void register_cpuidle_enter_probe(struct wult_tracer_info *ti)
+{
+	int err;
+
+	/* A kretprobe cannot be re-registered without re-initializing it. */
+	memset(&ti->krp, 0, sizeof(ti->krp));
+	ti->krp.entry_handler = cpuidle_enter_entry_hook;
+	ti->krp.handler = cpuidle_enter_ret_hook;
+	ti->krp.kp.symbol_name = CPUIDLE_ENTER_NAME;
+
+	err = register_kretprobe(&ti->krp);
+	if (err)
+		wult_msg("failed to register the '%s' return probe, error %d, entered C-state will not be detected",
+			 CPUIDLE_ENTER_NAME, err);
+	else
+		ti->krp_registered = true;
+}
+
+static void unregister_cpuidle_enter_probe(struct wult_tracer_info *ti)
+{
+	if (ti->krp_registered) {
+		unregister_kretprobe(&ti->krp);
+		ti->krp_registered = false;
+	}
+}
+
 /*
  * Arm an event 'ldist' nanoseconds from now. Returns the actual 'ldist' and
  * absolute launch time value in nanoseconds.
@@ -158,6 +331,7 @@ int wult_tracer_arm_event(struct wult_info *wi, u64 *ldist)
 
 	ti->armed = true;
 	ti->event_happened = false;
+	ti->wake_snaps = 0;
 	err = wi->wdi->ops->arm(wi->wdi, ldist);
 	if (err) {
 		wult_err("failed to arm a dleayed event %llu nsec away, error %d",
@@ -169,6 +343,67 @@ int wult_tracer_arm_event(struct wult_info *wi, u64 *ldist)
 	return 0;
 }
 
+/*
+ * Add the idle history summary values, and optionally the raw idle history
+ * values from the most recent idle period to the oldest one.
+ */
+static int add_idle_hist_vals(struct wult_info *wi,
+			      struct synth_event_trace_state *trace_state)
+{
+	const struct wult_idle_hist *hist = &wi->ti.hist;
+	u64 dur[WULT_IDLE_HIST_LEN] = {};
+	u64 dmin = 0, dmax = 0, sum = 0;
+	unsigned int i, idx, wult_cnt = 0;
+	u32 wult_mask = 0;
+	int err;
+
+	for (i = 0; i < hist->cnt; i++) {
+		idx = (hist->idx + WULT_IDLE_HIST_LEN - 1 - i) % WULT_IDLE_HIST_LEN;
+		dur[i] = hist->dur[idx];
+		if (hist->wult_mask & BIT(idx)) {
+			wult_mask |= BIT(i);
+			wult_cnt += 1;
+		}
+
+		if (i == 0 || dur[i] < dmin)
+			dmin = dur[i];
+		if (dur[i] > dmax)
+			dmax = dur[i];
+		sum += dur[i];
+	}
+
+	err = synth_event_add_next_val(hist->cnt, trace_state);
+	if (err)
+		return err;
+	err = synth_event_add_next_val(dur[0], trace_state);
+	if (err)
+		return err;
+	err = synth_event_add_next_val(dmin, trace_state);
+	if (err)
+		return err;
+	err = synth_event_add_next_val(dmax, trace_state);
+	if (err)
+		return err;
+	err = synth_event_add_next_val(hist->cnt ? div_u64(sum, hist->cnt) : 0,
+				       trace_state);
+	if (err)
+		return err;
+	err = synth_event_add_next_val(wult_cnt, trace_state);
+	if (err)
+		return err;
+
+	if (!wi->idle_hist_raw)
+		return 0;
+
+	for (i = 0; i < WULT_IDLE_HIST_LEN; i++) {
+		err = synth_event_add_next_val(dur[i], trace_state);
+		if (err)
+			return err;
+	}
+
+	return synth_event_add_next_val(wult_mask, trace_state);
+}
+
 int wult_tracer_send_data(struct wult_info *wi)
 {
 	struct wult_device_info *wdi = wi->wdi;
@@ -238,6 +473,9 @@ int wult_tracer_send_data(struct wult_info *wi)
 	if (err)
 		goto out_end;
 	err = synth_event_add_next_val(ti->req_cstate, &trace_state);
+	if (err)
+		goto out_end;
+	err = synth_event_add_next_val(ti->ent_cstate, &trace_state);
 	if (err)
 		goto out_end;
 	err = synth_event_add_next_val(ti->ai_ts1, &trace_state);
@@ -262,6 +500,12 @@ int wult_tracer_send_data(struct wult_info *wi)
 	if (err)
 		goto out_end;
 	err = synth_event_add_next_val(ti->nmi_intr - ti->nmi_bi, &trace_state);
+	if (err)
+		goto out_end;
+	err = synth_event_add_next_val(get_wake_freq(ti), &trace_state);
+	if (err)
+		goto out_end;
+	err = add_idle_hist_vals(wi, &trace_state);
 	if (err)
 		goto out_end;
 
@@ -302,17 +546,23 @@ int wult_tracer_enable(struct wult_info *wi)
 	struct wult_tracer_info *ti = &wi->ti;
 
 	ti->event_happened = ti->armed = false;
+	memset(&ti->hist, 0, sizeof(ti->hist));
+	register_cpuidle_enter_probe(ti);
+
 	err = tracepoint_probe_register(ti->tp, (void *)cpu_idle_hook, wi);
 	if (err) {
 		wult_err("failed to register the '%s' tracepoint probe, error %d",
 			 TRACEPOINT_NAME, err);
+		unregister_cpuidle_enter_probe(ti);
 		return err;
 	}
 
 	err = trace_array_set_clr_event(ti->event_file->tr, "synthetic",
 					TRACE_EVENT_NAME, true);
-	if (err)
+	if (err) {
 		tracepoint_synchronize_unregister();
+		unregister_cpuidle_enter_probe(ti);
+	}
 
 	return err;
 }
@@ -322,6 +572,7 @@ void wult_tracer_disable(struct wult_info *wi)
 	tracepoint_probe_unregister(wi->ti.tp, (void *)cpu_idle_hook, wi);
 	trace_array_set_clr_event(wi->ti.event_file->tr, "synthetic",
 				  TRACE_EVENT_NAME, false);
+	unregister_cpuidle_enter_probe(&wi->ti);
 }
 
 static void match_tracepoint(struct tracepoint *tp, void *priv)
@@ -337,7 +588,7 @@ static int wult_synth_event_init(struct wult_info *wi)
 	struct cstate_info *csi;
 	struct dynevent_cmd cmd;
 	char *cmd_buf, name_buf[64], name_len;
-	int err;
+	int i, err;
 
 	cmd_buf = kzalloc(MAX_DYNEVENT_CMD_LEN, GFP_KERNEL);
 	if (!cmd_buf)
@@ -352,6 +603,20 @@ static int wult_synth_event_init(struct wult_info *wi)
 	if (err)
 		goto out_free;
 
+	/* Add the raw idle history fields, if requested. */
+	if (wi->idle_hist_raw) {
+		for (i = 0; i < WULT_IDLE_HIST_LEN; i++) {
+			snprintf(name_buf, sizeof(name_buf), "IdleHist%d", i + 1);
+			err = synth_event_add_field(&cmd, "u64", name_buf);
+			if (err)
+				goto out_free;
+		}
+
+		err = synth_event_add_field(&cmd, "u64", "IdleHistWultMask");
+		if (err)
+			goto out_free;
+	}
+
 	/* Add C-states fields. */
 	for_each_cstate(&ti->csinfo, csi) {
 		name_len = snprintf(name_buf, sizeof(name_buf), "%sCyc", csi->name);
@@ -384,8 +649,14 @@ static int wult_synth_event_init(struct wult_info *wi)
 	if (err)
 		goto out_free;
 
-	ti->event_file = trace_get_event_file(NULL, "synthetic",
+	ti->event_file = trace_get_event_file(TRACE_INSTANCE_NAME, "synthetic",
 					      TRACE_EVENT_NAME);
+	if (PTR_ERR_OR_ZERO(ti->event_file) == -ENOENT) {
+		wult_dbg("no '%s' ftrace instance, using the global trace buffer",
+			 TRACE_INSTANCE_NAME);
+		ti->event_file = trace_get_event_file(NULL, "synthetic",
+						      TRACE_EVENT_NAME);
+	}
 	if (IS_ERR(ti->event_file)) {
 		err = PTR_ERR(ti->event_file);
 		synth_event_delete(TRACE_EVENT_NAME);
@@ -421,11 +692,7 @@ int wult_tracer_init(struct wult_info *wi)
 		return err;
 	}
 
-	err = wult_synth_event_init(wi);
-	if (err)
-		return err;
-
-	return 0;
+	return wult_synth_event_init(wi);
 }
 
 void wult_tracer_exit(struct wult_info *wi)
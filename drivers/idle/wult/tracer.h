@@ -7,6 +7,7 @@
 #ifndef _WULT_TRACER_H_
 #define _WULT_TRACER_H_
 
+#include <linux/kprobes.h>
 #include <linux/tracepoint.h>
 #include <linux/trace_events.h>
 #include "compat.h"
@@ -14,6 +15,27 @@
 
 struct wult_info;
 
+/* Count of the last idle periods of the measured CPU kept in the idle history. */
+#define WULT_IDLE_HIST_LEN 8
+
+/*
+ * The idle history ring of the measured CPU. The governor picks C-states
+ * basing on recent idle durations, so the history helps explaining its
+ * decisions.
+ */
+struct wult_idle_hist {
+	/* Durations of the last idle periods in nanoseconds. */
+	u64 dur[WULT_IDLE_HIST_LEN];
+	/* Bit 'n' is set if the idle period in slot 'n' was ended by the armed event. */
+	u32 wult_mask;
+	/* Index of the next slot to use and count of the used slots. */
+	unsigned int idx, cnt;
+	/* Monotonic time of the last idle entry and exit. */
+	u64 enter_ts, exit_ts;
+	/* 'true' if the last idle period was ended by the armed event. */
+	bool exit_wult;
+};
+
 /*
  * Wult tracer information.
  */
@@ -37,6 +59,14 @@ struct wult_tracer_info {
 	u64 ldist;
 	/* The requested C-state index. */
 	int req_cstate;
+	/* The entered C-state index, as returned by 'cpuidle_enter()'. */
+	int ent_cstate;
+	/* 'true' if 'ent_cstate' has to be updated on 'cpuidle_enter()' return. */
+	bool ent_pending;
+	/* The 'cpuidle_enter()' return probe. */
+	struct kretprobe krp;
+	/* 'true' if the 'cpuidle_enter()' return probe has been registered. */
+	bool krp_registered;
 	/* SMI and NMI counters collected in 'before_idle()'. */
 	u32 smi_bi, nmi_bi;
 	/* SMI and NMI counters collected in the interrupt handler. */
@@ -51,6 +81,16 @@ struct wult_tracer_info {
 	bool irqs_disabled;
 	/* 'true' if the armed event has happened. */
 	bool event_happened;
+	/*
+	 * APERF and MPERF snapshots taken by the first and the second code path
+	 * running after idle ('after_idle()' and the interrupt handler), used
+	 * for calculating the effective frequency after wake up.
+	 */
+	u64 wake_aperf[2], wake_mperf[2];
+	/* Count of the taken wake up APERF and MPERF snapshots. */
+	unsigned int wake_snaps;
+	/* The idle history of the measured CPU. */
+	struct wult_idle_hist hist;
 	/* The tracepoint we hook to. */
 	struct tracepoint *tp;
 	/* The wult trace event file. */
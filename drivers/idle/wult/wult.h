@@ -124,6 +124,8 @@ struct wult_info {
 	bool early_intr;
 	/* Internal parser cache for the above */
 	bool ei;
+	/* Whether the raw idle history should be included in the datapoints. */
+	bool idle_hist_raw;
 	/*
 	 * Launch distance range in nanoseconds. We pick a random number from
 	 * this range when selecting time for the delayed event.
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Copyright (C) 2019-2022 Intel Corporation
+ * Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+ */
+
+/*
+ * This is a variant of the 'wult_hrt' driver which completes the delayed event
+ * in softirq context, the same way many networking and block I/O drivers
+ * complete their requests. The hrtimer interrupt handler takes the usual wult
+ * interrupt measurements and schedules a tasklet, and the tasklet takes the
+ * softirq time stamp and finishes the event. Therefore, every datapoint includes
+ * both hardirq and softirq time stamps.
+ */
+
+#define DRIVER_NAME "wult_hrt_soft"
+
+#include <linux/cpufeature.h>
+#include <linux/hrtimer.h>
+#include <linux/interrupt.h>
+#include <linux/ktime.h>
+#include <linux/module.h>
+#include <linux/time.h>
+#include <asm/cpu_device_id.h>
+#include <asm/intel-family.h>
+#include "wult.h"
+
+/* Maximum supported launch distance in nanoseconds. */
+#define LDIST_MAX 20000000
+
+/*
+ * Get a 'struct wult_hrt_soft' pointer by memory address of its 'wdi' field.
+ */
+#define wdi_to_wt(wdi) container_of(wdi, struct wult_hrt_soft, wdi)
+
+struct wult_hrt_soft {
+	struct hrtimer timer;
+	/* The tasklet completing the delayed event in softirq context. */
+	struct tasklet_struct tasklet;
+	struct wult_device_info wdi;
+	u64 ltime;
+};
+
+static struct wult_hrt_soft wult_hrt_soft = {
+	.wdi = { .devname = DRIVER_NAME, },
+};
+
+/* The monotonic time at the beginning of the tasklet. */
+static struct wult_trace_data_info tdata[] = {
+	{ .name = "TSoftIntr" },
+	{ }
+};
+
+static void tasklet_handler(unsigned long data)
+{
+	tdata[0].val = ktime_get_raw_ns();
+	wult_interrupt_finish(0);
+}
+
+static enum hrtimer_restart timer_interrupt(struct hrtimer *hrtimer)
+{
+	struct wult_hrt_soft *wt = container_of(hrtimer, struct wult_hrt_soft,
+						timer);
+
+	wult_interrupt_start();
+	/* The tasklet runs on this CPU when the hrtimer interrupt exits. */
+	tasklet_schedule(&wt->tasklet);
+
+	return HRTIMER_NORESTART;
+}
+
+static u64 get_time_before_idle(struct wult_device_info *wdi, u64 *adj)
+{
+	*adj = 0;
+	return ktime_get_raw_ns();
+}
+
+static u64 get_time_after_idle(struct wult_device_info *wdi, u64 *adj)
+{
+	*adj = 0;
+	return ktime_get_raw_ns();
+}
+
+static int arm_event(struct wult_device_info *wdi, u64 *ldist)
+{
+	struct wult_hrt_soft *wt = wdi_to_wt(wdi);
+
+	tdata[0].val = 0;
+	hrtimer_start(&wt->timer, ns_to_ktime(*ldist), HRTIMER_MODE_REL_PINNED_HARD);
+	wt->ltime = ktime_get_raw_ns() + *ldist;
+	return 0;
+}
+
+static bool event_has_happened(struct wult_device_info *wdi)
+{
+	struct wult_hrt_soft *wt = wdi_to_wt(wdi);
+
+	return hrtimer_get_remaining(&wt->timer) <= 0;
+}
+
+static u64 get_launch_time(struct wult_device_info *wdi)
+{
+	return wdi_to_wt(wdi)->ltime;
+}
+
+static struct wult_trace_data_info *get_trace_data(struct wult_device_info *wdi)
+{
+	return tdata;
+}
+
+static int init_device(struct wult_device_info *wdi, int cpunum)
+{
+	struct wult_hrt_soft *wt = wdi_to_wt(wdi);
+
+	tasklet_init(&wt->tasklet, tasklet_handler, 0);
+	hrtimer_init(&wt->timer, CLOCK_MONOTONIC, HRTIMER_MODE_REL_PINNED_HARD);
+	wt->timer.function = &timer_interrupt;
+	return 0;
+}
+
+static void exit_device(struct wult_device_info *wdi)
+{
+	struct wult_hrt_soft *wt = wdi_to_wt(wdi);
+
+	hrtimer_cancel(&wt->timer);
+	tasklet_kill(&wt->tasklet);
+}
+
+static struct wult_device_ops wult_hrt_soft_ops = {
+	.get_time_before_idle = get_time_before_idle,
+	.get_time_after_idle = get_time_after_idle,
+	.arm = arm_event,
+	.event_has_happened = event_has_happened,
+	.get_launch_time = get_launch_time,
+	.get_trace_data = get_trace_data,
+	.init = init_device,
+	.exit = exit_device,
+};
+
+static const struct x86_cpu_id intel_cpu_ids[] = {
+	X86_MATCH_VENDOR_FAM(INTEL, 6, NULL),
+	{}
+};
+MODULE_DEVICE_TABLE(x86cpu, intel_cpu_ids);
+
+static int __init wult_hrt_soft_init(void)
+{
+	const struct x86_cpu_id *id;
+
+	id = x86_match_cpu(intel_cpu_ids);
+	if (!id) {
+		wult_err("unsupported Intel CPU family, required family 6 or higher");
+		return -EINVAL;
+	}
+
+	wult_hrt_soft.wdi.ldist_min = 1;
+	wult_hrt_soft.wdi.ldist_max = LDIST_MAX;
+	wult_hrt_soft.wdi.ldist_gran = hrtimer_resolution;
+	wult_hrt_soft.wdi.ops = &wult_hrt_soft_ops;
+
+	return wult_register(&wult_hrt_soft.wdi);
+}
+module_init(wult_hrt_soft_init);
+
+static void __exit wult_hrt_soft_exit(void)
+{
+	wult_unregister();
+}
+module_exit(wult_hrt_soft_exit);
+
+MODULE_DESCRIPTION("Wult delayed event driver based Linux high resolution timer with softirq completion");
+MODULE_AUTHOR("Artem Bityutskiy");
+MODULE_LICENSE("GPL v2");
@@ -26,9 +26,20 @@
  */
 #define PWR_EVENT_EXIT -1
 
+struct cpuidle_driver;
+struct cpuidle_device;
+
+/*
+ * Only the hrtimer expiry time is used. The field offset is relocated to the
+ * layout of the running kernel when the program is loaded.
+ */
+struct hrtimer {
+	s64 _softexpires;
+} __attribute__((preserve_access_index));
+
 struct {
 	__uint(type, BPF_MAP_TYPE_RINGBUF);
-	__uint(max_entries, 4096);
+	__uint(max_entries, 16384);
 } events SEC(".maps");
 
 struct {
@@ -38,6 +49,13 @@ struct {
 	__uint(max_entries, WULTRUNNER_NUM_PERF_COUNTERS);
 } perf SEC(".maps");
 
+struct {
+	__uint(type, BPF_MAP_TYPE_ARRAY);
+	__uint(max_entries, WULTRUNNER_MAX_CSTATES * WULTRUNNER_HIST_BUCKETS);
+	__type(key, u32);
+	__type(value, u64);
+} hist SEC(".maps");
+
 struct timer_elem {
 	struct bpf_timer t;
 };
@@ -52,10 +70,22 @@ struct {
 static int min_t;
 static int max_t;
 static struct bpf_event data;
-static u64 ltime;
-static u32 ldist;
+/*
+ * Not static, because in the thread mode userspace sets these via the
+ * skeleton, and 'bpftool' does not expose static variables.
+ */
+u64 ltime;
+u32 ldist;
 static bool timer_armed;
 
+/*
+ * Time of the last idle entry and exit, and whether the last idle period was
+ * ended by the wult timer. Used for maintaining the idle history.
+ */
+static u64 idle_enter_ts;
+static u64 idle_exit_ts;
+static bool idle_exit_wult;
+
 static u64 perf_counters[WULTRUNNER_NUM_PERF_COUNTERS];
 
 const u32 linux_version_code = LINUX_VERSION_CODE;
@@ -68,6 +98,17 @@ const u32 linux_version_code = LINUX_VERSION_CODE;
  * code.
  */
 const volatile u32 cpu_num;
+const volatile bool daemon_mode;
+/*
+ * If set, the entered C-state is tracked via the 'cpuidle_enter()' return
+ * hook, and the events are sent from there.
+ */
+const volatile bool track_entered;
+/*
+ * If set, the eBPF timer is not used. Instead, userspace arms a 'timerfd'
+ * timer waking up a user thread, and sets 'ltime' and 'ldist' before that.
+ */
+const volatile bool thread_mode;
 
 static u64 bpf_hrt_read_tsc(void)
 {
@@ -105,6 +146,59 @@ static void bpf_hrt_ping_cpu(void)
 	bpf_ringbuf_submit(e, 0);
 }
 
+static u32 bpf_hrt_log2(u64 v)
+{
+	u32 r, shift;
+
+	r = (v > 0xFFFFFFFF) << 5;
+	v >>= r;
+	shift = (v > 0xFFFF) << 4;
+	v >>= shift;
+	r |= shift;
+	shift = (v > 0xFF) << 3;
+	v >>= shift;
+	r |= shift;
+	shift = (v > 0xF) << 2;
+	v >>= shift;
+	r |= shift;
+	shift = (v > 0x3) << 1;
+	v >>= shift;
+	r |= shift;
+	r |= (v >> 1);
+
+	return r;
+}
+
+/*
+ * Account the current datapoint in the latency histogram instead of sending
+ * it to userspace. Wake latency is measured from the launch time to whichever
+ * comes first: the interrupt or the idle exit.
+ */
+static void bpf_hrt_hist_add(void)
+{
+	u64 *count;
+	u64 t;
+	u32 bucket;
+	u32 key;
+	int cstate = data.ent_cstate;
+
+	if (cstate < 0 || cstate >= WULTRUNNER_MAX_CSTATES)
+		return;
+
+	t = data.tai < data.tintr ? data.tai : data.tintr;
+	if (t <= data.ltime)
+		return;
+
+	bucket = bpf_hrt_log2(t - data.ltime);
+	if (bucket >= WULTRUNNER_HIST_BUCKETS)
+		bucket = WULTRUNNER_HIST_BUCKETS - 1;
+
+	key = cstate * WULTRUNNER_HIST_BUCKETS + bucket;
+	count = bpf_map_lookup_elem(&hist, &key);
+	if (count)
+		__sync_fetch_and_add(count, 1);
+}
+
 static void bpf_hrt_send_event(void)
 {
 	struct bpf_event *e;
@@ -119,6 +213,15 @@ static void bpf_hrt_send_event(void)
 	    data.tai <= data.ltime || data.tbi >= data.ltime)
 		return;
 
+	/* Wait for 'cpuidle_enter()' to return the entered C-state */
+	if (track_entered && data.ent_cstate < 0)
+		return;
+
+	if (daemon_mode) {
+		bpf_hrt_hist_add();
+		goto out;
+	}
+
 	e = bpf_ringbuf_reserve(&events, sizeof(*e), 0);
 	if (!e) {
 		/*
@@ -139,8 +242,13 @@ static void bpf_hrt_send_event(void)
 	for (i = 1; i < WULTRUNNER_NUM_PERF_COUNTERS; i++)
 		e->perf_counters[i] = perf_counters[i];
 
-	bpf_ringbuf_submit(e, 0);
+	/*
+	 * In the thread mode, userspace reads the event when the thread wakes
+	 * up, so do not disturb the measured CPU with a ring buffer wake up.
+	 */
+	bpf_ringbuf_submit(e, thread_mode ? BPF_RB_NO_WAKEUP : 0);
 
+out:
 	data.tbi = 0;
 	data.tai = 0;
 	data.tintr = 0;
@@ -153,7 +261,7 @@ int bpf_hrt_kick_timer(void)
 	int ret;
 	int cpu_id = bpf_get_smp_processor_id();
 
-	if (data.tbi || timer_armed)
+	if (thread_mode || data.tbi || timer_armed)
 		return 0;
 
 	timer = bpf_map_lookup_elem(&timers, &key);
@@ -179,6 +287,31 @@ int bpf_hrt_kick_timer(void)
 	return ret;
 }
 
+/*
+ * Add the last idle period to the idle history and start a new one. This is
+ * called on idle entry, so that the history does not include the current idle
+ * period until the event is sent. The history is a part of 'data', so it gets
+ * to userspace with every event.
+ */
+static void bpf_hrt_idle_hist_enter(u64 t)
+{
+	u32 idx = data.idle_hist_idx & (WULTRUNNER_IDLE_HIST_LEN - 1);
+
+	if (idle_enter_ts && idle_exit_ts > idle_enter_ts) {
+		data.idle_hist[idx] = idle_exit_ts - idle_enter_ts;
+		if (idle_exit_wult)
+			data.idle_hist_wult |= 1 << idx;
+		else
+			data.idle_hist_wult &= ~(1 << idx);
+
+		data.idle_hist_idx = (idx + 1) & (WULTRUNNER_IDLE_HIST_LEN - 1);
+		if (data.idle_hist_cnt < WULTRUNNER_IDLE_HIST_LEN)
+			data.idle_hist_cnt++;
+	}
+
+	idle_enter_ts = t;
+}
+
 static void bpf_hrt_snapshot_perf_vars(bool exit)
 {
 	int i;
@@ -276,13 +409,18 @@ int BPF_PROG(bpf_hrt_cpu_idle, unsigned int cstate, unsigned int cpu_id)
 	if (cstate == PWR_EVENT_EXIT) {
 		t = bpf_ktime_get_boot_ns();
 
+		idle_exit_ts = t;
+		idle_exit_wult = data.tbi && (data.tintr || t >= ltime);
+
 		if (data.tintr || t >= ltime) {
 			data.tai = t;
 			data.aits1 = data.tai;
 
-			bpf_hrt_snapshot_perf_vars(true);
-
-			data.aic = bpf_hrt_read_tsc();
+			/* Perf counters are not used in daemon mode. */
+			if (!daemon_mode) {
+				bpf_hrt_snapshot_perf_vars(true);
+				data.aic = bpf_hrt_read_tsc();
+			}
 
 			data.aits2 = bpf_ktime_get_boot_ns();
 		} else {
@@ -297,12 +435,16 @@ int BPF_PROG(bpf_hrt_cpu_idle, unsigned int cstate, unsigned int cpu_id)
 	} else {
 		debug_printk("enter cpu_idle, state=%d", cstate);
 		data.req_cstate = cstate;
+		data.ent_cstate = track_entered ? -1 : cstate;
 		idx = cstate;
 
 		t = bpf_ktime_get_boot_ns();
+		bpf_hrt_idle_hist_enter(t);
 
-		data.bic = bpf_hrt_read_tsc();
-		bpf_hrt_snapshot_perf_vars(false);
+		if (!daemon_mode) {
+			data.bic = bpf_hrt_read_tsc();
+			bpf_hrt_snapshot_perf_vars(false);
+		}
 
 		data.tbi = bpf_ktime_get_boot_ns();
 		if (data.tbi > ltime)
@@ -314,4 +456,57 @@ int BPF_PROG(bpf_hrt_cpu_idle, unsigned int cstate, unsigned int cpu_id)
 	return 0;
 }
 
+/*
+ * In the thread mode, take the interrupt time stamp when the 'timerfd' timer
+ * waking up the user thread expires on the measured CPU. Userspace arms it with
+ * an absolute 'CLOCK_BOOTTIME' expiry time equal to the launch time, so the
+ * timer is recognized by its expiry time, and the other hrtimers are ignored.
+ */
+SEC("tp_btf/hrtimer_expire_entry")
+int BPF_PROG(bpf_hrt_hrtimer_expire_entry, struct hrtimer *hrtimer, void *now)
+{
+	u64 t;
+
+	if (bpf_get_smp_processor_id() != cpu_num)
+		return 0;
+
+	if (!data.tbi || data.tintr || hrtimer->_softexpires != (s64)ltime)
+		return 0;
+
+	t = bpf_ktime_get_boot_ns();
+
+	data.tintr = t;
+	data.intrts1 = t;
+	data.intrts2 = t;
+	data.ldist = ldist;
+	data.ltime = ltime;
+
+	bpf_hrt_send_event();
+
+	return 0;
+}
+
+/*
+ * 'cpuidle_enter()' returns the index of the C-state the CPU actually entered,
+ * which may be different to the requested one. This does not necessarily run
+ * last: for C-states entered with interrupts disabled, the timer interrupt is
+ * handled only after 'cpuidle_enter()' returns. 'bpf_hrt_send_event()' does
+ * nothing until all the data are in place, so whichever of this, the 'cpu_idle'
+ * exit tracepoint, and the timer interrupt runs last, sends the event.
+ */
+SEC("fexit/cpuidle_enter")
+int BPF_PROG(bpf_hrt_cpuidle_enter_exit, struct cpuidle_driver *drv,
+	     struct cpuidle_device *dev, int index, int ret)
+{
+	if (bpf_get_smp_processor_id() != cpu_num)
+		return 0;
+
+	data.ent_cstate = ret >= 0 ? ret : data.req_cstate;
+
+	bpf_hrt_send_event();
+	bpf_hrt_kick_timer();
+
+	return 0;
+}
+
 char _license[] SEC("license") = "GPL";
@@ -1,1667 +0,0 @@
-/* SPDX-License-Identifier: (LGPL-2.1 OR BSD-2-Clause) */
-
-/* THIS FILE IS AUTOGENERATED! */
-#ifndef __BPF_HRT_SKEL_H__
-#define __BPF_HRT_SKEL_H__
-
-#include <stdlib.h>
-#include <bpf/libbpf.h>
-
-struct bpf_hrt {
-	struct bpf_object_skeleton *skeleton;
-	struct bpf_object *obj;
-	struct {
-		struct bpf_map *timers;
-		struct bpf_map *events;
-		struct bpf_map *perf;
-		struct bpf_map *rodata;
-		struct bpf_map *bss;
-	} maps;
-	struct {
-		struct bpf_program *bpf_hrt_start_timer;
-		struct bpf_program *bpf_hrt_cpu_idle;
-	} progs;
-	struct {
-		struct bpf_link *bpf_hrt_start_timer;
-		struct bpf_link *bpf_hrt_cpu_idle;
-	} links;
-	struct bpf_hrt__bss {
-		struct bpf_event data;
-		bool timer_armed;
-		u32 ldist;
-		int max_t;
-		int min_t;
-		u64 ltime;
-		u64 perf_counters[16];
-	} *bss;
-	struct bpf_hrt__rodata {
-		u32 linux_version_code;
-		u32 cpu_num;
-		char bpf_hrt_ping_cpu_____fmt[46];
-		char bpf_hrt_send_event_____fmt[47];
-		char bpf_hrt_read_tsc_____fmt[32];
-	} *rodata;
-};
-
-static void
-bpf_hrt__destroy(struct bpf_hrt *obj)
-{
-	if (!obj)
-		return;
-	if (obj->skeleton)
-		bpf_object__destroy_skeleton(obj->skeleton);
-	free(obj);
-}
-
-static inline int
-bpf_hrt__create_skeleton(struct bpf_hrt *obj);
-
-static inline struct bpf_hrt *
-bpf_hrt__open_opts(const struct bpf_object_open_opts *opts)
-{
-	struct bpf_hrt *obj;
-
-	obj = (struct bpf_hrt *)calloc(1, sizeof(*obj));
-	if (!obj)
-		return NULL;
-	if (bpf_hrt__create_skeleton(obj))
-		goto err;
-	if (bpf_object__open_skeleton(obj->skeleton, opts))
-		goto err;
-
-	return obj;
-err:
-	bpf_hrt__destroy(obj);
-	return NULL;
-}
-
-static inline struct bpf_hrt *
-bpf_hrt__open(void)
-{
-	return bpf_hrt__open_opts(NULL);
-}
-
-static inline int
-bpf_hrt__load(struct bpf_hrt *obj)
-{
-	return bpf_object__load_skeleton(obj->skeleton);
-}
-
-static inline struct bpf_hrt *
-bpf_hrt__open_and_load(void)
-{
-	struct bpf_hrt *obj;
-
-	obj = bpf_hrt__open();
-	if (!obj)
-		return NULL;
-	if (bpf_hrt__load(obj)) {
-		bpf_hrt__destroy(obj);
-		return NULL;
-	}
-	return obj;
-}
-
-static inline int
-bpf_hrt__attach(struct bpf_hrt *obj)
-{
-	return bpf_object__attach_skeleton(obj->skeleton);
-}
-
-static inline void
-bpf_hrt__detach(struct bpf_hrt *obj)
-{
-	return bpf_object__detach_skeleton(obj->skeleton);
-}
-
-static inline int
-bpf_hrt__create_skeleton(struct bpf_hrt *obj)
-{
-	struct bpf_object_skeleton *s;
-
-	s = (struct bpf_object_skeleton *)calloc(1, sizeof(*s));
-	if (!s)
-		return -1;
-	obj->skeleton = s;
-
-	s->sz = sizeof(*s);
-	s->name = "bpf_hrt";
-	s->obj = &obj->obj;
-
-	/* maps */
-	s->map_cnt = 5;
-	s->map_skel_sz = sizeof(*s->maps);
-	s->maps = (struct bpf_map_skeleton *)calloc(s->map_cnt, s->map_skel_sz);
-	if (!s->maps)
-		goto err;
-
-	s->maps[0].name = "timers";
-	s->maps[0].map = &obj->maps.timers;
-
-	s->maps[1].name = "events";
-	s->maps[1].map = &obj->maps.events;
-
-	s->maps[2].name = "perf";
-	s->maps[2].map = &obj->maps.perf;
-
-	s->maps[3].name = "bpf_hrt.rodata";
-	s->maps[3].map = &obj->maps.rodata;
-	s->maps[3].mmaped = (void **)&obj->rodata;
-
-	s->maps[4].name = "bpf_hrt.bss";
-	s->maps[4].map = &obj->maps.bss;
-	s->maps[4].mmaped = (void **)&obj->bss;
-
-	/* programs */
-	s->prog_cnt = 2;
-	s->prog_skel_sz = sizeof(*s->progs);
-	s->progs = (struct bpf_prog_skeleton *)calloc(s->prog_cnt, s->prog_skel_sz);
-	if (!s->progs)
-		goto err;
-
-	s->progs[0].name = "bpf_hrt_start_timer";
-	s->progs[0].prog = &obj->progs.bpf_hrt_start_timer;
-	s->progs[0].link = &obj->links.bpf_hrt_start_timer;
-
-	s->progs[1].name = "bpf_hrt_cpu_idle";
-	s->progs[1].prog = &obj->progs.bpf_hrt_cpu_idle;
-	s->progs[1].link = &obj->links.bpf_hrt_cpu_idle;
-
-	s->data_sz = 41064;
-	s->data = (void *)"\
-\x7f\x45\x4c\x46\x02\x01\x01\0\0\0\0\0\0\0\0\0\x01\0\xf7\0\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\xe8\x98\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\x40\0\x1e\0\
-\x01\0\xb7\x01\0\0\0\0\0\0\x63\x1a\xfc\xff\0\0\0\0\x85\0\0\0\x08\0\0\0\x18\x01\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x79\x11\x10\0\0\0\0\0\x55\x01\x2d\0\0\0\0\0\x18\
-\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\0\0\x71\x11\0\0\0\0\0\0\x55\x01\x29\0\0\0\0\0\
-\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xfc\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\x15\x06\x22\0\0\0\0\0\x85\0\0\0\
-\x07\0\0\0\x18\x01\0\0\xec\0\0\0\0\0\0\0\0\0\0\0\x61\x11\0\0\0\0\0\0\x18\x02\0\
-\0\xe8\0\0\0\0\0\0\0\0\0\0\0\x61\x22\0\0\0\0\0\0\x1f\x12\0\0\0\0\0\0\xbf\x23\0\
-\0\0\0\0\0\x67\x03\0\0\x20\0\0\0\x77\x03\0\0\x20\0\0\0\xbf\x04\0\0\0\0\0\0\x67\
-\x04\0\0\x20\0\0\0\x77\x04\0\0\x20\0\0\0\x3f\x34\0\0\0\0\0\0\x2f\x24\0\0\0\0\0\
-\0\x1f\x40\0\0\0\0\0\0\x0f\x10\0\0\0\0\0\0\x18\x07\0\0\xe4\0\0\0\0\0\0\0\0\0\0\
-\0\x63\x07\0\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\x61\x72\0\0\0\0\0\0\x0f\x20\0\0\0\0\
-\0\0\x18\x01\0\0\xf0\0\0\0\0\0\0\0\0\0\0\0\x7b\x01\0\0\0\0\0\0\xbf\x61\0\0\0\0\
-\0\0\xb7\x03\0\0\0\0\0\0\x85\0\0\0\xab\0\0\0\x18\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\
-\0\0\xb7\x02\0\0\x01\0\0\0\x73\x21\0\0\0\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\
-\0\0\x85\0\0\0\x08\0\0\0\x18\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\0\0\
-\0\0\x73\x21\0\0\0\0\0\0\x18\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x79\x61\x10\0\0\0\
-\0\0\x15\x01\x1e\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\x7b\x06\x50\0\0\0\0\0\x7b\x06\
-\x48\0\0\0\0\0\x7b\x06\x20\0\0\0\0\0\x18\x01\0\0\xe4\0\0\0\0\0\0\0\0\0\0\0\x61\
-\x11\0\0\0\0\0\0\x63\x16\x04\0\0\0\0\0\x18\x01\0\0\xf0\0\0\0\0\0\0\0\0\0\0\0\
-\x79\x11\0\0\0\0\0\0\x7b\x16\x08\0\0\0\0\0\x79\x61\x18\0\0\0\0\0\x55\x01\x10\0\
-\0\0\0\0\xb7\x07\0\0\x01\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\
-\x01\0\0\0\xb7\x03\0\0\0\0\0\0\x85\0\0\0\x83\0\0\0\x55\0\x05\0\0\0\0\0\x18\x01\
-\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x2e\0\0\0\x85\0\0\0\x06\0\0\0\x05\0\
-\x04\0\0\0\0\0\x73\x70\0\0\0\0\0\0\xbf\x01\0\0\0\0\0\0\xb7\x02\0\0\0\0\0\0\x85\
-\0\0\0\x84\0\0\0\x79\x61\x08\0\0\0\0\0\x79\x62\x10\0\0\0\0\0\x3d\x12\x55\0\0\0\
-\0\0\x79\x63\x18\0\0\0\0\0\x15\x03\x53\0\0\0\0\0\x79\x64\x20\0\0\0\0\0\x15\x04\
-\x51\0\0\0\0\0\x15\x02\x50\0\0\0\0\0\x3d\x31\x4f\0\0\0\0\0\xb7\x06\0\0\0\0\0\0\
-\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\xe0\0\0\0\xb7\x03\0\0\0\0\0\0\
-\x85\0\0\0\x83\0\0\0\x55\0\x05\0\0\0\0\0\x18\x01\0\0\x36\0\0\0\0\0\0\0\0\0\0\0\
-\xb7\x02\0\0\x2f\0\0\0\x85\0\0\0\x06\0\0\0\x05\0\x43\0\0\0\0\0\x18\x07\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x79\x71\x60\0\0\0\0\0\x7b\x10\x60\0\0\0\0\0\x79\x71\x58\0\
-\0\0\0\0\x7b\x10\x58\0\0\0\0\0\x79\x71\x50\0\0\0\0\0\x7b\x10\x50\0\0\0\0\0\x79\
-\x71\x48\0\0\0\0\0\x7b\x10\x48\0\0\0\0\0\x79\x71\x40\0\0\0\0\0\x7b\x10\x40\0\0\
-\0\0\0\x79\x71\x38\0\0\0\0\0\x7b\x10\x38\0\0\0\0\0\x79\x71\x30\0\0\0\0\0\x7b\
-\x10\x30\0\0\0\0\0\x79\x71\x28\0\0\0\0\0\x7b\x10\x28\0\0\0\0\0\x79\x71\x20\0\0\
-\0\0\0\x7b\x10\x20\0\0\0\0\0\x79\x71\x18\0\0\0\0\0\x7b\x10\x18\0\0\0\0\0\x79\
-\x71\x10\0\0\0\0\0\x7b\x10\x10\0\0\0\0\0\x79\x71\x08\0\0\0\0\0\x7b\x10\x08\0\0\
-\0\0\0\x79\x71\0\0\0\0\0\0\x7b\x10\0\0\0\0\0\0\x73\x60\0\0\0\0\0\0\x18\x01\0\0\
-\xf8\0\0\0\0\0\0\0\0\0\0\0\x79\x12\x08\0\0\0\0\0\x7b\x20\x68\0\0\0\0\0\x79\x12\
-\x10\0\0\0\0\0\x7b\x20\x70\0\0\0\0\0\x79\x12\x18\0\0\0\0\0\x7b\x20\x78\0\0\0\0\
-\0\x79\x12\x20\0\0\0\0\0\x7b\x20\x80\0\0\0\0\0\x79\x12\x28\0\0\0\0\0\x7b\x20\
-\x88\0\0\0\0\0\x79\x12\x30\0\0\0\0\0\x7b\x20\x90\0\0\0\0\0\x79\x12\x38\0\0\0\0\
-\0\x7b\x20\x98\0\0\0\0\0\x79\x12\x40\0\0\0\0\0\x7b\x20\xa0\0\0\0\0\0\x79\x12\
-\x48\0\0\0\0\0\x7b\x20\xa8\0\0\0\0\0\x79\x12\x50\0\0\0\0\0\x7b\x20\xb0\0\0\0\0\
-\0\x79\x12\x58\0\0\0\0\0\x7b\x20\xb8\0\0\0\0\0\x79\x12\x60\0\0\0\0\0\x7b\x20\
-\xc0\0\0\0\0\0\x79\x12\x68\0\0\0\0\0\x7b\x20\xc8\0\0\0\0\0\x79\x12\x70\0\0\0\0\
-\0\x7b\x20\xd0\0\0\0\0\0\x79\x11\x78\0\0\0\0\0\x7b\x10\xd8\0\0\0\0\0\xbf\x01\0\
-\0\0\0\0\0\xb7\x02\0\0\0\0\0\0\x85\0\0\0\x84\0\0\0\x7b\x67\x20\0\0\0\0\0\x7b\
-\x67\x18\0\0\0\0\0\x7b\x67\x10\0\0\0\0\0\xb7\x01\0\0\0\0\0\0\x63\x1a\xfc\xff\0\
-\0\0\0\x85\0\0\0\x08\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x79\x11\x10\0\0\
-\0\0\0\x55\x01\x2d\0\0\0\0\0\x18\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\0\0\x71\x11\0\0\
-\0\0\0\0\x55\x01\x29\0\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xfc\xff\xff\xff\
-\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\
-\x15\x06\x22\0\0\0\0\0\x85\0\0\0\x07\0\0\0\x18\x01\0\0\xec\0\0\0\0\0\0\0\0\0\0\
-\0\x61\x11\0\0\0\0\0\0\x18\x02\0\0\xe8\0\0\0\0\0\0\0\0\0\0\0\x61\x22\0\0\0\0\0\
-\0\x1f\x12\0\0\0\0\0\0\xbf\x23\0\0\0\0\0\0\x67\x03\0\0\x20\0\0\0\x77\x03\0\0\
-\x20\0\0\0\xbf\x04\0\0\0\0\0\0\x67\x04\0\0\x20\0\0\0\x77\x04\0\0\x20\0\0\0\x3f\
-\x34\0\0\0\0\0\0\x2f\x24\0\0\0\0\0\0\x1f\x40\0\0\0\0\0\0\x0f\x10\0\0\0\0\0\0\
-\x18\x07\0\0\xe4\0\0\0\0\0\0\0\0\0\0\0\x63\x07\0\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\
-\x61\x72\0\0\0\0\0\0\x0f\x20\0\0\0\0\0\0\x18\x01\0\0\xf0\0\0\0\0\0\0\0\0\0\0\0\
-\x7b\x01\0\0\0\0\0\0\xbf\x61\0\0\0\0\0\0\xb7\x03\0\0\0\0\0\0\x85\0\0\0\xab\0\0\
-\0\x18\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x01\0\0\0\x73\x21\0\0\0\0\
-\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\xb7\x07\0\0\0\0\0\0\x63\x7a\xf8\xff\0\
-\0\0\0\x61\x12\0\0\0\0\0\0\x18\x03\0\0\xec\0\0\0\0\0\0\0\0\0\0\0\x63\x23\0\0\0\
-\0\0\0\x61\x11\x04\0\0\0\0\0\x18\x02\0\0\xe8\0\0\0\0\0\0\0\0\0\0\0\x63\x12\0\0\
-\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xf8\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\x18\0\0\0\xfe\xff\xff\
-\xff\0\0\0\0\0\0\0\0\x15\x06\x3d\0\0\0\0\0\xbf\x61\0\0\0\0\0\0\x18\x02\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\xb7\x03\0\0\x01\0\0\0\x85\0\0\0\xa9\0\0\0\xbf\x61\0\0\0\0\
-\0\0\x18\x02\0\0\xb0\x01\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\xaa\0\0\0\x63\x7a\xfc\
-\xff\0\0\0\0\x85\0\0\0\x08\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x79\x11\
-\x10\0\0\0\0\0\x55\x01\x2d\0\0\0\0\0\x18\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\0\0\x71\
-\x11\0\0\0\0\0\0\x55\x01\x29\0\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xfc\xff\
-\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\
-\0\0\0\x15\x06\x22\0\0\0\0\0\x85\0\0\0\x07\0\0\0\x18\x01\0\0\xec\0\0\0\0\0\0\0\
-\0\0\0\0\x61\x11\0\0\0\0\0\0\x18\x02\0\0\xe8\0\0\0\0\0\0\0\0\0\0\0\x61\x22\0\0\
-\0\0\0\0\x1f\x12\0\0\0\0\0\0\xbf\x23\0\0\0\0\0\0\x67\x03\0\0\x20\0\0\0\x77\x03\
-\0\0\x20\0\0\0\xbf\x04\0\0\0\0\0\0\x67\x04\0\0\x20\0\0\0\x77\x04\0\0\x20\0\0\0\
-\x3f\x34\0\0\0\0\0\0\x2f\x24\0\0\0\0\0\0\x1f\x40\0\0\0\0\0\0\x0f\x10\0\0\0\0\0\
-\0\x18\x07\0\0\xe4\0\0\0\0\0\0\0\0\0\0\0\x63\x07\0\0\0\0\0\0\x85\0\0\0\x7d\0\0\
-\0\x61\x72\0\0\0\0\0\0\x0f\x20\0\0\0\0\0\0\x18\x01\0\0\xf0\0\0\0\0\0\0\0\0\0\0\
-\0\x7b\x01\0\0\0\0\0\0\xbf\x61\0\0\0\0\0\0\xb7\x03\0\0\0\0\0\0\x85\0\0\0\xab\0\
-\0\0\x18\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x01\0\0\0\x73\x21\0\0\0\
-\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\x79\x12\0\0\0\0\0\0\x79\x11\x08\0\0\
-\0\0\0\x18\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x61\x33\0\0\0\0\0\0\x67\x01\0\0\x20\
-\0\0\0\x77\x01\0\0\x20\0\0\0\x5d\x13\x71\0\0\0\0\0\xbf\x21\0\0\0\0\0\0\x67\x01\
-\0\0\x20\0\0\0\x77\x01\0\0\x20\0\0\0\x18\x03\0\0\xff\xff\xff\xff\0\0\0\0\0\0\0\
-\0\x5d\x31\x39\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x79\x12\x20\0\0\0\0\0\x55\x02\x04\0\0\0\0\0\x18\x02\0\0\xf0\0\0\0\0\0\0\0\0\
-\0\0\0\x79\x22\0\0\0\0\0\0\x2d\x02\x64\0\0\0\0\0\x7b\x01\x38\0\0\0\0\0\x7b\x01\
-\x18\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x01\0\0\0\x85\0\
-\0\0\x16\0\0\0\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x79\x61\x08\0\0\0\0\0\x1f\
-\x10\0\0\0\0\0\0\x7b\x06\x08\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\
-\x02\0\0\x02\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x09\0\xe9\xff\xff\xff\x79\x61\x10\
-\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x10\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\xb7\x02\0\0\x03\0\0\0\x85\0\0\0\x16\0\0\0\xb7\x01\0\0\xea\xff\xff\
-\xff\x2d\x01\x32\x01\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\0\
-\0\0\0\x85\0\0\0\x16\0\0\0\xb7\x01\0\0\0\xfe\xff\xff\x2d\x01\x06\0\0\0\0\0\x18\
-\x01\0\0\x65\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x20\0\0\0\xbf\x03\0\0\0\0\0\0\
-\x85\0\0\0\x06\0\0\0\xb7\0\0\0\0\0\0\0\x18\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x7b\
-\x06\x30\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\x79\x62\x20\0\0\0\0\0\xb7\x01\0\0\x01\0\
-\0\0\x55\x02\x01\0\0\0\0\0\xb7\x01\0\0\0\0\0\0\x7b\x06\x40\0\0\0\0\0\x79\x62\
-\x10\0\0\0\0\0\x05\0\x39\0\0\0\0\0\x18\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x63\x26\
-\x58\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\
-\0\0\0\0\0\0\x85\0\0\0\x16\0\0\0\xb7\x01\0\0\0\xfe\xff\xff\x2d\x01\x06\0\0\0\0\
-\0\x18\x01\0\0\x65\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x20\0\0\0\xbf\x03\0\0\0\0\
-\0\0\x85\0\0\0\x06\0\0\0\xb7\0\0\0\0\0\0\0\x7b\x06\x28\0\0\0\0\0\x18\x01\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x02\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x09\0\
-\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x7b\x06\x10\0\0\0\0\0\
-\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x03\0\0\0\x85\0\0\0\x16\0\0\0\
-\xb7\x01\0\0\xea\xff\xff\xff\x2d\x01\x30\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\xb7\x02\0\0\x01\0\0\0\x85\0\0\0\x16\0\0\0\x18\x01\0\0\xf8\0\0\0\0\0\0\
-\0\0\0\0\0\x7b\x01\x08\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\x18\x01\0\0\xf0\0\0\0\0\0\
-\0\0\0\0\0\0\x79\x13\0\0\0\0\0\0\xb7\x01\0\0\0\0\0\0\xb7\x02\0\0\0\0\0\0\x2d\
-\x30\x01\0\0\0\0\0\xbf\x02\0\0\0\0\0\0\x18\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x7b\
-\x13\x18\0\0\0\0\0\x7b\x23\x10\0\0\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\
-\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\0\0\0\0\x7b\x21\x10\0\0\0\0\0\
-\xb7\x01\0\0\0\0\0\0\x18\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x79\x64\x08\0\0\0\0\0\
-\x3d\x42\xab\0\0\0\0\0\x79\x63\x18\0\0\0\0\0\x3d\x34\xa9\0\0\0\0\0\x15\x02\xa8\
-\0\0\0\0\0\x57\x01\0\0\x01\0\0\0\x15\x01\xa6\0\0\0\0\0\x15\x03\xa5\0\0\0\0\0\
-\xb7\x07\0\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\xe0\0\0\0\
-\xb7\x03\0\0\0\0\0\0\x85\0\0\0\x83\0\0\0\x55\0\x5b\0\0\0\0\0\x18\x01\0\0\x36\0\
-\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x2f\0\0\0\x85\0\0\0\x06\0\0\0\x05\0\x99\0\0\0\
-\0\0\x7b\x06\x18\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x04\
-\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\xca\xff\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\
-\0\0\0\0\0\0\0\0\x7b\x06\x20\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\
-\x02\0\0\x05\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\xc2\xff\xe9\xff\xff\xff\x7b\x06\
-\x28\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x06\0\0\0\x85\0\
-\0\0\x16\0\0\0\x25\0\xbc\xff\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\
-\0\0\x7b\x06\x30\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x07\
-\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\xb4\xff\xe9\xff\xff\xff\x7b\x06\x38\0\0\0\0\0\
-\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x08\0\0\0\x85\0\0\0\x16\0\0\0\
-\x25\0\xae\xff\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x7b\x06\
-\x40\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x09\0\0\0\x85\0\
-\0\0\x16\0\0\0\x25\0\xa6\xff\xe9\xff\xff\xff\x7b\x06\x48\0\0\0\0\0\x18\x01\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0a\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\xa0\
-\xff\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x7b\x06\x50\0\0\0\0\
-\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0b\0\0\0\x85\0\0\0\x16\0\0\
-\0\x25\0\x98\xff\xe9\xff\xff\xff\x7b\x06\x58\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\xb7\x02\0\0\x0c\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x92\xff\xe9\xff\
-\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x7b\x06\x60\0\0\0\0\0\x18\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0d\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x8a\
-\xff\xe9\xff\xff\xff\x7b\x06\x68\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\xb7\x02\0\0\x0e\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x84\xff\xe9\xff\xff\xff\x18\
-\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x7b\x06\x70\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\xb7\x02\0\0\x0f\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x7c\xff\xe9\xff\
-\xff\xff\x7b\x06\x78\0\0\0\0\0\x05\0\x7a\xff\0\0\0\0\x18\x08\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\x79\x81\x60\0\0\0\0\0\x7b\x10\x60\0\0\0\0\0\x79\x81\x58\0\0\0\0\0\
-\x7b\x10\x58\0\0\0\0\0\x79\x81\x50\0\0\0\0\0\x7b\x10\x50\0\0\0\0\0\x79\x81\x48\
-\0\0\0\0\0\x7b\x10\x48\0\0\0\0\0\x79\x81\x40\0\0\0\0\0\x7b\x10\x40\0\0\0\0\0\
-\x79\x81\x38\0\0\0\0\0\x7b\x10\x38\0\0\0\0\0\x79\x81\x30\0\0\0\0\0\x7b\x10\x30\
-\0\0\0\0\0\x79\x81\x28\0\0\0\0\0\x7b\x10\x28\0\0\0\0\0\x79\x81\x20\0\0\0\0\0\
-\x7b\x10\x20\0\0\0\0\0\x79\x81\x18\0\0\0\0\0\x7b\x10\x18\0\0\0\0\0\x79\x81\x10\
-\0\0\0\0\0\x7b\x10\x10\0\0\0\0\0\x79\x81\x08\0\0\0\0\0\x7b\x10\x08\0\0\0\0\0\
-\x79\x81\0\0\0\0\0\0\x7b\x10\0\0\0\0\0\0\x73\x70\0\0\0\0\0\0\x18\x01\0\0\xf8\0\
-\0\0\0\0\0\0\0\0\0\0\x79\x12\x08\0\0\0\0\0\x7b\x20\x68\0\0\0\0\0\x79\x12\x10\0\
-\0\0\0\0\x7b\x20\x70\0\0\0\0\0\x79\x12\x18\0\0\0\0\0\x7b\x20\x78\0\0\0\0\0\x79\
-\x12\x20\0\0\0\0\0\x7b\x20\x80\0\0\0\0\0\x79\x12\x28\0\0\0\0\0\x7b\x20\x88\0\0\
-\0\0\0\x79\x12\x30\0\0\0\0\0\x7b\x20\x90\0\0\0\0\0\x79\x12\x38\0\0\0\0\0\x7b\
-\x20\x98\0\0\0\0\0\x79\x12\x40\0\0\0\0\0\x7b\x20\xa0\0\0\0\0\0\x79\x12\x48\0\0\
-\0\0\0\x7b\x20\xa8\0\0\0\0\0\x79\x12\x50\0\0\0\0\0\x7b\x20\xb0\0\0\0\0\0\x79\
-\x12\x58\0\0\0\0\0\x7b\x20\xb8\0\0\0\0\0\x79\x12\x60\0\0\0\0\0\x7b\x20\xc0\0\0\
-\0\0\0\x79\x12\x68\0\0\0\0\0\x7b\x20\xc8\0\0\0\0\0\x79\x12\x70\0\0\0\0\0\x7b\
-\x20\xd0\0\0\0\0\0\x79\x11\x78\0\0\0\0\0\x7b\x10\xd8\0\0\0\0\0\xbf\x01\0\0\0\0\
-\0\0\xb7\x02\0\0\0\0\0\0\x85\0\0\0\x84\0\0\0\x7b\x78\x20\0\0\0\0\0\x7b\x78\x18\
-\0\0\0\0\0\x7b\x78\x10\0\0\0\0\0\xb7\x01\0\0\0\0\0\0\x63\x1a\xfc\xff\0\0\0\0\
-\x85\0\0\0\x08\0\0\0\x79\x61\x10\0\0\0\0\0\x55\x01\x45\xff\0\0\0\0\x18\x01\0\0\
-\xe0\0\0\0\0\0\0\0\0\0\0\0\x71\x11\0\0\0\0\0\0\x55\x01\x41\xff\0\0\0\0\xbf\xa2\
-\0\0\0\0\0\0\x07\x02\0\0\xfc\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\x15\x06\x3a\xff\0\0\0\0\x85\0\0\0\x07\
-\0\0\0\x18\x01\0\0\xec\0\0\0\0\0\0\0\0\0\0\0\x61\x11\0\0\0\0\0\0\x18\x02\0\0\
-\xe8\0\0\0\0\0\0\0\0\0\0\0\x61\x22\0\0\0\0\0\0\x1f\x12\0\0\0\0\0\0\xbf\x23\0\0\
-\0\0\0\0\x67\x03\0\0\x20\0\0\0\x77\x03\0\0\x20\0\0\0\xbf\x04\0\0\0\0\0\0\x67\
-\x04\0\0\x20\0\0\0\x77\x04\0\0\x20\0\0\0\x3f\x34\0\0\0\0\0\0\x2f\x24\0\0\0\0\0\
-\0\x1f\x40\0\0\0\0\0\0\x0f\x10\0\0\0\0\0\0\x18\x07\0\0\xe4\0\0\0\0\0\0\0\0\0\0\
-\0\x63\x07\0\0\0\0\0\0\x85\0\0\0\x7d\0\0\0\x61\x72\0\0\0\0\0\0\x0f\x20\0\0\0\0\
-\0\0\x18\x01\0\0\xf0\0\0\0\0\0\0\0\0\0\0\0\x7b\x01\0\0\0\0\0\0\xbf\x61\0\0\0\0\
-\0\0\xb7\x03\0\0\0\0\0\0\x85\0\0\0\xab\0\0\0\x18\x01\0\0\xe0\0\0\0\0\0\0\0\0\0\
-\0\0\xb7\x02\0\0\x01\0\0\0\x73\x21\0\0\0\0\0\0\x05\0\x17\xff\0\0\0\0\x18\x06\0\
-\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x79\x61\x18\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\
-\x18\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x04\0\0\0\x85\0\
-\0\0\x16\0\0\0\x25\0\xc4\xfe\xe9\xff\xff\xff\x79\x61\x20\0\0\0\0\0\x1f\x10\0\0\
-\0\0\0\0\x7b\x06\x20\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\
-\x05\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\xbc\xfe\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\
-\0\0\0\0\0\0\0\0\0\0\x79\x61\x28\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x28\0\0\
-\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x06\0\0\0\x85\0\0\0\x16\
-\0\0\0\x25\0\xb2\xfe\xe9\xff\xff\xff\x79\x61\x30\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\
-\x7b\x06\x30\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x07\0\0\
-\0\x85\0\0\0\x16\0\0\0\x25\0\xaa\xfe\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\
-\0\0\0\0\0\0\x79\x61\x38\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x38\0\0\0\0\0\
-\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x08\0\0\0\x85\0\0\0\x16\0\0\0\
-\x25\0\xa0\xfe\xe9\xff\xff\xff\x79\x61\x40\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\
-\x06\x40\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x09\0\0\0\
-\x85\0\0\0\x16\0\0\0\x25\0\x98\xfe\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\
-\0\0\0\0\0\x79\x61\x48\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x48\0\0\0\0\0\x18\
-\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0a\0\0\0\x85\0\0\0\x16\0\0\0\x25\
-\0\x8e\xfe\xe9\xff\xff\xff\x79\x61\x50\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\
-\x50\0\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0b\0\0\0\x85\0\
-\0\0\x16\0\0\0\x25\0\x86\xfe\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\
-\0\0\x79\x61\x58\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x58\0\0\0\0\0\x18\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0c\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x7c\
-\xfe\xe9\xff\xff\xff\x79\x61\x60\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x60\0\0\
-\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0d\0\0\0\x85\0\0\0\x16\
-\0\0\0\x25\0\x74\xfe\xe9\xff\xff\xff\x18\x06\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x79\
-\x61\x68\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x68\0\0\0\0\0\x18\x01\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0e\0\0\0\x85\0\0\0\x16\0\0\0\x25\0\x6a\xfe\xe9\
-\xff\xff\xff\x79\x61\x70\0\0\0\0\0\x1f\x10\0\0\0\0\0\0\x7b\x06\x70\0\0\0\0\0\
-\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x0f\0\0\0\x85\0\0\0\x16\0\0\0\
-\x25\0\x62\xfe\xe9\xff\xff\xff\x18\x01\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x79\x12\
-\x78\0\0\0\0\0\x1f\x20\0\0\0\0\0\0\x7b\x01\x78\0\0\0\0\0\x05\0\x5c\xfe\0\0\0\0\
-\0\x12\x05\0\0\0\0\0\x62\x70\x66\x5f\x68\x72\x74\x20\x57\x52\x4e\x3a\x20\x72\
-\x69\x6e\x67\x62\x75\x66\x20\x6f\x76\x65\x72\x66\x6c\x6f\x77\x2c\x20\x70\x69\
-\x6e\x67\x20\x64\x69\x73\x63\x61\x72\x64\x65\x64\0\x62\x70\x66\x5f\x68\x72\x74\
-\x20\x57\x52\x4e\x3a\x20\x72\x69\x6e\x67\x62\x75\x66\x20\x6f\x76\x65\x72\x66\
-\x6c\x6f\x77\x2c\x20\x65\x76\x65\x6e\x74\x20\x64\x69\x73\x63\x61\x72\x64\x65\
-\x64\0\x62\x70\x66\x5f\x68\x72\x74\x20\x57\x52\x4e\x3a\x20\x54\x53\x43\x20\x72\
-\x65\x61\x64\x20\x65\x72\x72\x6f\x72\x3a\x20\x25\x64\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x47\x50\x4c\0\
-\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\x58\0\0\0\0\
-\0\0\0\x03\0\x11\0\x9f\x58\0\0\0\0\0\0\0\xa0\x01\0\0\0\0\0\0\x02\0\x7a\x04\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\
-\x88\0\0\0\0\0\0\0\xa0\x01\0\0\0\0\0\0\x01\0\x56\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x38\0\0\0\0\
-\0\0\0\x01\0\x51\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\
-\xff\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\x50\0\0\0\0\0\0\0\x03\0\x11\0\x9f\x50\0\
-\0\0\0\0\0\0\x88\x02\0\0\0\0\0\0\x02\0\x7a\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x80\0\0\0\0\0\0\0\x60\x01\0\0\
-\0\0\0\0\x01\0\x56\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\
-\xff\0\0\0\0\0\0\0\0\xe0\0\0\0\0\0\0\0\x30\x01\0\0\0\0\0\0\x03\0\x11\0\x9f\x30\
-\x01\0\0\0\0\0\0\x78\x02\0\0\0\0\0\0\x02\0\x7a\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x60\x01\0\0\0\0\0\0\x78\
-\x02\0\0\0\0\0\0\x01\0\x56\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\
-\xff\xff\xff\0\0\0\0\0\0\0\0\xb0\x01\0\0\0\0\0\0\xb8\x01\0\0\0\0\0\0\x01\0\x51\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\
-\0\xb0\x01\0\0\0\0\0\0\xb8\x01\0\0\0\0\0\0\x01\0\x52\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xb0\x01\0\0\0\0\0\0\xb8\
-\x01\0\0\0\0\0\0\x01\0\x53\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\
-\xff\xff\xff\0\0\0\0\0\0\0\0\x98\x02\0\0\0\0\0\0\xc0\x02\0\0\0\0\0\0\x01\0\x50\
-\xc8\x02\0\0\0\0\0\0\xe8\x02\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x60\x03\0\0\0\0\0\0\x88\
-\x03\0\0\0\0\0\0\x01\0\x50\x90\x03\0\0\0\0\0\0\x90\x05\0\0\0\0\0\0\x01\0\x50\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\
-\x78\x04\0\0\0\0\0\0\x78\x05\0\0\0\0\0\0\x03\0\x11\x01\x9f\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xb0\x05\0\0\0\0\0\
-\0\0\x06\0\0\0\0\0\0\x03\0\x11\0\x9f\0\x06\0\0\0\0\0\0\x48\x07\0\0\0\0\0\0\x02\
-\0\x7a\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\
-\0\0\0\0\0\0\x30\x06\0\0\0\0\0\0\x48\x07\0\0\0\0\0\0\x01\0\x56\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x10\0\0\0\0\0\0\0\x01\0\x51\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\
-\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x30\0\0\0\0\0\0\0\x01\0\x51\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\
-\0\x10\0\0\0\0\0\0\0\x30\0\0\0\0\0\0\0\x01\0\x51\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x78\0\0\0\
-\0\0\0\0\x03\0\x72\0\x9f\x38\x02\0\0\0\0\0\0\x58\x02\0\0\0\0\0\0\x03\0\x72\0\
-\x9f\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\
-\0\0\0\x78\0\0\0\0\0\0\0\xe8\0\0\0\0\0\0\0\x01\0\x50\xd8\x03\0\0\0\0\0\0\0\x04\
-\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\
-\xff\xff\0\0\0\0\0\0\0\0\xc8\0\0\0\0\0\0\0\x80\x01\0\0\0\0\0\0\x06\0\x30\x20\
-\x10\x01\x1a\x9f\x10\x0b\0\0\0\0\0\0\xa0\x0e\0\0\0\0\0\0\x06\0\x30\x20\x10\x01\
-\x1a\x9f\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\
-\0\0\0\0\0\x10\x01\0\0\0\0\0\0\x50\x01\0\0\0\0\0\0\x03\0\x11\x02\x9f\x50\x01\0\
-\0\0\0\0\0\x80\x01\0\0\0\0\0\0\x03\0\x11\x03\x9f\x10\x0b\0\0\0\0\0\0\x38\x0b\0\
-\0\0\0\0\0\x03\0\x11\x03\x9f\x38\x0b\0\0\0\0\0\0\x78\x0b\0\0\0\0\0\0\x03\0\x11\
-\x04\x9f\x78\x0b\0\0\0\0\0\0\xc8\x0b\0\0\0\0\0\0\x03\0\x11\x05\x9f\xc8\x0b\0\0\
-\0\0\0\0\x08\x0c\0\0\0\0\0\0\x03\0\x11\x06\x9f\x08\x0c\0\0\0\0\0\0\x58\x0c\0\0\
-\0\0\0\0\x03\0\x11\x07\x9f\x58\x0c\0\0\0\0\0\0\x98\x0c\0\0\0\0\0\0\x03\0\x11\
-\x08\x9f\x98\x0c\0\0\0\0\0\0\xe8\x0c\0\0\0\0\0\0\x03\0\x11\x09\x9f\xe8\x0c\0\0\
-\0\0\0\0\x28\x0d\0\0\0\0\0\0\x03\0\x11\x0a\x9f\x28\x0d\0\0\0\0\0\0\x78\x0d\0\0\
-\0\0\0\0\x03\0\x11\x0b\x9f\x78\x0d\0\0\0\0\0\0\xb8\x0d\0\0\0\0\0\0\x03\0\x11\
-\x0c\x9f\xb8\x0d\0\0\0\0\0\0\x08\x0e\0\0\0\0\0\0\x03\0\x11\x0d\x9f\x08\x0e\0\0\
-\0\0\0\0\x48\x0e\0\0\0\0\0\0\x03\0\x11\x0e\x9f\x48\x0e\0\0\0\0\0\0\x98\x0e\0\0\
-\0\0\0\0\x03\0\x11\x0f\x9f\x98\x0e\0\0\0\0\0\0\xa0\x0e\0\0\0\0\0\0\x03\0\x11\
-\x10\x9f\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\
-\0\0\0\0\0\x30\x01\0\0\0\0\0\0\x48\x01\0\0\0\0\0\0\x01\0\x50\x70\x01\0\0\0\0\0\
-\0\x80\x01\0\0\0\0\0\0\x01\0\x50\x10\x0b\0\0\0\0\0\0\x30\x0b\0\0\0\0\0\0\x01\0\
-\x50\x58\x0b\0\0\0\0\0\0\x70\x0b\0\0\0\0\0\0\x01\0\x50\x98\x0b\0\0\0\0\0\0\xc0\
-\x0b\0\0\0\0\0\0\x01\0\x50\xe8\x0b\0\0\0\0\0\0\0\x0c\0\0\0\0\0\0\x01\0\x50\x28\
-\x0c\0\0\0\0\0\0\x50\x0c\0\0\0\0\0\0\x01\0\x50\x78\x0c\0\0\0\0\0\0\x90\x0c\0\0\
-\0\0\0\0\x01\0\x50\xb8\x0c\0\0\0\0\0\0\xe0\x0c\0\0\0\0\0\0\x01\0\x50\x08\x0d\0\
-\0\0\0\0\0\x20\x0d\0\0\0\0\0\0\x01\0\x50\x48\x0d\0\0\0\0\0\0\x70\x0d\0\0\0\0\0\
-\0\x01\0\x50\x98\x0d\0\0\0\0\0\0\xb0\x0d\0\0\0\0\0\0\x01\0\x50\xd8\x0d\0\0\0\0\
-\0\0\0\x0e\0\0\0\0\0\0\x01\0\x50\x28\x0e\0\0\0\0\0\0\x40\x0e\0\0\0\0\0\0\x01\0\
-\x50\x68\x0e\0\0\0\0\0\0\x90\x0e\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x30\x01\0\0\0\0\0\0\
-\x48\x01\0\0\0\0\0\0\x01\0\x50\x70\x01\0\0\0\0\0\0\x80\x01\0\0\0\0\0\0\x01\0\
-\x50\x10\x0b\0\0\0\0\0\0\x30\x0b\0\0\0\0\0\0\x01\0\x50\x58\x0b\0\0\0\0\0\0\x70\
-\x0b\0\0\0\0\0\0\x01\0\x50\x98\x0b\0\0\0\0\0\0\xc0\x0b\0\0\0\0\0\0\x01\0\x50\
-\xe8\x0b\0\0\0\0\0\0\0\x0c\0\0\0\0\0\0\x01\0\x50\x28\x0c\0\0\0\0\0\0\x50\x0c\0\
-\0\0\0\0\0\x01\0\x50\x78\x0c\0\0\0\0\0\0\x90\x0c\0\0\0\0\0\0\x01\0\x50\xb8\x0c\
-\0\0\0\0\0\0\xe0\x0c\0\0\0\0\0\0\x01\0\x50\x08\x0d\0\0\0\0\0\0\x20\x0d\0\0\0\0\
-\0\0\x01\0\x50\x48\x0d\0\0\0\0\0\0\x70\x0d\0\0\0\0\0\0\x01\0\x50\x98\x0d\0\0\0\
-\0\0\0\xb0\x0d\0\0\0\0\0\0\x01\0\x50\xd8\x0d\0\0\0\0\0\0\0\x0e\0\0\0\0\0\0\x01\
-\0\x50\x28\x0e\0\0\0\0\0\0\x40\x0e\0\0\0\0\0\0\x01\0\x50\x68\x0e\0\0\0\0\0\0\
-\x90\x0e\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\
-\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xa0\x01\0\0\0\0\0\0\xd8\x01\0\0\0\0\0\0\x01\0\
-\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\
-\0\0\0\xa0\x01\0\0\0\0\0\0\xd8\x01\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x78\x02\0\0\0\0\0\0\
-\xb0\x02\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\
-\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x78\x02\0\0\0\0\0\0\xb0\x02\0\0\0\0\0\0\x01\0\
-\x50\xb0\x02\0\0\0\0\0\0\xb8\x02\0\0\0\0\0\0\x02\0\x30\x9f\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xc0\x02\0\0\0\0\0\
-\0\0\x03\0\0\0\0\0\0\x03\0\x11\x02\x9f\0\x03\0\0\0\0\0\0\x30\x03\0\0\0\0\0\0\
-\x03\0\x11\x03\x9f\xb0\x04\0\0\0\0\0\0\xb8\x04\0\0\0\0\0\0\x03\0\x11\x03\x9f\
-\xb8\x04\0\0\0\0\0\0\xf8\x04\0\0\0\0\0\0\x03\0\x11\x04\x9f\xf8\x04\0\0\0\0\0\0\
-\x28\x05\0\0\0\0\0\0\x03\0\x11\x05\x9f\x28\x05\0\0\0\0\0\0\x68\x05\0\0\0\0\0\0\
-\x03\0\x11\x06\x9f\x68\x05\0\0\0\0\0\0\x98\x05\0\0\0\0\0\0\x03\0\x11\x07\x9f\
-\x98\x05\0\0\0\0\0\0\xd8\x05\0\0\0\0\0\0\x03\0\x11\x08\x9f\xd8\x05\0\0\0\0\0\0\
-\x08\x06\0\0\0\0\0\0\x03\0\x11\x09\x9f\x08\x06\0\0\0\0\0\0\x48\x06\0\0\0\0\0\0\
-\x03\0\x11\x0a\x9f\x48\x06\0\0\0\0\0\0\x78\x06\0\0\0\0\0\0\x03\0\x11\x0b\x9f\
-\x78\x06\0\0\0\0\0\0\xb8\x06\0\0\0\0\0\0\x03\0\x11\x0c\x9f\xb8\x06\0\0\0\0\0\0\
-\xe8\x06\0\0\0\0\0\0\x03\0\x11\x0d\x9f\xe8\x06\0\0\0\0\0\0\x28\x07\0\0\0\0\0\0\
-\x03\0\x11\x0e\x9f\x28\x07\0\0\0\0\0\0\x58\x07\0\0\0\0\0\0\x03\0\x11\x0f\x9f\
-\x58\x07\0\0\0\0\0\0\x60\x07\0\0\0\0\0\0\x03\0\x11\x10\x9f\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xc0\x02\0\0\0\0\0\
-\0\xa0\x03\0\0\0\0\0\0\x05\0\x30\x10\x01\x1a\x9f\xb0\x04\0\0\0\0\0\0\x60\x07\0\
-\0\0\0\0\0\x05\0\x30\x10\x01\x1a\x9f\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\
-\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xe0\x02\0\0\0\0\0\0\x50\x03\0\0\0\0\0\
-\0\x01\0\x50\xb0\x04\0\0\0\0\0\0\x60\x07\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xe0\x02\0\0\0\
-\0\0\0\x50\x03\0\0\0\0\0\0\x01\0\x50\xb0\x04\0\0\0\0\0\0\x60\x07\0\0\0\0\0\0\
-\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\
-\0\0\0\0\0\0\x80\x04\0\0\0\0\0\0\xa8\x04\0\0\0\0\0\0\x01\0\x50\x60\x07\0\0\0\0\
-\0\0\x60\x09\0\0\0\0\0\0\x01\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\
-\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\x48\x08\0\0\0\0\0\0\x48\x09\0\0\0\0\0\0\
-\x03\0\x11\x01\x9f\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\
-\xff\0\0\0\0\0\0\0\0\x80\x09\0\0\0\0\0\0\xc0\x09\0\0\0\0\0\0\x03\0\x11\0\x9f\
-\xc0\x09\0\0\0\0\0\0\x10\x0b\0\0\0\0\0\0\x02\0\x7a\x04\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\xff\xff\xff\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xf0\x09\0\0\0\0\0\0\
-\x10\x0b\0\0\0\0\0\0\x01\0\x56\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x11\x01\x25\
-\x0e\x13\x05\x03\x0e\x10\x17\x1b\x0e\x11\x01\x55\x17\0\0\x02\x34\0\x03\x0e\x49\
-\x13\x3f\x19\x3a\x0b\x3b\x0b\x02\x18\0\0\x03\x26\0\x49\x13\0\0\x04\x16\0\x49\
-\x13\x03\x0e\x3a\x0b\x3b\x0b\0\0\x05\x24\0\x03\x0e\x3e\x0b\x0b\x0b\0\0\x06\x34\
-\0\x03\x0e\x49\x13\x3f\x19\x3a\x0b\x3b\x05\x02\x18\0\0\x07\x01\x01\x49\x13\0\0\
-\x08\x21\0\x49\x13\x37\x0b\0\0\x09\x24\0\x03\x0e\x0b\x0b\x3e\x0b\0\0\x0a\x13\
-\x01\x0b\x0b\x3a\x0b\x3b\x0b\0\0\x0b\x0d\0\x03\x0e\x49\x13\x3a\x0b\x3b\x0b\x38\
-\x0b\0\0\x0c\x0f\0\x49\x13\0\0\x0d\x21\0\x49\x13\x37\x05\0\0\x0e\x13\x01\x03\
-\x0e\x0b\x0b\x3a\x0b\x3b\x0b\0\0\x0f\x0d\0\x03\x0e\x49\x13\x3a\x0b\x3b\x0b\x88\
-\x01\x0f\x38\x0b\0\0\x10\x13\0\x03\x0e\x0b\x0b\x3a\x0b\x3b\x05\x88\x01\x0f\0\0\
-\x11\x34\0\x03\x0e\x49\x13\x3a\x0b\x3b\x0b\x02\x18\0\0\x12\x35\0\x49\x13\0\0\
-\x13\x34\0\x03\x0e\x49\x13\x3a\x0b\x3b\x0b\0\0\x14\x15\0\x49\x13\x27\x19\0\0\
-\x15\x15\x01\x49\x13\x27\x19\0\0\x16\x05\0\x49\x13\0\0\x17\x0f\0\0\0\x18\x26\0\
-\0\0\x19\x34\0\x03\x0e\x49\x13\x3a\x0b\x3b\x05\0\0\x1a\x2e\x01\0\0\x1b\x18\0\0\
-\0\x1c\x15\x01\x27\x19\0\0\x1d\x04\x01\x49\x13\x0b\x0b\x3a\x0b\x3b\x0b\0\0\x1e\
-\x28\0\x03\x0e\x1c\x0f\0\0\x1f\x2e\x01\x11\x01\x12\x06\x40\x18\x97\x42\x19\x31\
-\x13\0\0\x20\x34\0\x02\x17\x31\x13\0\0\x21\x34\0\x31\x13\0\0\x22\x2e\x01\x03\
-\x0e\x3a\x0b\x3b\x0b\x27\x19\x49\x13\x3f\x19\x20\x0b\0\0\x23\x34\0\x03\x0e\x3a\
-\x0b\x3b\x0b\x49\x13\0\0\x24\x2e\x01\x11\x01\x12\x06\x40\x18\x97\x42\x19\x03\
-\x0e\x3a\x0b\x3b\x0b\x27\x19\x49\x13\x3f\x19\0\0\x25\x05\0\x02\x17\x03\x0e\x3a\
-\x0b\x3b\x0b\x49\x13\0\0\x26\x34\0\x02\x17\x03\x0e\x3a\x0b\x3b\x0b\x49\x13\0\0\
-\x27\x1d\x01\x31\x13\x11\x01\x12\x06\x58\x0b\x59\x0b\x57\x0b\0\0\x28\x2e\x01\
-\x03\x0e\x3a\x0b\x3b\x0b\x27\x19\x20\x0b\0\0\x29\x2e\x01\x11\x01\x12\x06\x40\
-\x18\x97\x42\x19\x03\x0e\x3a\x0b\x3b\x0b\x27\x19\x49\x13\0\0\x2a\x2e\x01\x03\
-\x0e\x3a\x0b\x3b\x05\x27\x19\x49\x13\x20\x0b\0\0\x2b\x05\0\x03\x0e\x3a\x0b\x3b\
-\x05\x49\x13\0\0\x2c\x34\0\x03\x0e\x3a\x0b\x3b\x05\x49\x13\0\0\x2d\x05\0\x03\
-\x0e\x3a\x0b\x3b\x0b\x49\x13\0\0\x2e\x2e\x01\x03\x0e\x3a\x0b\x3b\x0b\x27\x19\
-\x49\x13\x20\x0b\0\0\x2f\x2e\x01\x11\x01\x12\x06\x40\x18\x97\x42\x19\x03\x0e\
-\x3a\x0b\x3b\x05\x27\x19\x49\x13\x3f\x19\0\0\x30\x05\0\x02\x17\x03\x0e\x3a\x0b\
-\x3b\x05\x49\x13\0\0\x31\x1d\x01\x31\x13\x55\x17\x58\x0b\x59\x05\x57\x0b\0\0\
-\x32\x05\0\x31\x13\0\0\x33\x05\0\x02\x17\x31\x13\0\0\x34\x1d\x01\x31\x13\x11\
-\x01\x12\x06\x58\x0b\x59\x05\x57\x0b\0\0\0\x32\x0a\0\0\x04\0\0\0\0\0\x08\x01\0\
-\0\0\0\x0c\0\x2d\0\0\0\0\0\0\0\x37\0\0\0\0\0\0\0\0\0\0\0\xe0\0\0\0\x02\x55\0\0\
-\0\x3f\0\0\0\x05\x3d\x09\x03\0\0\0\0\0\0\0\0\x03\x44\0\0\0\x04\x4f\0\0\0\x7b\0\
-\0\0\x04\x0b\x04\x5a\0\0\0\x7f\0\0\0\x03\x68\x04\x65\0\0\0\x7b\0\0\0\x02\x15\
-\x04\x70\0\0\0\x75\0\0\0\x01\x1b\x05\x68\0\0\0\x07\x04\x06\x88\0\0\0\x8d\0\0\0\
-\x05\x31\x01\x09\x03\0\0\0\0\0\0\0\0\x07\x99\0\0\0\x08\xa0\0\0\0\x04\0\x05\x91\
-\0\0\0\x06\x01\x09\x96\0\0\0\x08\x07\x02\xaa\0\0\0\xbc\0\0\0\x05\x20\x09\x03\0\
-\0\0\0\0\0\0\0\x0a\x10\x05\x1d\x0b\xb1\0\0\0\xd9\0\0\0\x05\x1e\0\x0b\xba\0\0\0\
-\xf1\0\0\0\x05\x1f\x08\0\x0c\xde\0\0\0\x07\xea\0\0\0\x08\xa0\0\0\0\x1b\0\x05\
-\xb6\0\0\0\x05\x04\x0c\xf6\0\0\0\x07\xea\0\0\0\x0d\xa0\0\0\0\0\x10\0\x02\xc6\0\
-\0\0\x18\x01\0\0\x05\x27\x09\x03\0\0\0\0\0\0\0\0\x0a\x20\x05\x22\x0b\xb1\0\0\0\
-\x4d\x01\0\0\x05\x23\0\x0b\xcb\0\0\0\x4d\x01\0\0\x05\x24\x08\x0b\xd4\0\0\0\x4d\
-\x01\0\0\x05\x25\x10\x0b\xba\0\0\0\x5e\x01\0\0\x05\x26\x18\0\x0c\x52\x01\0\0\
-\x07\xea\0\0\0\x08\xa0\0\0\0\x04\0\x0c\x63\x01\0\0\x07\xea\0\0\0\x08\xa0\0\0\0\
-\x10\0\x02\xdf\0\0\0\x84\x01\0\0\x05\x32\x09\x03\0\0\0\0\0\0\0\0\x0a\x20\x05\
-\x2d\x0b\xb1\0\0\0\xb9\x01\0\0\x05\x2e\0\x0b\xba\0\0\0\xca\x01\0\0\x05\x2f\x08\
-\x0b\xe6\0\0\0\xdb\x01\0\0\x05\x30\x10\x0b\xea\0\0\0\xe0\x01\0\0\x05\x31\x18\0\
-\x0c\xbe\x01\0\0\x07\xea\0\0\0\x08\xa0\0\0\0\x02\0\x0c\xcf\x01\0\0\x07\xea\0\0\
-\0\x08\xa0\0\0\0\x01\0\x0c\xea\0\0\0\x0c\xe5\x01\0\0\x0e\xfc\0\0\0\x10\x05\x29\
-\x0f\xf0\0\0\0\xfb\x01\0\0\x05\x2a\x08\0\0\x10\xf2\0\0\0\x10\x06\x60\x19\x08\
-\x11\x07\x01\0\0\xea\0\0\0\x05\x34\x09\x03\xec\0\0\0\0\0\0\0\x11\x0d\x01\0\0\
-\xea\0\0\0\x05\x35\x09\x03\xe8\0\0\0\0\0\0\0\x11\x13\x01\0\0\x44\x02\0\0\x05\
-\x36\x09\x03\0\0\0\0\0\0\0\0\x0e\xaf\x01\0\0\xe0\x04\x3f\x0b\xb1\0\0\0\xf5\x02\
-\0\0\x04\x40\0\x0b\x2e\x01\0\0\x44\0\0\0\x04\x41\x04\x0b\x34\x01\0\0\x12\x03\0\
-\0\x04\x42\x08\x0b\x64\x01\0\0\x12\x03\0\0\x04\x43\x10\x0b\x68\x01\0\0\x12\x03\
-\0\0\x04\x44\x18\x0b\x6c\x01\0\0\x12\x03\0\0\x04\x45\x20\x0b\x72\x01\0\0\x12\
-\x03\0\0\x04\x46\x28\x0b\x76\x01\0\0\x12\x03\0\0\x04\x47\x30\x0b\x7a\x01\0\0\
-\x12\x03\0\0\x04\x48\x38\x0b\x80\x01\0\0\x12\x03\0\0\x04\x49\x40\x0b\x86\x01\0\
-\0\x12\x03\0\0\x04\x4a\x48\x0b\x8e\x01\0\0\x12\x03\0\0\x04\x4b\x50\x0b\x96\x01\
-\0\0\xea\0\0\0\x04\x4c\x58\x0b\xa1\x01\0\0\x45\x03\0\0\x04\x4d\x60\0\x04\0\x03\
-\0\0\x2b\x01\0\0\x02\x11\x04\x0b\x03\0\0\x26\x01\0\0\x01\x15\x05\x18\x01\0\0\
-\x08\x01\x04\x1d\x03\0\0\x57\x01\0\0\x04\x0a\x04\x28\x03\0\0\x5b\x01\0\0\x03\
-\x6b\x04\x33\x03\0\0\x57\x01\0\0\x02\x17\x04\x3e\x03\0\0\x51\x01\0\0\x01\x1f\
-\x05\x3a\x01\0\0\x07\x08\x07\x12\x03\0\0\x08\xa0\0\0\0\x10\0\x11\x34\x01\0\0\
-\x12\x03\0\0\x05\x37\x09\x03\xf0\0\0\0\0\0\0\0\x11\x2e\x01\0\0\x44\0\0\0\x05\
-\x38\x09\x03\xe4\0\0\0\0\0\0\0\x11\xb9\x01\0\0\x97\x03\0\0\x05\x39\x10\x03\xe0\
-\0\0\0\0\0\0\0\x94\x01\x31\x1e\x30\x22\x9f\x04\xa2\x03\0\0\xcb\x01\0\0\x03\x1e\
-\x05\xc5\x01\0\0\x02\x01\x02\xd0\x01\0\0\xbe\x03\0\0\x05\x46\x09\x03\0\0\0\0\0\
-\0\0\0\x03\xc3\x03\0\0\x12\x44\0\0\0\x13\xd8\x01\0\0\xd3\x03\0\0\x07\xc9\x0c\
-\xd8\x03\0\0\x14\x65\0\0\0\x13\xf1\x01\0\0\xe8\x03\0\0\x07\x33\x0c\xed\x03\0\0\
-\x15\xfd\x03\0\0\x16\xfd\x03\0\0\x16\xfe\x03\0\0\0\x17\x0c\x03\x04\0\0\x18\x13\
-\x05\x02\0\0\xd3\x03\0\0\x07\xbc\x19\x19\x02\0\0\x1b\x04\0\0\x07\xc4\x0b\x0c\
-\x20\x04\0\0\x14\x33\x03\0\0\x19\x2f\x02\0\0\x31\x04\0\0\x07\xa1\x0f\x0c\x36\
-\x04\0\0\x15\x4b\x04\0\0\x16\x52\x04\0\0\x16\x33\x03\0\0\x16\x33\x03\0\0\0\x05\
-\x3f\x02\0\0\x05\x08\x0c\xfb\x01\0\0\x19\x48\x02\0\0\x63\x04\0\0\x07\x74\x0f\
-\x0c\x68\x04\0\0\x15\x4b\x04\0\0\x16\x52\x04\0\0\x16\xfd\x03\0\0\x16\x33\x03\0\
-\0\0\x19\x57\x02\0\0\x89\x04\0\0\x07\x83\x0f\x0c\x8e\x04\0\0\x15\x4b\x04\0\0\
-\x16\x52\x04\0\0\x16\xfd\x03\0\0\0\x1a\x11\x6e\x02\0\0\xb5\x04\0\0\x05\x63\x09\
-\x03\x08\0\0\0\0\0\0\0\0\x07\xc1\x04\0\0\x08\xa0\0\0\0\x2e\0\x03\x99\0\0\0\x19\
-\x76\x02\0\0\xd2\x04\0\0\x07\x3c\x0c\x0c\xd7\x04\0\0\x15\xfd\x03\0\0\x16\xfd\
-\x03\0\0\x16\x33\x03\0\0\x16\x33\x03\0\0\0\x13\x8a\x02\0\0\xf7\x04\0\0\x07\xac\
-\x0c\xfc\x04\0\0\x15\x4b\x04\0\0\x16\x0d\x05\0\0\x16\x65\0\0\0\x1b\0\x0c\xc1\
-\x04\0\0\x19\x9b\x02\0\0\x1e\x05\0\0\x07\x4e\x0c\x0c\x23\x05\0\0\x1c\x16\xfd\
-\x03\0\0\x16\x33\x03\0\0\0\x1a\x11\x6e\x02\0\0\x46\x05\0\0\x05\x7d\x09\x03\x36\
-\0\0\0\0\0\0\0\0\x07\xc1\x04\0\0\x08\xa0\0\0\0\x2f\0\x11\xa1\x01\0\0\x45\x03\0\
-\0\x05\x3b\x09\x03\xf8\0\0\0\0\0\0\0\x19\xae\x02\0\0\x73\x05\0\0\x07\x48\x02\
-\x0c\x78\x05\0\0\x15\x33\x03\0\0\x16\xfd\x03\0\0\x16\x33\x03\0\0\0\x1a\x11\x6e\
-\x02\0\0\x9f\x05\0\0\x05\x56\x09\x03\x65\0\0\0\0\0\0\0\0\x07\xc1\x04\0\0\x08\
-\xa0\0\0\0\x20\0\x1d\x70\0\0\0\x04\x08\x0a\x1e\xc2\x02\0\0\0\x1e\xc8\x02\0\0\
-\x01\0\x1d\x70\0\0\0\x04\x04\x29\x1e\xcd\x02\0\0\0\x1e\xdc\x02\0\0\x01\0\x1d\
-\x70\0\0\0\x04\x04\x22\x1e\xeb\x02\0\0\0\x1e\xf3\x02\0\0\x01\x1e\xfd\x02\0\0\
-\x02\x1e\x05\x03\0\0\x03\0\x04\x01\x06\0\0\x29\x03\0\0\x02\x16\x04\x0c\x06\0\0\
-\x23\x03\0\0\x01\x1e\x05\x15\x03\0\0\x05\x08\x1f\0\0\0\0\0\0\0\0\xb0\x01\0\0\
-\x01\x5a\x43\x06\0\0\x20\0\0\0\0\x4f\x06\0\0\x21\x5a\x06\0\0\x20\x49\0\0\0\x65\
-\x06\0\0\x21\x70\x06\0\0\0\x22\x2d\x03\0\0\x05\x90\xea\0\0\0\x01\x23\xe6\0\0\0\
-\x05\x92\xea\0\0\0\x23\x40\x03\0\0\x05\x95\xea\0\0\0\x23\x47\x03\0\0\x05\x93\
-\x52\x04\0\0\x23\x4d\x03\0\0\x05\x94\xea\0\0\0\0\x24\0\0\0\0\0\0\0\0\x88\x02\0\
-\0\x01\x5a\xdc\x03\0\0\x05\xea\xea\0\0\0\x25\x7c\0\0\0\x12\x04\0\0\x05\xea\x0f\
-\x0a\0\0\x26\xaf\0\0\0\xe6\0\0\0\x05\xec\xea\0\0\0\x26\xf8\0\0\0\x47\x03\0\0\
-\x05\xed\x52\x04\0\0\x27\x43\x06\0\0\xe0\0\0\0\0\0\0\0\x98\x01\0\0\x05\xfa\x02\
-\x20\x2b\x01\0\0\x4f\x06\0\0\x21\x5a\x06\0\0\x20\x74\x01\0\0\x65\x06\0\0\0\0\
-\x28\x51\x03\0\0\x05\x5d\x01\x23\x62\x03\0\0\x05\x5f\x03\x07\0\0\0\x0c\x44\x02\
-\0\0\x28\x64\x03\0\0\x05\x6c\x01\x23\x62\x03\0\0\x05\x6e\x03\x07\0\0\x23\x77\
-\x03\0\0\x05\x6f\xea\0\0\0\0\x29\xb0\x01\0\0\0\0\0\0\xa8\x05\0\0\x01\x5a\xf0\
-\x03\0\0\x05\xd1\xea\0\0\0\x25\xa7\x01\0\0\x20\x04\0\0\x05\xd1\xfd\x03\0\0\x25\
-\xda\x01\0\0\xe6\0\0\0\x05\xd1\xdb\x01\0\0\x25\x0d\x02\0\0\x47\x03\0\0\x05\xd1\
-\x52\x04\0\0\x23\x40\x03\0\0\x05\xd3\xea\0\0\0\x27\xef\x06\0\0\x70\x02\0\0\0\0\
-\0\0\x78\0\0\0\x05\xe0\x04\x20\x40\x02\0\0\xf7\x06\0\0\0\x27\x08\x07\0\0\xf8\
-\x02\0\0\0\0\0\0\xb0\x02\0\0\x05\xe3\x02\x20\x86\x02\0\0\x10\x07\0\0\x20\xcc\
-\x02\0\0\x1b\x07\0\0\0\x27\x43\x06\0\0\xb0\x05\0\0\0\0\0\0\x98\x01\0\0\x05\xe4\
-\x02\x20\x01\x03\0\0\x4f\x06\0\0\x21\x5a\x06\0\0\x20\x4a\x03\0\0\x65\x06\0\0\0\
-\0\x2a\x79\x03\0\0\x05\0\x01\xea\0\0\0\x01\x2b\x8e\x03\0\0\x05\0\x01\x34\x08\0\
-\0\x2b\x92\x03\0\0\x05\0\x01\x70\0\0\0\x2b\x40\x03\0\0\x05\0\x01\x70\0\0\0\x2c\
-\x99\x03\0\0\x05\x02\x01\xea\0\0\0\x2c\xf0\0\0\0\x05\x03\x01\x12\x03\0\0\0\x0c\
-\x3e\x03\0\0\x28\x9d\x03\0\0\x05\xb1\x01\x2d\xb8\x03\0\0\x05\xb1\x97\x03\0\0\
-\x23\x77\x03\0\0\x05\xb3\xea\0\0\0\x23\xbd\x03\0\0\x05\xb6\xf6\x05\0\0\x23\xc1\
-\x03\0\0\x05\xb4\x12\x03\0\0\x23\xc7\x03\0\0\x05\xb4\x84\x08\0\0\x23\xe6\0\0\0\
-\x05\xb5\xea\0\0\0\0\x0c\x12\x03\0\0\x2e\xcb\x03\0\0\x05\x48\x12\x03\0\0\x01\
-\x23\xbd\x03\0\0\x05\x4b\xf6\x05\0\0\x23\xc1\x03\0\0\x05\x4a\x12\x03\0\0\0\x2f\
-\0\0\0\0\0\0\0\0\xa0\x0e\0\0\x01\x5a\x01\x04\0\0\x05\0\x01\xea\0\0\0\x30\x7d\
-\x03\0\0\x8e\x03\0\0\x05\0\x01\x34\x08\0\0\x31\xea\x07\0\0\0\0\0\0\x05\0\x01\
-\x05\x32\xf7\x07\0\0\x33\x16\x04\0\0\x03\x08\0\0\x33\xe3\x03\0\0\x0f\x08\0\0\
-\x20\xb0\x03\0\0\x1b\x08\0\0\x20\x60\x04\0\0\x27\x08\0\0\x31\x39\x08\0\0\x50\0\
-\0\0\x05\x0f\x01\x04\x33\xa6\x04\0\0\x41\x08\0\0\x20\xf6\x04\0\0\x4c\x08\0\0\
-\x20\x66\x06\0\0\x57\x08\0\0\x20\xa3\x07\0\0\x62\x08\0\0\0\x34\x89\x08\0\0\x80\
-\x01\0\0\0\0\0\0\x60\0\0\0\x05\x11\x01\x0f\x20\xe0\x08\0\0\x95\x08\0\0\x20\x13\
-\x09\0\0\xa0\x08\0\0\0\x31\x08\x07\0\0\x80\0\0\0\x05\x1b\x01\x03\x20\x0a\x0c\0\
-\0\x10\x07\0\0\x20\x50\x0c\0\0\x1b\x07\0\0\0\x34\x43\x06\0\0\x80\x09\0\0\0\0\0\
-\0\x90\x01\0\0\x05\x1c\x01\x03\x20\x85\x0c\0\0\x4f\x06\0\0\x21\x5a\x06\0\0\x20\
-\xce\x0c\0\0\x65\x06\0\0\0\x34\x89\x08\0\0\x58\x02\0\0\0\0\0\0\x60\0\0\0\x05\
-\x24\x01\x0e\x20\x46\x09\0\0\x95\x08\0\0\x20\x79\x09\0\0\xa0\x08\0\0\0\x31\x39\
-\x08\0\0\xb0\0\0\0\x05\x25\x01\x03\x33\x30\x0b\0\0\x41\x08\0\0\x20\xc0\x09\0\0\
-\x4c\x08\0\0\x20\x7e\x0b\0\0\x57\x08\0\0\x20\xc4\x0b\0\0\x62\x08\0\0\0\0\0\x0c\
-\x14\x0a\0\0\x0e\x17\x04\0\0\x08\x04\x50\x0b\x07\x01\0\0\x44\0\0\0\x04\x51\0\
-\x0b\x0d\x01\0\0\x44\0\0\0\x04\x52\x04\0\0\x10\0\0\0\0\0\0\0\x28\0\0\0\0\0\0\0\
-\x38\0\0\0\0\0\0\0\x40\0\0\0\0\0\0\0\x68\0\0\0\0\0\0\0\xc8\x03\0\0\0\0\0\0\xd8\
-\x03\0\0\0\0\0\0\xa0\x0e\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xc8\0\0\0\
-\0\0\0\0\x80\x01\0\0\0\0\0\0\x10\x0b\0\0\0\0\0\0\xa0\x0e\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\xb0\x04\0\0\0\0\0\0\x60\x07\0\0\0\0\0\
-\0\x78\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xc0\x02\0\0\0\0\0\0\x68\
-\x03\0\0\0\0\0\0\xb0\x04\0\0\0\0\0\0\x60\x07\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\xb0\x01\0\0\0\0\0\0\xb0\x01\0\0\0\0\0\0\x58\x07\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\x88\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xa0\x0e\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x55\x62\x75\x6e\x74\x75\x20\x63\x6c\x61\x6e\
-\x67\x20\x76\x65\x72\x73\x69\x6f\x6e\x20\x31\x32\x2e\x30\x2e\x30\x2d\x33\x75\
-\x62\x75\x6e\x74\x75\x31\x7e\x32\x30\x2e\x30\x34\x2e\x35\0\x62\x70\x66\x2d\x68\
-\x72\x74\x2e\x63\0\x2f\x74\x6d\x70\x2f\x77\x75\x6c\x74\x2d\x79\x6b\x6f\x34\x36\
-\x32\x38\x6c\x2f\x77\x75\x6c\x74\x72\x75\x6e\x6e\x65\x72\0\x6c\x69\x6e\x75\x78\
-\x5f\x76\x65\x72\x73\x69\x6f\x6e\x5f\x63\x6f\x64\x65\0\x75\x6e\x73\x69\x67\x6e\
-\x65\x64\x20\x69\x6e\x74\0\x5f\x5f\x75\x33\x32\0\x75\x33\x32\0\x75\x69\x6e\x74\
-\x33\x32\x5f\x74\0\x5f\x6c\x69\x63\x65\x6e\x73\x65\0\x63\x68\x61\x72\0\x5f\x5f\
-\x41\x52\x52\x41\x59\x5f\x53\x49\x5a\x45\x5f\x54\x59\x50\x45\x5f\x5f\0\x65\x76\
-\x65\x6e\x74\x73\0\x74\x79\x70\x65\0\x69\x6e\x74\0\x6d\x61\x78\x5f\x65\x6e\x74\
-\x72\x69\x65\x73\0\x70\x65\x72\x66\0\x6b\x65\x79\x5f\x73\x69\x7a\x65\0\x76\x61\
-\x6c\x75\x65\x5f\x73\x69\x7a\x65\0\x74\x69\x6d\x65\x72\x73\0\x6b\x65\x79\0\x76\
-\x61\x6c\x75\x65\0\x74\0\x62\x70\x66\x5f\x74\x69\x6d\x65\x72\0\x74\x69\x6d\x65\
-\x72\x5f\x65\x6c\x65\x6d\0\x6d\x69\x6e\x5f\x74\0\x6d\x61\x78\x5f\x74\0\x64\x61\
-\x74\x61\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x63\x68\x61\x72\0\x5f\x5f\x75\
-\x38\0\x75\x38\0\x6c\x64\x69\x73\x74\0\x6c\x74\x69\x6d\x65\0\x6c\x6f\x6e\x67\
-\x20\x6c\x6f\x6e\x67\x20\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x69\x6e\x74\0\x5f\
-\x5f\x75\x36\x34\0\x75\x36\x34\0\x75\x69\x6e\x74\x36\x34\x5f\x74\0\x74\x62\x69\
-\0\x74\x61\x69\0\x74\x69\x6e\x74\x72\0\x62\x69\x63\0\x61\x69\x63\0\x61\x69\x74\
-\x73\x31\0\x61\x69\x74\x73\x32\0\x69\x6e\x74\x72\x74\x73\x31\0\x69\x6e\x74\x72\
-\x74\x73\x32\0\x72\x65\x71\x5f\x63\x73\x74\x61\x74\x65\0\x70\x65\x72\x66\x5f\
-\x63\x6f\x75\x6e\x74\x65\x72\x73\0\x62\x70\x66\x5f\x65\x76\x65\x6e\x74\0\x74\
-\x69\x6d\x65\x72\x5f\x61\x72\x6d\x65\x64\0\x5f\x42\x6f\x6f\x6c\0\x62\x6f\x6f\
-\x6c\0\x63\x70\x75\x5f\x6e\x75\x6d\0\x62\x70\x66\x5f\x67\x65\x74\x5f\x73\x6d\
-\x70\x5f\x70\x72\x6f\x63\x65\x73\x73\x6f\x72\x5f\x69\x64\0\x62\x70\x66\x5f\x6d\
-\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\x65\x6d\0\x62\x70\x66\x5f\x67\
-\x65\x74\x5f\x70\x72\x61\x6e\x64\x6f\x6d\x5f\x75\x33\x32\0\x62\x70\x66\x5f\x6b\
-\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x62\x6f\x6f\x74\x5f\x6e\x73\0\x62\x70\x66\
-\x5f\x74\x69\x6d\x65\x72\x5f\x73\x74\x61\x72\x74\0\x6c\x6f\x6e\x67\x20\x69\x6e\
-\x74\0\x62\x70\x66\x5f\x74\x69\x6d\x65\x72\x5f\x69\x6e\x69\x74\0\x62\x70\x66\
-\x5f\x74\x69\x6d\x65\x72\x5f\x73\x65\x74\x5f\x63\x61\x6c\x6c\x62\x61\x63\x6b\0\
-\x5f\x5f\x5f\x5f\x66\x6d\x74\0\x62\x70\x66\x5f\x72\x69\x6e\x67\x62\x75\x66\x5f\
-\x72\x65\x73\x65\x72\x76\x65\0\x62\x70\x66\x5f\x74\x72\x61\x63\x65\x5f\x70\x72\
-\x69\x6e\x74\x6b\0\x62\x70\x66\x5f\x72\x69\x6e\x67\x62\x75\x66\x5f\x73\x75\x62\
-\x6d\x69\x74\0\x62\x70\x66\x5f\x70\x65\x72\x66\x5f\x65\x76\x65\x6e\x74\x5f\x72\
-\x65\x61\x64\0\x66\x61\x6c\x73\x65\0\x74\x72\x75\x65\0\x48\x52\x54\x5f\x45\x56\
-\x45\x4e\x54\x5f\x44\x41\x54\x41\0\x48\x52\x54\x5f\x45\x56\x45\x4e\x54\x5f\x50\
-\x49\x4e\x47\0\x4d\x53\x52\x5f\x54\x53\x43\0\x4d\x53\x52\x5f\x4d\x50\x45\x52\
-\x46\0\x4d\x53\x52\x5f\x53\x4d\x49\0\x4d\x53\x52\x5f\x45\x56\x45\x4e\x54\x5f\
-\x43\x4f\x55\x4e\x54\0\x6c\x6f\x6e\x67\x20\x6c\x6f\x6e\x67\x20\x69\x6e\x74\0\
-\x5f\x5f\x73\x36\x34\0\x73\x36\x34\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x6b\x69\
-\x63\x6b\x5f\x74\x69\x6d\x65\x72\0\x63\x70\x75\x5f\x69\x64\0\x74\x69\x6d\x65\
-\x72\0\x72\x65\x74\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x70\x69\x6e\x67\x5f\x63\
-\x70\x75\0\x65\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x73\x65\x6e\x64\x5f\x65\x76\
-\x65\x6e\x74\0\x69\0\x5f\x5f\x5f\x5f\x62\x70\x66\x5f\x68\x72\x74\x5f\x63\x70\
-\x75\x5f\x69\x64\x6c\x65\0\x63\x74\x78\0\x63\x73\x74\x61\x74\x65\0\x69\x64\x78\
-\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x73\x6e\x61\x70\x73\x68\x6f\x74\x5f\x70\x65\
-\x72\x66\x5f\x76\x61\x72\x73\0\x65\x78\x69\x74\0\x65\x72\x72\0\x63\x6f\x75\x6e\
-\x74\0\x70\x74\x72\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x72\x65\x61\x64\x5f\x74\
-\x73\x63\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x73\x74\x61\x72\x74\x5f\x74\x69\x6d\
-\x65\x72\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x74\x69\x6d\x65\x72\x5f\x63\x62\0\
-\x62\x70\x66\x5f\x68\x72\x74\x5f\x63\x70\x75\x5f\x69\x64\x6c\x65\0\x61\x72\x67\
-\x73\0\x62\x70\x66\x5f\x61\x72\x67\x73\0\x6d\x61\x70\0\x9f\xeb\x01\0\x18\0\0\0\
-\0\0\0\0\xcc\x06\0\0\xcc\x06\0\0\x9c\x0a\0\0\0\0\0\0\0\0\0\x02\x03\0\0\0\x01\0\
-\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\x01\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\
-\0\0\x02\0\0\0\x05\0\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\0\0\0\0\0\0\0\0\x02\x06\0\
-\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x02\
-\x02\0\0\0\0\0\0\0\0\0\0\x02\x09\0\0\0\x19\0\0\0\x01\0\0\x04\x10\0\0\0\x24\0\0\
-\0\x0a\0\0\0\0\0\0\0\x26\0\0\0\0\0\0\x04\x10\0\0\0\0\0\0\0\x04\0\0\x04\x20\0\0\
-\0\x30\0\0\0\x01\0\0\0\0\0\0\0\x35\0\0\0\x05\0\0\0\x40\0\0\0\x41\0\0\0\x07\0\0\
-\0\x80\0\0\0\x45\0\0\0\x08\0\0\0\xc0\0\0\0\x4b\0\0\0\0\0\0\x0e\x0b\0\0\0\x01\0\
-\0\0\0\0\0\0\0\0\0\x02\x0e\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\
-\x1b\0\0\0\0\0\0\0\0\0\0\x02\x10\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\
-\0\0\0\0\x10\0\0\0\0\0\0\x02\0\0\x04\x10\0\0\0\x30\0\0\0\x0d\0\0\0\0\0\0\0\x35\
-\0\0\0\x0f\0\0\0\x40\0\0\0\x52\0\0\0\0\0\0\x0e\x11\0\0\0\x01\0\0\0\0\0\0\0\0\0\
-\0\x02\x14\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\x04\0\0\0\0\0\0\
-\0\0\0\0\x02\x16\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\x10\0\0\0\
-\0\0\0\0\x04\0\0\x04\x20\0\0\0\x30\0\0\0\x13\0\0\0\0\0\0\0\x59\0\0\0\x13\0\0\0\
-\x40\0\0\0\x62\0\0\0\x13\0\0\0\x80\0\0\0\x35\0\0\0\x15\0\0\0\xc0\0\0\0\x6d\0\0\
-\0\0\0\0\x0e\x17\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x0d\x02\0\0\0\x72\0\0\0\x01\0\0\
-\x0c\x19\0\0\0\0\0\0\0\0\0\0\x02\x1c\0\0\0\x1e\x02\0\0\x02\0\0\x04\x08\0\0\0\
-\x27\x02\0\0\x1d\0\0\0\0\0\0\0\x2d\x02\0\0\x1d\0\0\0\x20\0\0\0\x33\x02\0\0\0\0\
-\0\x08\x1e\0\0\0\x37\x02\0\0\0\0\0\x08\x1f\0\0\0\x33\x02\0\0\0\0\0\x08\x20\0\0\
-\0\x40\x02\0\0\0\0\0\x08\x21\0\0\0\x46\x02\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\0\0\
-\0\0\0\x01\0\0\x0d\x02\0\0\0\x53\x02\0\0\x1b\0\0\0\x58\x02\0\0\x01\0\0\x0c\x22\
-\0\0\0\0\0\0\0\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\x02\x0a\0\0\0\0\0\0\0\x03\0\0\
-\x0d\x02\0\0\0\x33\x03\0\0\x24\0\0\0\x41\0\0\0\x07\0\0\0\x37\x03\0\0\x25\0\0\0\
-\x3d\x03\0\0\0\0\0\x0c\x26\0\0\0\0\0\0\0\0\0\0\x02\x29\0\0\0\xcd\x05\0\0\0\0\0\
-\x01\x08\0\0\0\x40\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\xe4\x05\0\0\x28\0\0\0\
-\xe8\x05\0\0\x01\0\0\x0c\x2a\0\0\0\0\0\0\0\0\0\0\x0a\x1d\0\0\0\x65\x09\0\0\0\0\
-\0\x0e\x2c\0\0\0\x01\0\0\0\x78\x09\0\0\x0e\0\0\x04\xe0\0\0\0\x30\0\0\0\x2f\0\0\
-\0\0\0\0\0\x82\x09\0\0\x1d\0\0\0\x20\0\0\0\x88\x09\0\0\x32\0\0\0\x40\0\0\0\x8e\
-\x09\0\0\x32\0\0\0\x80\0\0\0\x92\x09\0\0\x32\0\0\0\xc0\0\0\0\x96\x09\0\0\x32\0\
-\0\0\0\x01\0\0\x9c\x09\0\0\x32\0\0\0\x40\x01\0\0\xa0\x09\0\0\x32\0\0\0\x80\x01\
-\0\0\xa4\x09\0\0\x32\0\0\0\xc0\x01\0\0\xaa\x09\0\0\x32\0\0\0\0\x02\0\0\xb0\x09\
-\0\0\x32\0\0\0\x40\x02\0\0\xb8\x09\0\0\x32\0\0\0\x80\x02\0\0\xc0\x09\0\0\x02\0\
-\0\0\xc0\x02\0\0\xcb\x09\0\0\x36\0\0\0\0\x03\0\0\xd9\x09\0\0\0\0\0\x08\x30\0\0\
-\0\xdc\x09\0\0\0\0\0\x08\x31\0\0\0\xe1\x09\0\0\0\0\0\x01\x01\0\0\0\x08\0\0\0\
-\xef\x09\0\0\0\0\0\x08\x33\0\0\0\xf3\x09\0\0\0\0\0\x08\x34\0\0\0\xef\x09\0\0\0\
-\0\0\x08\x35\0\0\0\xfc\x09\0\0\0\0\0\x08\x29\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\
-\x32\0\0\0\x04\0\0\0\x10\0\0\0\x02\x0a\0\0\0\0\0\x0e\x2e\0\0\0\0\0\0\0\x07\x0a\
-\0\0\0\0\0\x08\x39\0\0\0\x0c\x0a\0\0\0\0\0\x01\x01\0\0\0\x08\0\0\x04\x12\x0a\0\
-\0\0\0\0\x0e\x38\0\0\0\0\0\0\0\x82\x09\0\0\0\0\0\x0e\x1d\0\0\0\0\0\0\0\x2d\x02\
-\0\0\0\0\0\x0e\x02\0\0\0\0\0\0\0\x27\x02\0\0\0\0\0\x0e\x02\0\0\0\0\0\0\0\x88\
-\x09\0\0\0\0\0\x0e\x32\0\0\0\0\0\0\0\x1e\x0a\0\0\0\0\0\x01\x01\0\0\0\x08\0\0\
-\x01\0\0\0\0\0\0\0\x03\0\0\0\0\x3f\0\0\0\x04\0\0\0\x04\0\0\0\x23\x0a\0\0\0\0\0\
-\x0e\x40\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x0a\x43\0\0\0\0\0\0\0\0\0\0\x09\x1d\0\0\
-\0\x2c\x0a\0\0\0\0\0\x0e\x42\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x0a\x3f\0\0\0\0\0\0\
-\0\0\0\0\x03\0\0\0\0\x45\0\0\0\x04\0\0\0\x2e\0\0\0\x34\x0a\0\0\0\0\0\x0e\x46\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x45\0\0\0\x04\0\0\0\x2f\0\0\0\x4d\x0a\0\
-\0\0\0\0\x0e\x48\0\0\0\0\0\0\0\xcb\x09\0\0\0\0\0\x0e\x36\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x03\0\0\0\0\x45\0\0\0\x04\0\0\0\x20\0\0\0\x68\x0a\0\0\0\0\0\x0e\x4b\0\0\
-\0\0\0\0\0\x81\x0a\0\0\x07\0\0\x0f\0\0\0\0\x37\0\0\0\0\0\0\0\xe0\0\0\0\x3a\0\0\
-\0\xe0\0\0\0\x01\0\0\0\x3b\0\0\0\xe4\0\0\0\x04\0\0\0\x3c\0\0\0\xe8\0\0\0\x04\0\
-\0\0\x3d\0\0\0\xec\0\0\0\x04\0\0\0\x3e\0\0\0\xf0\0\0\0\x08\0\0\0\x4a\0\0\0\xf8\
-\0\0\0\x80\0\0\0\x86\x0a\0\0\x03\0\0\x0f\0\0\0\0\x0c\0\0\0\0\0\0\0\x20\0\0\0\
-\x12\0\0\0\0\0\0\0\x10\0\0\0\x18\0\0\0\0\0\0\0\x20\0\0\0\x8c\x0a\0\0\x05\0\0\
-\x0f\0\0\0\0\x2d\0\0\0\0\0\0\0\x04\0\0\0\x44\0\0\0\0\0\0\0\x04\0\0\0\x47\0\0\0\
-\x08\0\0\0\x2e\0\0\0\x49\0\0\0\x36\0\0\0\x2f\0\0\0\x4c\0\0\0\x65\0\0\0\x20\0\0\
-\0\x94\x0a\0\0\x01\0\0\x0f\0\0\0\0\x41\0\0\0\0\0\0\0\x04\0\0\0\0\x69\x6e\x74\0\
-\x5f\x5f\x41\x52\x52\x41\x59\x5f\x53\x49\x5a\x45\x5f\x54\x59\x50\x45\x5f\x5f\0\
-\x74\x69\x6d\x65\x72\x5f\x65\x6c\x65\x6d\0\x74\0\x62\x70\x66\x5f\x74\x69\x6d\
-\x65\x72\0\x74\x79\x70\x65\0\x6d\x61\x78\x5f\x65\x6e\x74\x72\x69\x65\x73\0\x6b\
-\x65\x79\0\x76\x61\x6c\x75\x65\0\x74\x69\x6d\x65\x72\x73\0\x65\x76\x65\x6e\x74\
-\x73\0\x6b\x65\x79\x5f\x73\x69\x7a\x65\0\x76\x61\x6c\x75\x65\x5f\x73\x69\x7a\
-\x65\0\x70\x65\x72\x66\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x6b\x69\x63\x6b\x5f\
-\x74\x69\x6d\x65\x72\0\x2e\x74\x65\x78\x74\0\x2f\x74\x6d\x70\x2f\x77\x75\x6c\
-\x74\x2d\x79\x6b\x6f\x34\x36\x32\x38\x6c\x2f\x77\x75\x6c\x74\x72\x75\x6e\x6e\
-\x65\x72\x2f\x62\x70\x66\x2d\x68\x72\x74\x2e\x63\0\x69\x6e\x74\x20\x62\x70\x66\
-\x5f\x68\x72\x74\x5f\x6b\x69\x63\x6b\x5f\x74\x69\x6d\x65\x72\x28\x76\x6f\x69\
-\x64\x29\0\x09\x69\x6e\x74\x20\x6b\x65\x79\x20\x3d\x20\x30\x3b\0\x09\x69\x6e\
-\x74\x20\x63\x70\x75\x5f\x69\x64\x20\x3d\x20\x62\x70\x66\x5f\x67\x65\x74\x5f\
-\x73\x6d\x70\x5f\x70\x72\x6f\x63\x65\x73\x73\x6f\x72\x5f\x69\x64\x28\x29\x3b\0\
-\x09\x69\x66\x20\x28\x64\x61\x74\x61\x2e\x74\x62\x69\x20\x7c\x7c\x20\x74\x69\
-\x6d\x65\x72\x5f\x61\x72\x6d\x65\x64\x29\0\x09\x74\x69\x6d\x65\x72\x20\x3d\x20\
-\x62\x70\x66\x5f\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\x65\x6d\
-\x28\x26\x74\x69\x6d\x65\x72\x73\x2c\x20\x26\x6b\x65\x79\x29\x3b\0\x09\x69\x66\
-\x20\x28\x21\x74\x69\x6d\x65\x72\x29\0\x09\x6c\x64\x69\x73\x74\x20\x3d\x20\x62\
-\x70\x66\x5f\x67\x65\x74\x5f\x70\x72\x61\x6e\x64\x6f\x6d\x5f\x75\x33\x32\x28\
-\x29\x3b\0\x09\x6c\x64\x69\x73\x74\x20\x3d\x20\x6c\x64\x69\x73\x74\x20\x25\x20\
-\x28\x6d\x61\x78\x5f\x74\x20\x2d\x20\x6d\x69\x6e\x5f\x74\x29\x3b\0\x09\x6c\x64\
-\x69\x73\x74\x20\x3d\x20\x6c\x64\x69\x73\x74\x20\x2b\x20\x6d\x69\x6e\x5f\x74\
-\x3b\0\x09\x6c\x74\x69\x6d\x65\x20\x3d\x20\x62\x70\x66\x5f\x6b\x74\x69\x6d\x65\
-\x5f\x67\x65\x74\x5f\x62\x6f\x6f\x74\x5f\x6e\x73\x28\x29\x20\x2b\x20\x6c\x64\
-\x69\x73\x74\x3b\0\x09\x62\x70\x66\x5f\x74\x69\x6d\x65\x72\x5f\x73\x74\x61\x72\
-\x74\x28\x74\x69\x6d\x65\x72\x2c\x20\x6c\x64\x69\x73\x74\x2c\x20\x30\x29\x3b\0\
-\x09\x74\x69\x6d\x65\x72\x5f\x61\x72\x6d\x65\x64\x20\x3d\x20\x74\x72\x75\x65\
-\x3b\0\x7d\0\x62\x70\x66\x5f\x61\x72\x67\x73\0\x6d\x69\x6e\x5f\x74\0\x6d\x61\
-\x78\x5f\x74\0\x75\x33\x32\0\x75\x69\x6e\x74\x33\x32\x5f\x74\0\x5f\x5f\x75\x33\
-\x32\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x69\x6e\x74\0\x61\x72\x67\x73\0\x62\
-\x70\x66\x5f\x68\x72\x74\x5f\x73\x74\x61\x72\x74\x5f\x74\x69\x6d\x65\x72\0\x73\
-\x79\x73\x63\x61\x6c\x6c\0\x69\x6e\x74\x20\x62\x70\x66\x5f\x68\x72\x74\x5f\x73\
-\x74\x61\x72\x74\x5f\x74\x69\x6d\x65\x72\x28\x73\x74\x72\x75\x63\x74\x20\x62\
-\x70\x66\x5f\x61\x72\x67\x73\x20\x2a\x61\x72\x67\x73\x29\0\x09\x6d\x69\x6e\x5f\
-\x74\x20\x3d\x20\x61\x72\x67\x73\x2d\x3e\x6d\x69\x6e\x5f\x74\x3b\0\x09\x6d\x61\
-\x78\x5f\x74\x20\x3d\x20\x61\x72\x67\x73\x2d\x3e\x6d\x61\x78\x5f\x74\x3b\0\x09\
-\x62\x70\x66\x5f\x74\x69\x6d\x65\x72\x5f\x69\x6e\x69\x74\x28\x74\x69\x6d\x65\
-\x72\x2c\x20\x26\x74\x69\x6d\x65\x72\x73\x2c\x20\x43\x4c\x4f\x43\x4b\x5f\x4d\
-\x4f\x4e\x4f\x54\x4f\x4e\x49\x43\x29\x3b\0\x09\x62\x70\x66\x5f\x74\x69\x6d\x65\
-\x72\x5f\x73\x65\x74\x5f\x63\x61\x6c\x6c\x62\x61\x63\x6b\x28\x74\x69\x6d\x65\
-\x72\x2c\x20\x62\x70\x66\x5f\x68\x72\x74\x5f\x74\x69\x6d\x65\x72\x5f\x63\x62\
-\x29\x3b\0\x6d\x61\x70\0\x74\x69\x6d\x65\x72\0\x62\x70\x66\x5f\x68\x72\x74\x5f\
-\x74\x69\x6d\x65\x72\x5f\x63\x62\0\x09\x74\x69\x6d\x65\x72\x5f\x61\x72\x6d\x65\
-\x64\x20\x3d\x20\x66\x61\x6c\x73\x65\x3b\0\x09\x69\x66\x20\x28\x64\x61\x74\x61\
-\x2e\x74\x62\x69\x29\x20\x7b\0\x09\x09\x64\x61\x74\x61\x2e\x74\x69\x6e\x74\x72\
-\x20\x3d\x20\x62\x70\x66\x5f\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x62\x6f\
-\x6f\x74\x5f\x6e\x73\x28\x29\x3b\0\x09\x09\x64\x61\x74\x61\x2e\x69\x6e\x74\x72\
-\x74\x73\x32\x20\x3d\x20\x64\x61\x74\x61\x2e\x74\x69\x6e\x74\x72\x3b\0\x09\x09\
-\x64\x61\x74\x61\x2e\x69\x6e\x74\x72\x74\x73\x31\x20\x3d\x20\x64\x61\x74\x61\
-\x2e\x74\x69\x6e\x74\x72\x3b\0\x09\x09\x64\x61\x74\x61\x2e\x6c\x64\x69\x73\x74\
-\x20\x3d\x20\x6c\x64\x69\x73\x74\x3b\0\x09\x09\x64\x61\x74\x61\x2e\x6c\x74\x69\
-\x6d\x65\x20\x3d\x20\x6c\x74\x69\x6d\x65\x3b\0\x09\x09\x69\x66\x20\x28\x21\x64\
-\x61\x74\x61\x2e\x74\x61\x69\x29\0\x09\x65\x20\x3d\x20\x62\x70\x66\x5f\x72\x69\
-\x6e\x67\x62\x75\x66\x5f\x72\x65\x73\x65\x72\x76\x65\x28\x26\x65\x76\x65\x6e\
-\x74\x73\x2c\x20\x31\x2c\x20\x30\x29\x3b\0\x09\x69\x66\x20\x28\x21\x65\x29\x20\
-\x7b\0\x09\x09\x77\x61\x72\x6e\x5f\x70\x72\x69\x6e\x74\x6b\x28\x22\x72\x69\x6e\
-\x67\x62\x75\x66\x20\x6f\x76\x65\x72\x66\x6c\x6f\x77\x2c\x20\x70\x69\x6e\x67\
-\x20\x64\x69\x73\x63\x61\x72\x64\x65\x64\x22\x29\x3b\0\x09\x65\x2d\x3e\x74\x79\
-\x70\x65\x20\x3d\x20\x48\x52\x54\x5f\x45\x56\x45\x4e\x54\x5f\x50\x49\x4e\x47\
-\x3b\0\x09\x62\x70\x66\x5f\x72\x69\x6e\x67\x62\x75\x66\x5f\x73\x75\x62\x6d\x69\
-\x74\x28\x65\x2c\x20\x30\x29\x3b\0\x09\x69\x66\x20\x28\x21\x64\x61\x74\x61\x2e\
-\x74\x61\x69\x20\x7c\x7c\x20\x21\x64\x61\x74\x61\x2e\x74\x69\x6e\x74\x72\x20\
-\x7c\x7c\x20\x21\x64\x61\x74\x61\x2e\x74\x62\x69\x20\x7c\x7c\0\x09\x65\x20\x3d\
-\x20\x62\x70\x66\x5f\x72\x69\x6e\x67\x62\x75\x66\x5f\x72\x65\x73\x65\x72\x76\
-\x65\x28\x26\x65\x76\x65\x6e\x74\x73\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x2a\
-\x65\x29\x2c\x20\x30\x29\x3b\0\x09\x09\x77\x61\x72\x6e\x5f\x70\x72\x69\x6e\x74\
-\x6b\x28\x22\x72\x69\x6e\x67\x62\x75\x66\x20\x6f\x76\x65\x72\x66\x6c\x6f\x77\
-\x2c\x20\x65\x76\x65\x6e\x74\x20\x64\x69\x73\x63\x61\x72\x64\x65\x64\x22\x29\
-\x3b\0\x09\x5f\x5f\x62\x75\x69\x6c\x74\x69\x6e\x5f\x6d\x65\x6d\x63\x70\x79\x28\
-\x65\x2c\x20\x26\x64\x61\x74\x61\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x2a\x65\
-\x29\x29\x3b\0\x09\x65\x2d\x3e\x74\x79\x70\x65\x20\x3d\x20\x48\x52\x54\x5f\x45\
-\x56\x45\x4e\x54\x5f\x44\x41\x54\x41\x3b\0\x09\x09\x65\x2d\x3e\x70\x65\x72\x66\
-\x5f\x63\x6f\x75\x6e\x74\x65\x72\x73\x5b\x69\x5d\x20\x3d\x20\x70\x65\x72\x66\
-\x5f\x63\x6f\x75\x6e\x74\x65\x72\x73\x5b\x69\x5d\x3b\0\x09\x64\x61\x74\x61\x2e\
-\x74\x61\x69\x20\x3d\x20\x30\x3b\0\x09\x72\x65\x74\x75\x72\x6e\x20\x30\x3b\0\
-\x6c\x6f\x6e\x67\x20\x6c\x6f\x6e\x67\x20\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\
-\x69\x6e\x74\0\x63\x74\x78\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x63\x70\x75\x5f\
-\x69\x64\x6c\x65\0\x74\x70\x5f\x62\x74\x66\x2f\x63\x70\x75\x5f\x69\x64\x6c\x65\
-\0\x69\x6e\x74\x20\x42\x50\x46\x5f\x50\x52\x4f\x47\x28\x62\x70\x66\x5f\x68\x72\
-\x74\x5f\x63\x70\x75\x5f\x69\x64\x6c\x65\x2c\x20\x75\x6e\x73\x69\x67\x6e\x65\
-\x64\x20\x69\x6e\x74\x20\x63\x73\x74\x61\x74\x65\x2c\x20\x75\x6e\x73\x69\x67\
-\x6e\x65\x64\x20\x69\x6e\x74\x20\x63\x70\x75\x5f\x69\x64\x29\0\x09\x69\x66\x20\
-\x28\x63\x70\x75\x5f\x69\x64\x20\x21\x3d\x20\x63\x70\x75\x5f\x6e\x75\x6d\x29\0\
-\x09\x69\x66\x20\x28\x63\x73\x74\x61\x74\x65\x20\x3d\x3d\x20\x50\x57\x52\x5f\
-\x45\x56\x45\x4e\x54\x5f\x45\x58\x49\x54\x29\x20\x7b\0\x09\x09\x74\x20\x3d\x20\
-\x62\x70\x66\x5f\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x62\x6f\x6f\x74\x5f\
-\x6e\x73\x28\x29\x3b\0\x09\x09\x69\x66\x20\x28\x64\x61\x74\x61\x2e\x74\x69\x6e\
-\x74\x72\x20\x7c\x7c\x20\x74\x20\x3e\x3d\x20\x6c\x74\x69\x6d\x65\x29\x20\x7b\0\
-\x09\x09\x09\x64\x61\x74\x61\x2e\x61\x69\x74\x73\x31\x20\x3d\x20\x64\x61\x74\
-\x61\x2e\x74\x61\x69\x3b\0\x09\x09\x09\x64\x61\x74\x61\x2e\x74\x61\x69\x20\x3d\
-\x20\x74\x3b\0\x09\x09\x09\x62\x70\x66\x5f\x70\x65\x72\x66\x5f\x65\x76\x65\x6e\
-\x74\x5f\x72\x65\x61\x64\x28\x26\x70\x65\x72\x66\x2c\x20\x4d\x53\x52\x5f\x4d\
-\x50\x45\x52\x46\x29\x20\x2d\0\x09\x09\x09\x70\x65\x72\x66\x5f\x63\x6f\x75\x6e\
-\x74\x65\x72\x73\x5b\x4d\x53\x52\x5f\x4d\x50\x45\x52\x46\x5d\x3b\0\x09\x09\x70\
-\x65\x72\x66\x5f\x63\x6f\x75\x6e\x74\x65\x72\x73\x5b\x4d\x53\x52\x5f\x4d\x50\
-\x45\x52\x46\x5d\x20\x3d\0\x09\x09\x63\x6f\x75\x6e\x74\x20\x3d\x20\x62\x70\x66\
-\x5f\x70\x65\x72\x66\x5f\x65\x76\x65\x6e\x74\x5f\x72\x65\x61\x64\x28\x26\x70\
-\x65\x72\x66\x2c\x20\x69\x29\x3b\0\x09\x09\x69\x66\x20\x28\x65\x72\x72\x20\x3c\
-\x20\x30\x20\x26\x26\x20\x65\x72\x72\x20\x3e\x3d\x20\x2d\x32\x32\x29\0\x09\x09\
-\x09\x70\x65\x72\x66\x5f\x63\x6f\x75\x6e\x74\x65\x72\x73\x5b\x69\x5d\x20\x3d\
-\x20\x63\x6f\x75\x6e\x74\x20\x2d\x20\x70\x65\x72\x66\x5f\x63\x6f\x75\x6e\x74\
-\x65\x72\x73\x5b\x69\x5d\x3b\0\x09\x63\x6f\x75\x6e\x74\x20\x3d\x20\x62\x70\x66\
-\x5f\x70\x65\x72\x66\x5f\x65\x76\x65\x6e\x74\x5f\x72\x65\x61\x64\x28\x26\x70\
-\x65\x72\x66\x2c\x20\x4d\x53\x52\x5f\x54\x53\x43\x29\x3b\0\x09\x69\x66\x20\x28\
-\x65\x72\x72\x20\x3e\x3d\x20\x2d\x35\x31\x32\x20\x26\x26\x20\x65\x72\x72\x20\
-\x3c\x20\x30\x29\x20\x7b\0\x09\x09\x77\x61\x72\x6e\x5f\x70\x72\x69\x6e\x74\x6b\
-\x28\x22\x54\x53\x43\x20\x72\x65\x61\x64\x20\x65\x72\x72\x6f\x72\x3a\x20\x25\
-\x64\x22\x2c\x20\x65\x72\x72\x29\x3b\0\x09\x09\x09\x64\x61\x74\x61\x2e\x61\x69\
-\x63\x20\x3d\x20\x62\x70\x66\x5f\x68\x72\x74\x5f\x72\x65\x61\x64\x5f\x74\x73\
-\x63\x28\x29\x3b\0\x09\x09\x09\x64\x61\x74\x61\x2e\x61\x69\x74\x73\x32\x20\x3d\
-\x20\x62\x70\x66\x5f\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x62\x6f\x6f\x74\
-\x5f\x6e\x73\x28\x29\x3b\0\x09\x09\x7d\x20\x65\x6c\x73\x65\x20\x7b\0\x09\x09\
-\x64\x61\x74\x61\x2e\x72\x65\x71\x5f\x63\x73\x74\x61\x74\x65\x20\x3d\x20\x63\
-\x73\x74\x61\x74\x65\x3b\0\x09\x09\x64\x61\x74\x61\x2e\x62\x69\x63\x20\x3d\x20\
-\x62\x70\x66\x5f\x68\x72\x74\x5f\x72\x65\x61\x64\x5f\x74\x73\x63\x28\x29\x3b\0\
-\x09\x09\x09\x62\x70\x66\x5f\x70\x65\x72\x66\x5f\x65\x76\x65\x6e\x74\x5f\x72\
-\x65\x61\x64\x28\x26\x70\x65\x72\x66\x2c\x20\x4d\x53\x52\x5f\x4d\x50\x45\x52\
-\x46\x29\x3b\0\x09\x09\x64\x61\x74\x61\x2e\x74\x62\x69\x20\x3d\x20\x62\x70\x66\
-\x5f\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x62\x6f\x6f\x74\x5f\x6e\x73\x28\
-\x29\x3b\0\x09\x09\x69\x66\x20\x28\x64\x61\x74\x61\x2e\x74\x62\x69\x20\x3e\x20\
-\x6c\x74\x69\x6d\x65\x29\0\x09\x09\x64\x61\x74\x61\x2e\x74\x61\x69\x20\x3d\x20\
-\x30\x3b\0\x09\x09\x09\x64\x61\x74\x61\x2e\x74\x62\x69\x20\x3d\x20\x30\x3b\0\
-\x6c\x69\x6e\x75\x78\x5f\x76\x65\x72\x73\x69\x6f\x6e\x5f\x63\x6f\x64\x65\0\x62\
-\x70\x66\x5f\x65\x76\x65\x6e\x74\0\x6c\x64\x69\x73\x74\0\x6c\x74\x69\x6d\x65\0\
-\x74\x62\x69\0\x74\x61\x69\0\x74\x69\x6e\x74\x72\0\x62\x69\x63\0\x61\x69\x63\0\
-\x61\x69\x74\x73\x31\0\x61\x69\x74\x73\x32\0\x69\x6e\x74\x72\x74\x73\x31\0\x69\
-\x6e\x74\x72\x74\x73\x32\0\x72\x65\x71\x5f\x63\x73\x74\x61\x74\x65\0\x70\x65\
-\x72\x66\x5f\x63\x6f\x75\x6e\x74\x65\x72\x73\0\x75\x38\0\x5f\x5f\x75\x38\0\x75\
-\x6e\x73\x69\x67\x6e\x65\x64\x20\x63\x68\x61\x72\0\x75\x36\x34\0\x75\x69\x6e\
-\x74\x36\x34\x5f\x74\0\x5f\x5f\x75\x36\x34\0\x64\x61\x74\x61\0\x62\x6f\x6f\x6c\
-\0\x5f\x42\x6f\x6f\x6c\0\x74\x69\x6d\x65\x72\x5f\x61\x72\x6d\x65\x64\0\x63\x68\
-\x61\x72\0\x5f\x6c\x69\x63\x65\x6e\x73\x65\0\x63\x70\x75\x5f\x6e\x75\x6d\0\x62\
-\x70\x66\x5f\x68\x72\x74\x5f\x70\x69\x6e\x67\x5f\x63\x70\x75\x2e\x5f\x5f\x5f\
-\x5f\x66\x6d\x74\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x73\x65\x6e\x64\x5f\x65\x76\
-\x65\x6e\x74\x2e\x5f\x5f\x5f\x5f\x66\x6d\x74\0\x62\x70\x66\x5f\x68\x72\x74\x5f\
-\x72\x65\x61\x64\x5f\x74\x73\x63\x2e\x5f\x5f\x5f\x5f\x66\x6d\x74\0\x2e\x62\x73\
-\x73\0\x2e\x6d\x61\x70\x73\0\x2e\x72\x6f\x64\x61\x74\x61\0\x6c\x69\x63\x65\x6e\
-\x73\x65\0\x9f\xeb\x01\0\x20\0\0\0\0\0\0\0\x3c\0\0\0\x3c\0\0\0\xdc\x12\0\0\x18\
-\x13\0\0\0\0\0\0\x08\0\0\0\x85\0\0\0\x02\0\0\0\0\0\0\0\x1a\0\0\0\xb0\x01\0\0\
-\x27\0\0\0\x6c\x02\0\0\x01\0\0\0\0\0\0\0\x23\0\0\0\xf9\x05\0\0\x01\0\0\0\0\0\0\
-\0\x2b\0\0\0\x10\0\0\0\x85\0\0\0\x4f\0\0\0\0\0\0\0\x8b\0\0\0\xb3\0\0\0\0\x40\
-\x02\0\x08\0\0\0\x8b\0\0\0\xd0\0\0\0\x06\x48\x02\0\x10\0\0\0\x8b\0\0\0\xde\0\0\
-\0\x0f\x54\x02\0\x18\0\0\0\x8b\0\0\0\x08\x01\0\0\x0b\x5c\x02\0\x30\0\0\0\x8b\0\
-\0\0\x08\x01\0\0\x0f\x5c\x02\0\x38\0\0\0\x8b\0\0\0\x08\x01\0\0\x12\x5c\x02\0\
-\x50\0\0\0\x8b\0\0\0\x08\x01\0\0\x06\x5c\x02\0\x60\0\0\0\x8b\0\0\0\0\0\0\0\0\0\
-\0\0\x68\0\0\0\x8b\0\0\0\x26\x01\0\0\x0a\x68\x02\0\x88\0\0\0\x8b\0\0\0\x53\x01\
-\0\0\x06\x6c\x02\0\x90\0\0\0\x8b\0\0\0\x60\x01\0\0\x0a\x88\x02\0\x98\0\0\0\x8b\
-\0\0\0\x80\x01\0\0\x1b\x8c\x02\0\xb0\0\0\0\x8b\0\0\0\x80\x01\0\0\x13\x8c\x02\0\
-\xc8\0\0\0\x8b\0\0\0\x80\x01\0\0\x19\x8c\x02\0\xe8\0\0\0\x8b\0\0\0\x60\x01\0\0\
-\x0a\x88\x02\0\0\x01\0\0\x8b\0\0\0\x80\x01\0\0\x10\x8c\x02\0\x18\x01\0\0\x8b\0\
-\0\0\xa2\x01\0\0\x10\x90\x02\0\x20\x01\0\0\x8b\0\0\0\xa2\x01\0\0\x08\x90\x02\0\
-\x38\x01\0\0\x8b\0\0\0\xba\x01\0\0\x0a\xa0\x02\0\x40\x01\0\0\x8b\0\0\0\xba\x01\
-\0\0\x24\xa0\x02\0\x48\x01\0\0\x8b\0\0\0\xba\x01\0\0\x22\xa0\x02\0\x50\x01\0\0\
-\x8b\0\0\0\xba\x01\0\0\x08\xa0\x02\0\x68\x01\0\0\x8b\0\0\0\xe4\x01\0\0\x02\xa8\
-\x02\0\x80\x01\0\0\x8b\0\0\0\x07\x02\0\0\x0e\xb0\x02\0\xa0\x01\0\0\x8b\0\0\0\
-\x1c\x02\0\0\x01\xbc\x02\0\xb0\x01\0\0\x8b\0\0\0\xde\0\0\0\x0f\x4c\x03\0\xb8\
-\x01\0\0\x8b\0\0\0\x4e\x03\0\0\x0e\x5c\x03\0\xd8\x01\0\0\x8b\0\0\0\x64\x03\0\0\
-\x0b\x64\x03\0\xf0\x01\0\0\x8b\0\0\0\x64\x03\0\0\x06\x64\x03\0\xf8\x01\0\0\x8b\
-\0\0\0\x75\x03\0\0\x10\x68\x03\0\0\x02\0\0\x8b\0\0\0\x9d\x03\0\0\x10\x70\x03\0\
-\x08\x02\0\0\x8b\0\0\0\xba\x03\0\0\x10\x6c\x03\0\x10\x02\0\0\x8b\0\0\0\x75\x03\
-\0\0\x0e\x68\x03\0\x18\x02\0\0\x8b\0\0\0\xd7\x03\0\0\x10\x74\x03\0\x30\x02\0\0\
-\x8b\0\0\0\xd7\x03\0\0\x0e\x74\x03\0\x38\x02\0\0\x8b\0\0\0\xed\x03\0\0\x10\x78\
-\x03\0\x50\x02\0\0\x8b\0\0\0\xed\x03\0\0\x0e\x78\x03\0\x58\x02\0\0\x8b\0\0\0\
-\x03\x04\0\0\x0d\x7c\x03\0\x60\x02\0\0\x8b\0\0\0\x03\x04\0\0\x07\x7c\x03\0\x70\
-\x02\0\0\x8b\0\0\0\x14\x04\0\0\x06\x84\x01\0\x98\x02\0\0\x8b\0\0\0\x3d\x04\0\0\
-\x06\x88\x01\0\xa0\x02\0\0\x8b\0\0\0\x48\x04\0\0\x03\x8c\x01\0\xc8\x02\0\0\x8b\
-\0\0\0\x7b\x04\0\0\x0a\x9c\x01\0\xd0\x02\0\0\x8b\0\0\0\x96\x04\0\0\x02\xa4\x01\
-\0\xf8\x02\0\0\x8b\0\0\0\xb1\x04\0\0\x10\xc4\x01\0\0\x03\0\0\x8b\0\0\0\0\0\0\0\
-\0\0\0\0\x08\x03\0\0\x8b\0\0\0\xb1\x04\0\0\x10\xc4\x01\0\x38\x03\0\0\x8b\0\0\0\
-\xdf\x04\0\0\x06\xd4\x01\0\x60\x03\0\0\x8b\0\0\0\x3d\x04\0\0\x06\xd8\x01\0\x68\
-\x03\0\0\x8b\0\0\0\x11\x05\0\0\x03\xf4\x01\0\x90\x03\0\0\x8b\0\0\0\x45\x05\0\0\
-\x02\x04\x02\0\x70\x04\0\0\x8b\0\0\0\x6e\x05\0\0\x0a\x0c\x02\0\x78\x04\0\0\x8b\
-\0\0\0\x89\x05\0\0\x17\x1c\x02\0\x78\x05\0\0\x8b\0\0\0\x96\x04\0\0\x02\x24\x02\
-\0\x90\x05\0\0\x8b\0\0\0\xb3\x05\0\0\x0b\x30\x02\0\xb0\x05\0\0\x8b\0\0\0\xd0\0\
-\0\0\x06\x48\x02\0\xb8\x05\0\0\x8b\0\0\0\xde\0\0\0\x0f\x54\x02\0\xc0\x05\0\0\
-\x8b\0\0\0\x08\x01\0\0\x0b\x5c\x02\0\xd8\x05\0\0\x8b\0\0\0\x08\x01\0\0\x0f\x5c\
-\x02\0\xe0\x05\0\0\x8b\0\0\0\x08\x01\0\0\x12\x5c\x02\0\xf8\x05\0\0\x8b\0\0\0\
-\x08\x01\0\0\x06\x5c\x02\0\x08\x06\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x10\x06\0\0\
-\x8b\0\0\0\x26\x01\0\0\x0a\x68\x02\0\x30\x06\0\0\x8b\0\0\0\x53\x01\0\0\x06\x6c\
-\x02\0\x38\x06\0\0\x8b\0\0\0\x60\x01\0\0\x0a\x88\x02\0\x40\x06\0\0\x8b\0\0\0\
-\x80\x01\0\0\x1b\x8c\x02\0\x58\x06\0\0\x8b\0\0\0\x80\x01\0\0\x13\x8c\x02\0\x70\
-\x06\0\0\x8b\0\0\0\x80\x01\0\0\x19\x8c\x02\0\x90\x06\0\0\x8b\0\0\0\x60\x01\0\0\
-\x0a\x88\x02\0\xa8\x06\0\0\x8b\0\0\0\x80\x01\0\0\x10\x8c\x02\0\xc0\x06\0\0\x8b\
-\0\0\0\xa2\x01\0\0\x10\x90\x02\0\xc8\x06\0\0\x8b\0\0\0\xa2\x01\0\0\x08\x90\x02\
-\0\xe0\x06\0\0\x8b\0\0\0\xba\x01\0\0\x0a\xa0\x02\0\xe8\x06\0\0\x8b\0\0\0\xba\
-\x01\0\0\x24\xa0\x02\0\xf0\x06\0\0\x8b\0\0\0\xba\x01\0\0\x22\xa0\x02\0\xf8\x06\
-\0\0\x8b\0\0\0\xba\x01\0\0\x08\xa0\x02\0\x10\x07\0\0\x8b\0\0\0\xe4\x01\0\0\x02\
-\xa8\x02\0\x28\x07\0\0\x8b\0\0\0\x07\x02\0\0\x0e\xb0\x02\0\x48\x07\0\0\x8b\0\0\
-\0\xc2\x05\0\0\x02\x98\x03\0\x6c\x02\0\0\x23\0\0\0\0\0\0\0\x8b\0\0\0\x74\x02\0\
-\0\0\xa8\x03\0\x08\0\0\0\x8b\0\0\0\xd0\0\0\0\x06\xb0\x03\0\x10\0\0\0\x8b\0\0\0\
-\xa3\x02\0\0\x10\xbc\x03\0\x18\0\0\0\x8b\0\0\0\xa3\x02\0\0\x08\xbc\x03\0\x30\0\
-\0\0\x8b\0\0\0\xb9\x02\0\0\x10\xc0\x03\0\x38\0\0\0\x8b\0\0\0\xb9\x02\0\0\x08\
-\xc0\x03\0\x58\0\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x60\0\0\0\x8b\0\0\0\x26\x01\0\0\
-\x0a\xc8\x03\0\x90\0\0\0\x8b\0\0\0\x53\x01\0\0\x06\xcc\x03\0\x98\0\0\0\x8b\0\0\
-\0\xcf\x02\0\0\x02\xd8\x03\0\xc0\0\0\0\x8b\0\0\0\x01\x03\0\0\x02\xe0\x03\0\xe0\
-\0\0\0\x8b\0\0\0\xd0\0\0\0\x06\x48\x02\0\xe8\0\0\0\x8b\0\0\0\xde\0\0\0\x0f\x54\
-\x02\0\xf0\0\0\0\x8b\0\0\0\x08\x01\0\0\x0b\x5c\x02\0\x08\x01\0\0\x8b\0\0\0\x08\
-\x01\0\0\x0f\x5c\x02\0\x10\x01\0\0\x8b\0\0\0\x08\x01\0\0\x12\x5c\x02\0\x28\x01\
-\0\0\x8b\0\0\0\x08\x01\0\0\x06\x5c\x02\0\x38\x01\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\
-\x40\x01\0\0\x8b\0\0\0\x26\x01\0\0\x0a\x68\x02\0\x60\x01\0\0\x8b\0\0\0\x53\x01\
-\0\0\x06\x6c\x02\0\x68\x01\0\0\x8b\0\0\0\x60\x01\0\0\x0a\x88\x02\0\x70\x01\0\0\
-\x8b\0\0\0\x80\x01\0\0\x1b\x8c\x02\0\x88\x01\0\0\x8b\0\0\0\x80\x01\0\0\x13\x8c\
-\x02\0\xa0\x01\0\0\x8b\0\0\0\x80\x01\0\0\x19\x8c\x02\0\xc0\x01\0\0\x8b\0\0\0\
-\x60\x01\0\0\x0a\x88\x02\0\xd8\x01\0\0\x8b\0\0\0\x80\x01\0\0\x10\x8c\x02\0\xf0\
-\x01\0\0\x8b\0\0\0\xa2\x01\0\0\x10\x90\x02\0\xf8\x01\0\0\x8b\0\0\0\xa2\x01\0\0\
-\x08\x90\x02\0\x10\x02\0\0\x8b\0\0\0\xba\x01\0\0\x0a\xa0\x02\0\x18\x02\0\0\x8b\
-\0\0\0\xba\x01\0\0\x24\xa0\x02\0\x20\x02\0\0\x8b\0\0\0\xba\x01\0\0\x22\xa0\x02\
-\0\x28\x02\0\0\x8b\0\0\0\xba\x01\0\0\x08\xa0\x02\0\x40\x02\0\0\x8b\0\0\0\xe4\
-\x01\0\0\x02\xa8\x02\0\x58\x02\0\0\x8b\0\0\0\x07\x02\0\0\x0e\xb0\x02\0\x80\x02\
-\0\0\x8b\0\0\0\x1c\x02\0\0\x01\xf4\x03\0\xf9\x05\0\0\xba\0\0\0\0\0\0\0\x8b\0\0\
-\0\x09\x06\0\0\x05\0\x04\0\x10\0\0\0\x8b\0\0\0\x52\x06\0\0\x10\x14\x04\0\x28\0\
-\0\0\x8b\0\0\0\x09\x06\0\0\x05\0\x04\0\x38\0\0\0\x8b\0\0\0\x52\x06\0\0\x06\x14\
-\x04\0\x40\0\0\0\x8b\0\0\0\x09\x06\0\0\x05\0\x04\0\x68\0\0\0\x8b\0\0\0\x6a\x06\
-\0\0\x06\x20\x04\0\x70\0\0\0\x8b\0\0\0\x8b\x06\0\0\x07\x24\x04\0\x78\0\0\0\x8b\
-\0\0\0\xaa\x06\0\0\x0c\x2c\x04\0\x90\0\0\0\x8b\0\0\0\xaa\x06\0\0\x12\x2c\x04\0\
-\xb8\0\0\0\x8b\0\0\0\xcc\x06\0\0\x0f\x34\x04\0\xc0\0\0\0\x8b\0\0\0\xe6\x06\0\0\
-\x0d\x30\x04\0\xc8\0\0\0\x8b\0\0\0\xf7\x06\0\0\x04\xe8\x02\0\xe8\0\0\0\x8b\0\0\
-\0\x22\x07\0\0\x04\xec\x02\0\0\x01\0\0\x8b\0\0\0\xf7\x06\0\0\x2a\xe8\x02\0\x08\
-\x01\0\0\x8b\0\0\0\x3f\x07\0\0\x1c\xe4\x02\0\x10\x01\0\0\x8b\0\0\0\x5c\x07\0\0\
-\x0b\xfc\x02\0\x30\x01\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\x38\x01\0\0\x8b\
-\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\x40\x01\0\0\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\
-\0\x48\x01\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x50\x01\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\
-\xfc\x02\0\x78\x01\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\x80\x01\0\0\x8b\0\0\
-\0\xd2\x07\0\0\x0a\x34\x01\0\xa8\x01\0\0\x8b\0\0\0\0\x08\0\0\x12\x54\x01\0\xb0\
-\x01\0\0\x8b\0\0\0\x1f\x08\0\0\x03\x58\x01\0\xe0\x01\0\0\x8b\0\0\0\x49\x08\0\0\
-\x0d\x44\x04\0\xf8\x01\0\0\x8b\0\0\0\x6b\x08\0\0\x11\x4c\x04\0\x10\x02\0\0\x8b\
-\0\0\0\x94\x08\0\0\x03\x50\x04\0\x20\x02\0\0\x8b\0\0\0\x6b\x08\0\0\x0f\x4c\x04\
-\0\x38\x02\0\0\x8b\0\0\0\x9f\x08\0\0\x13\x7c\x04\0\x50\x02\0\0\x8b\0\0\0\x8b\
-\x06\0\0\x07\x88\x04\0\x58\x02\0\0\x8b\0\0\0\xd2\x07\0\0\x0a\x34\x01\0\x80\x02\
-\0\0\x8b\0\0\0\0\x08\0\0\x12\x54\x01\0\x88\x02\0\0\x8b\0\0\0\x1f\x08\0\0\x03\
-\x58\x01\0\xb0\x02\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xb8\x02\0\0\x8b\0\0\0\xbb\x08\
-\0\0\x0c\x90\x04\0\xc0\x02\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\xe0\x02\0\0\
-\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\xe8\x02\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\0\
-\x03\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x28\x03\0\0\x8b\0\0\0\x85\x07\0\0\
-\x0f\x0c\x03\0\x30\x03\0\0\x8b\0\0\0\xdc\x08\0\0\x04\x38\x03\0\x50\x03\0\0\x8b\
-\0\0\0\x3f\x07\0\0\x1c\x34\x03\0\x68\x03\0\0\x8b\0\0\0\x06\x09\0\0\x0e\x9c\x04\
-\0\x70\x03\0\0\x8b\0\0\0\x2c\x09\0\0\x12\xa0\x04\0\x90\x03\0\0\x8b\0\0\0\x2c\
-\x09\0\0\x07\xa0\x04\0\xa8\x03\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xb8\x03\0\0\x8b\0\
-\0\0\x44\x09\0\0\x0c\xac\x04\0\xc0\x03\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xc8\x03\0\
-\0\x8b\0\0\0\x09\x06\0\0\x05\0\x04\0\xd8\x03\0\0\x8b\0\0\0\x54\x09\0\0\x0d\x54\
-\x04\0\0\x04\0\0\x8b\0\0\0\xb1\x04\0\0\x0c\xc4\x01\0\x18\x04\0\0\x8b\0\0\0\xb1\
-\x04\0\0\x10\xc4\x01\0\x20\x04\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x28\x04\0\0\x8b\0\
-\0\0\xb1\x04\0\0\x10\xc4\x01\0\x58\x04\0\0\x8b\0\0\0\xdf\x04\0\0\x06\xd4\x01\0\
-\x80\x04\0\0\x8b\0\0\0\x3d\x04\0\0\x06\xd8\x01\0\x88\x04\0\0\x8b\0\0\0\x11\x05\
-\0\0\x03\xf4\x01\0\xb0\x04\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xb8\x04\0\0\x8b\0\0\0\
-\x5c\x07\0\0\x0b\xfc\x02\0\xd8\x04\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\xe0\
-\x04\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xf8\x04\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\
-\x02\0\x18\x05\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\x20\x05\0\0\x8b\0\0\0\0\
-\0\0\0\0\0\0\0\x28\x05\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x48\x05\0\0\x8b\
-\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\x50\x05\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x68\x05\
-\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x88\x05\0\0\x8b\0\0\0\x85\x07\0\0\x0f\
-\x0c\x03\0\x90\x05\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x98\x05\0\0\x8b\0\0\0\x5c\x07\
-\0\0\x0b\xfc\x02\0\xb8\x05\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\xc0\x05\0\0\
-\x8b\0\0\0\0\0\0\0\0\0\0\0\xd8\x05\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\xf8\
-\x05\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\0\x06\0\0\x8b\0\0\0\0\0\0\0\0\0\0\
-\0\x08\x06\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x28\x06\0\0\x8b\0\0\0\x85\
-\x07\0\0\x0f\x0c\x03\0\x30\x06\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x48\x06\0\0\x8b\0\
-\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x68\x06\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\
-\x70\x06\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x78\x06\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\
-\xfc\x02\0\x98\x06\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\xa0\x06\0\0\x8b\0\0\
-\0\0\0\0\0\0\0\0\0\xb8\x06\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\xd8\x06\0\0\
-\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\xe0\x06\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xe8\
-\x06\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x08\x07\0\0\x8b\0\0\0\x85\x07\0\0\
-\x0f\x0c\x03\0\x10\x07\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x28\x07\0\0\x8b\0\0\0\x5c\
-\x07\0\0\x0b\xfc\x02\0\x48\x07\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\x50\x07\
-\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x60\x07\0\0\x8b\0\0\0\x45\x05\0\0\x02\x04\x02\0\
-\x40\x08\0\0\x8b\0\0\0\x6e\x05\0\0\x0a\x0c\x02\0\x48\x08\0\0\x8b\0\0\0\x89\x05\
-\0\0\x17\x1c\x02\0\x48\x09\0\0\x8b\0\0\0\x96\x04\0\0\x02\x24\x02\0\x60\x09\0\0\
-\x8b\0\0\0\xb3\x05\0\0\x0b\x30\x02\0\x80\x09\0\0\x8b\0\0\0\xd0\0\0\0\x06\x48\
-\x02\0\x88\x09\0\0\x8b\0\0\0\xde\0\0\0\x0f\x54\x02\0\x90\x09\0\0\x8b\0\0\0\x08\
-\x01\0\0\x0b\x5c\x02\0\x98\x09\0\0\x8b\0\0\0\x08\x01\0\0\x0f\x5c\x02\0\xa0\x09\
-\0\0\x8b\0\0\0\x08\x01\0\0\x12\x5c\x02\0\xb8\x09\0\0\x8b\0\0\0\x08\x01\0\0\x06\
-\x5c\x02\0\xc8\x09\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xd0\x09\0\0\x8b\0\0\0\x26\x01\
-\0\0\x0a\x68\x02\0\xf0\x09\0\0\x8b\0\0\0\x53\x01\0\0\x06\x6c\x02\0\xf8\x09\0\0\
-\x8b\0\0\0\x60\x01\0\0\x0a\x88\x02\0\0\x0a\0\0\x8b\0\0\0\x80\x01\0\0\x1b\x8c\
-\x02\0\x18\x0a\0\0\x8b\0\0\0\x80\x01\0\0\x13\x8c\x02\0\x30\x0a\0\0\x8b\0\0\0\
-\x80\x01\0\0\x19\x8c\x02\0\x50\x0a\0\0\x8b\0\0\0\x60\x01\0\0\x0a\x88\x02\0\x68\
-\x0a\0\0\x8b\0\0\0\x80\x01\0\0\x10\x8c\x02\0\x80\x0a\0\0\x8b\0\0\0\xa2\x01\0\0\
-\x10\x90\x02\0\x88\x0a\0\0\x8b\0\0\0\xa2\x01\0\0\x08\x90\x02\0\xa0\x0a\0\0\x8b\
-\0\0\0\xba\x01\0\0\x0a\xa0\x02\0\xa8\x0a\0\0\x8b\0\0\0\xba\x01\0\0\x24\xa0\x02\
-\0\xb0\x0a\0\0\x8b\0\0\0\xba\x01\0\0\x22\xa0\x02\0\xb8\x0a\0\0\x8b\0\0\0\xba\
-\x01\0\0\x08\xa0\x02\0\xd0\x0a\0\0\x8b\0\0\0\xe4\x01\0\0\x02\xa8\x02\0\xe8\x0a\
-\0\0\x8b\0\0\0\x07\x02\0\0\x0e\xb0\x02\0\x10\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\
-\x1c\x03\0\x28\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\x30\x0b\0\0\x8b\0\0\
-\0\0\0\0\0\0\0\0\0\x38\x0b\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x58\x0b\0\0\
-\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\x60\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\
-\x03\0\x68\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\x70\x0b\0\0\x8b\0\0\0\0\
-\0\0\0\0\0\0\0\x78\x0b\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x98\x0b\0\0\x8b\
-\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\xa0\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\
-\0\xb8\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\xc0\x0b\0\0\x8b\0\0\0\0\0\0\
-\0\0\0\0\0\xc8\x0b\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\xe8\x0b\0\0\x8b\0\0\
-\0\x85\x07\0\0\x0f\x0c\x03\0\xf0\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\
-\xf8\x0b\0\0\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\0\x0c\0\0\x8b\0\0\0\0\0\0\0\0\
-\0\0\0\x08\x0c\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x28\x0c\0\0\x8b\0\0\0\
-\x85\x07\0\0\x0f\x0c\x03\0\x30\x0c\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\x48\
-\x0c\0\0\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\x50\x0c\0\0\x8b\0\0\0\0\0\0\0\0\0\
-\0\0\x58\x0c\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x78\x0c\0\0\x8b\0\0\0\x85\
-\x07\0\0\x0f\x0c\x03\0\x80\x0c\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\x88\x0c\
-\0\0\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\x90\x0c\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\
-\x98\x0c\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\xb8\x0c\0\0\x8b\0\0\0\x85\x07\
-\0\0\x0f\x0c\x03\0\xc0\x0c\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\xd8\x0c\0\0\
-\x8b\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\xe0\x0c\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xe8\
-\x0c\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x08\x0d\0\0\x8b\0\0\0\x85\x07\0\0\
-\x0f\x0c\x03\0\x10\x0d\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\x18\x0d\0\0\x8b\
-\0\0\0\xa2\x07\0\0\x1d\x1c\x03\0\x20\x0d\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x28\x0d\
-\0\0\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x48\x0d\0\0\x8b\0\0\0\x85\x07\0\0\x0f\
-\x0c\x03\0\x50\x0d\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\x68\x0d\0\0\x8b\0\0\
-\0\xa2\x07\0\0\x1d\x1c\x03\0\x70\x0d\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x78\x0d\0\0\
-\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x98\x0d\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\
-\x03\0\xa0\x0d\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\xa8\x0d\0\0\x8b\0\0\0\
-\xa2\x07\0\0\x1d\x1c\x03\0\xb0\x0d\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\xb8\x0d\0\0\
-\x8b\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\xd8\x0d\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\
-\x03\0\xe0\x0d\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\xf8\x0d\0\0\x8b\0\0\0\
-\xa2\x07\0\0\x1d\x1c\x03\0\0\x0e\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x08\x0e\0\0\x8b\
-\0\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x28\x0e\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\
-\0\x30\x0e\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\x38\x0e\0\0\x8b\0\0\0\xa2\
-\x07\0\0\x1d\x1c\x03\0\x40\x0e\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\x48\x0e\0\0\x8b\0\
-\0\0\x5c\x07\0\0\x0b\xfc\x02\0\x68\x0e\0\0\x8b\0\0\0\x85\x07\0\0\x0f\x0c\x03\0\
-\x70\x0e\0\0\x8b\0\0\0\xa2\x07\0\0\x1f\x1c\x03\0\x88\x0e\0\0\x8b\0\0\0\xa2\x07\
-\0\0\x1d\x1c\x03\0\x90\x0e\0\0\x8b\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x0c\0\0\0\xff\
-\xff\xff\xff\x04\0\x08\0\x08\x7c\x0b\0\x14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb0\
-\x01\0\0\0\0\0\0\x14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x88\x02\0\0\0\0\0\0\x14\0\0\
-\0\0\0\0\0\xb0\x01\0\0\0\0\0\0\xa8\x05\0\0\0\0\0\0\x14\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\xa0\x0e\0\0\0\0\0\0\x2e\x07\0\0\x04\0\x6c\x01\0\0\x08\x01\x01\xfb\x0e\
-\x0d\0\x01\x01\x01\x01\0\0\0\x01\0\0\x01\x2f\x64\x61\x74\x2f\x6b\x65\x72\x6e\
-\x65\x6c\x2f\x75\x73\x69\x2d\x6c\x69\x6e\x75\x78\x2f\x69\x6e\x63\x6c\x75\x64\
-\x65\x2f\x75\x61\x70\x69\x2f\x61\x73\x6d\x2d\x67\x65\x6e\x65\x72\x69\x63\0\x2f\
-\x64\x61\x74\x2f\x6b\x65\x72\x6e\x65\x6c\x2f\x75\x73\x69\x2d\x6c\x69\x6e\x75\
-\x78\x2f\x69\x6e\x63\x6c\x75\x64\x65\x2f\x61\x73\x6d\x2d\x67\x65\x6e\x65\x72\
-\x69\x63\0\x2f\x64\x61\x74\x2f\x6b\x65\x72\x6e\x65\x6c\x2f\x75\x73\x69\x2d\x6c\
-\x69\x6e\x75\x78\x2f\x69\x6e\x63\x6c\x75\x64\x65\x2f\x6c\x69\x6e\x75\x78\0\x2e\
-\0\x2f\x64\x61\x74\x2f\x6b\x65\x72\x6e\x65\x6c\x2f\x75\x73\x69\x2d\x6c\x69\x6e\
-\x75\x78\x2f\x69\x6e\x63\x6c\x75\x64\x65\x2f\x75\x61\x70\x69\x2f\x6c\x69\x6e\
-\x75\x78\0\x2f\x64\x61\x74\x2f\x6b\x65\x72\x6e\x65\x6c\x2f\x75\x73\x69\x2d\x6c\
-\x69\x6e\x75\x78\x2f\x74\x6f\x6f\x6c\x73\x2f\x62\x70\x66\x2f\x72\x65\x73\x6f\
-\x6c\x76\x65\x5f\x62\x74\x66\x69\x64\x73\x2f\x6c\x69\x62\x62\x70\x66\x2f\x69\
-\x6e\x63\x6c\x75\x64\x65\x2f\x62\x70\x66\0\0\x69\x6e\x74\x2d\x6c\x6c\x36\x34\
-\x2e\x68\0\x01\0\0\x69\x6e\x74\x2d\x6c\x6c\x36\x34\x2e\x68\0\x02\0\0\x74\x79\
-\x70\x65\x73\x2e\x68\0\x03\0\0\x77\x75\x6c\x74\x72\x75\x6e\x6e\x65\x72\x2e\x68\
-\0\x04\0\0\x62\x70\x66\x2d\x68\x72\x74\x2e\x63\0\0\0\0\x62\x70\x66\x2e\x68\0\
-\x05\0\0\x62\x70\x66\x5f\x68\x65\x6c\x70\x65\x72\x5f\x64\x65\x66\x73\x2e\x68\0\
-\x06\0\0\x73\x74\x64\x64\x65\x66\x2e\x68\0\x03\0\0\0\x04\x05\0\x09\x02\0\0\0\0\
-\0\0\0\0\x03\x90\x01\x01\x05\x06\x0a\x21\x05\x0f\x23\x05\x0b\x22\x05\x0f\x06\
-\x3c\x05\x12\x20\x05\x06\x3c\x03\xe9\x7e\x20\x05\x0a\x06\x03\x9a\x01\x2e\x05\
-\x06\x4b\x05\x0a\x27\x05\x1b\x21\x05\x13\x06\x3c\x05\x19\x3c\x05\x0a\x06\x49\
-\x05\x10\x3d\x3d\x05\x08\x06\x20\x05\x0a\x06\x40\x05\x24\x06\x20\x05\x22\x20\
-\x05\x08\x20\x05\x02\x06\x3e\x05\x0e\x3e\x05\x01\x4d\x05\0\x03\x23\x2e\x05\x0f\
-\x0a\x13\x05\x0e\x24\x05\x0b\x4c\x05\x06\x06\x3c\x05\x10\x06\x21\x22\x1f\x05\
-\x0e\x1f\x05\x10\x23\x05\x0e\x06\x3c\x05\x10\x06\x21\x05\x0e\x06\x3c\x05\x0d\
-\x06\x21\x05\x07\x06\x20\x03\xa1\x7e\x20\x05\x06\x06\x03\xe1\0\x20\x59\x05\x03\
-\x21\x06\x03\x9d\x7f\x4a\x05\x0a\x06\x03\xe7\0\x20\x05\x02\x22\x06\x03\x97\x7f\
-\x3c\x05\x10\x06\x03\xf1\0\x2e\x05\0\x06\x03\x8f\x7f\x20\x05\x10\x03\xf1\0\x20\
-\x03\x8f\x7f\x20\x03\xf1\0\x20\x03\x8f\x7f\x3c\x05\x06\x06\x03\xf5\0\x20\x59\
-\x05\x03\x27\x06\x03\x83\x7f\x4a\x05\x02\x06\x03\x81\x01\x20\x05\x0a\x08\xae\
-\x05\x17\x24\x05\x02\x08\xe6\x05\x0b\x3f\x06\x03\xf4\x7e\x3c\x05\x06\x06\x03\
-\x92\x01\x20\x05\x0f\x23\x05\x0b\x22\x05\x0f\x06\x3c\x05\x12\x20\x05\x06\x3c\
-\x03\xe9\x7e\x20\x05\x0a\x06\x03\x9a\x01\x2e\x05\x06\x4b\x05\x0a\x27\x05\x1b\
-\x21\x05\x13\x06\x3c\x05\x19\x3c\x05\x0a\x06\x49\x05\x10\x3d\x3d\x05\x08\x06\
-\x20\x05\x0a\x06\x40\x05\x24\x06\x20\x05\x22\x20\x05\x08\x20\x05\x02\x06\x3e\
-\x05\x0e\x3e\x05\x02\x03\x3a\x4a\x02\x02\0\x01\x01\x04\x05\0\x09\x02\0\0\0\0\0\
-\0\0\0\x03\xea\x01\x01\x05\x06\x0a\x21\x05\x10\x23\x05\x08\x06\x20\x05\x10\x06\
-\x3d\x05\x08\x06\x20\x03\x90\x7e\x3c\x05\x0a\x06\x03\xf2\x01\x2e\x06\x03\x8e\
-\x7e\x4a\x05\x06\x06\x03\xf3\x01\x2e\x05\x02\x23\x5a\x05\x06\x03\x9a\x7f\x4a\
-\x05\x0f\x23\x05\x0b\x22\x05\x0f\x06\x3c\x05\x12\x20\x05\x06\x3c\x03\xe9\x7e\
-\x20\x05\x0a\x06\x03\x9a\x01\x2e\x05\x06\x4b\x05\x0a\x27\x05\x1b\x21\x05\x13\
-\x06\x3c\x05\x19\x3c\x05\x0a\x06\x49\x05\x10\x3d\x3d\x05\x08\x06\x20\x05\x0a\
-\x06\x40\x05\x24\x06\x20\x05\x22\x20\x05\x08\x20\x05\x02\x06\x3e\x05\x0e\x3e\
-\x06\x03\xd4\x7e\x4a\x05\x01\x06\x03\xfd\x01\x20\x02\x01\0\x01\x01\x04\x05\0\
-\x09\x02\0\0\0\0\0\0\0\0\x03\xff\x01\x01\x05\x05\x0a\x01\x05\x10\x33\x05\x05\
-\x37\x05\x06\x33\x05\x05\x1b\x05\x06\x60\x05\x07\x21\x05\x0c\x22\x05\x12\x06\
-\x3c\x03\xf5\x7d\x20\x03\x8b\x02\x3c\x05\x0f\x06\x22\x05\x0d\x1f\x05\x04\x03\
-\xae\x7f\x20\x4b\x05\x2a\x3b\x05\x1c\x1f\x05\x0b\x26\x05\x0f\x4e\x05\x1f\x24\
-\x05\x1d\x06\x20\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x06\x03\xc1\
-\x7e\x4a\x05\x0f\x06\x03\xc3\x01\x20\x05\x0a\x03\x8a\x7f\x20\x06\x03\xb3\x7f\
-\x4a\x05\x12\x06\x03\xd5\0\x20\x05\x03\x21\x06\x03\xaa\x7f\x58\x05\x0d\x06\x03\
-\x91\x02\x20\x05\x11\x3e\x06\x03\xed\x7d\x20\x05\x03\x06\x03\x94\x02\x2e\x05\
-\x0f\x2d\x05\x13\x03\x0c\x3c\x05\x07\x3f\x05\x0a\x03\xab\x7e\x20\x06\x03\xb3\
-\x7f\x4a\x05\x12\x06\x03\xd5\0\x20\x05\x03\x21\x05\0\x06\x03\xaa\x7f\x58\x05\
-\x0c\x06\x03\xa4\x02\x20\x05\x0b\x03\x9b\x7f\x20\x05\x0f\x4e\x05\0\x06\x03\xbd\
-\x7e\x20\x05\x0b\x06\x03\xbf\x01\x3c\x06\x03\xc1\x7e\x4a\x05\x0f\x06\x03\xc3\
-\x01\x20\x05\x04\x03\x0b\x20\x05\x1c\x49\x05\x0e\x03\xda\0\x3c\x05\x12\x21\x05\
-\x07\x06\x4a\x05\0\x03\xd8\x7d\x3c\x05\x0c\x06\x03\xab\x02\x2e\x05\0\x06\x03\
-\xd5\x7d\x20\x05\x05\x06\x03\x80\x02\x20\x05\x0d\x03\x15\x2e\x05\x0c\x03\xdc\
-\x7e\x58\x05\x10\x06\x3c\x05\0\x03\x8f\x7f\x20\x05\x10\x03\xf1\0\x20\x03\x8f\
-\x7f\x2e\x03\xf1\0\x20\x03\x8f\x7f\x2e\x05\x06\x06\x03\xf5\0\x20\x59\x05\x03\
-\x27\x06\x03\x83\x7f\x4a\x05\x0b\x06\x03\xbf\x01\x2e\x05\x0f\x4e\x05\0\x06\x03\
-\xbd\x7e\x20\x05\x0b\x06\x03\xbf\x01\x3c\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\
-\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\x0b\x06\
-\x03\xbf\x01\x3c\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\x0b\x06\x03\xbf\x01\
-\x20\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\x0b\x06\x03\xbf\x01\x3c\x05\x0f\
-\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\0\
-\x06\x03\xbd\x7e\x20\x05\x0b\x06\x03\xbf\x01\x3c\x05\x0f\x4e\x05\0\x06\x03\xbd\
-\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\
-\x0b\x06\x03\xbf\x01\x3c\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\x0b\x06\x03\
-\xbf\x01\x20\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\x0b\x06\x03\xbf\x01\x3c\
-\x05\x0f\x4e\x05\0\x06\x03\xbd\x7e\x20\x05\x02\x06\x03\x81\x01\x2e\x05\x0a\x08\
-\xae\x05\x17\x24\x05\x02\x08\xe6\x05\x0b\x3f\x06\x03\xf4\x7e\x3c\x05\x06\x06\
-\x03\x92\x01\x20\x05\x0f\x23\x05\x0b\x22\x05\x0f\x06\x20\x05\x12\x20\x05\x06\
-\x3c\x03\xe9\x7e\x20\x05\x0a\x06\x03\x9a\x01\x2e\x05\x06\x4b\x05\x0a\x27\x05\
-\x1b\x21\x05\x13\x06\x3c\x05\x19\x3c\x05\x0a\x06\x49\x05\x10\x3d\x3d\x05\x08\
-\x06\x20\x05\x0a\x06\x40\x05\x24\x06\x20\x05\x22\x20\x05\x08\x20\x05\x02\x06\
-\x3e\x05\x0e\x3e\x05\x1f\x03\x1b\x58\x05\x1d\x06\x3c\x05\0\x03\xb9\x7e\x20\x05\
-\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\x1f\x24\x05\x1d\x06\x20\x05\0\x03\xb9\
-\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\x1f\x24\x05\x1d\x06\x3c\
-\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\x1f\x24\x05\
-\x1d\x06\x20\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\
-\x1f\x24\x05\x1d\x06\x3c\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\
-\x0f\x4e\x05\x1f\x24\x05\x1d\x06\x20\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\
-\x01\x20\x05\x0f\x4e\x05\x1f\x24\x05\x1d\x06\x3c\x05\0\x03\xb9\x7e\x20\x05\x0b\
-\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\x1f\x24\x05\x1d\x06\x20\x05\0\x03\xb9\x7e\
-\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\x1f\x24\x05\x1d\x06\x3c\x05\0\
-\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\x1f\x24\x05\x1d\
-\x06\x20\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\x4e\x05\x1f\
-\x24\x05\x1d\x06\x3c\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\x20\x05\x0f\
-\x4e\x05\x1f\x24\x05\x1d\x06\x20\x05\0\x03\xb9\x7e\x20\x05\x0b\x06\x03\xbf\x01\
-\x20\x05\x0f\x4e\x05\x1f\x24\x05\x1d\x06\x3c\x05\0\x03\xb9\x7e\x20\x02\x02\0\
-\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xaa\x01\0\
-\0\x04\0\xf1\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x3f\x02\0\0\0\0\x02\0\xa0\x01\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x22\x02\0\0\0\0\x04\0\x78\x02\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\x0c\x02\0\0\0\0\x04\0\x80\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x66\x02\0\0\
-\0\0\x02\0\x90\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x4e\x02\0\0\0\0\x02\0\xa8\x05\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\xfd\x01\0\0\0\0\x02\0\x48\x07\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x38\x02\0\0\0\0\x02\0\xc8\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x1b\x02\0\0\0\
-\0\x02\0\xe8\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x8e\x02\0\0\0\0\x06\0\x20\x02\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\x76\x02\0\0\0\0\x06\0\xd8\x03\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x5e\x02\0\0\0\0\x06\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xe6\x01\0\0\0\0\
-\x06\0\x60\x07\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x86\x02\0\0\0\0\x06\0\x78\x09\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x46\x02\0\0\0\0\x06\0\x38\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x13\x02\0\0\0\0\x06\0\xb8\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf5\x01\0\0\0\0\
-\x06\0\x30\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x7e\x02\0\0\0\0\x06\0\xa8\x03\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x6e\x02\0\0\0\0\x06\0\xc8\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x56\x02\0\0\0\0\x06\0\x10\x0b\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x31\x02\0\0\0\0\
-\x06\0\xb8\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x29\x02\0\0\0\0\x06\0\xb0\x04\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x05\x02\0\0\0\0\x06\0\x80\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\xee\x01\0\0\0\0\x06\0\xe0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x2c\0\0\0\x01\0\x08\
-\0\x08\0\0\0\0\0\0\0\x2e\0\0\0\0\0\0\0\x60\0\0\0\x01\0\x08\0\x65\0\0\0\0\0\0\0\
-\x20\0\0\0\0\0\0\0\x45\0\0\0\x01\0\x08\0\x36\0\0\0\0\0\0\0\x2f\0\0\0\0\0\0\0\
-\xb4\x01\0\0\x02\0\x02\0\xb0\x01\0\0\0\0\0\0\xa8\x05\0\0\0\0\0\0\xd8\x01\0\0\
-\x01\0\x09\0\0\0\0\0\0\0\0\0\xe0\0\0\0\0\0\0\0\x26\0\0\0\x01\0\x09\0\xe4\0\0\0\
-\0\0\0\0\x04\0\0\0\0\0\0\0\x40\x01\0\0\x01\0\x09\0\xf0\0\0\0\0\0\0\0\x08\0\0\0\
-\0\0\0\0\x79\0\0\0\x01\0\x09\0\xe8\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\x7f\0\0\0\
-\x01\0\x09\0\xec\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\x91\0\0\0\x01\0\x09\0\xf8\0\0\
-\0\0\0\0\0\x80\0\0\0\0\0\0\0\x8f\x01\0\0\x01\0\x09\0\xe0\0\0\0\0\0\0\0\x01\0\0\
-\0\0\0\0\0\0\0\0\0\x03\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\
-\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x06\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x03\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\
-\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x0c\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x03\0\x0e\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\
-\x11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x13\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x03\0\x18\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\
-\x1a\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x27\x01\0\0\x11\0\x0b\0\0\0\0\0\0\0\0\0\
-\x04\0\0\0\0\0\0\0\x57\x01\0\0\x12\0\x06\0\0\0\0\0\0\0\0\0\xa0\x0e\0\0\0\0\0\0\
-\xdd\0\0\0\x12\0\x02\0\0\0\0\0\0\0\0\0\xb0\x01\0\0\0\0\0\0\xc9\0\0\0\x12\0\x04\
-\0\0\0\0\0\0\0\0\0\x88\x02\0\0\0\0\0\0\0\x01\0\0\x11\0\x08\0\x04\0\0\0\0\0\0\0\
-\x04\0\0\0\0\0\0\0\x85\0\0\0\x11\0\x0a\0\x20\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\
-\x7c\x01\0\0\x11\0\x08\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\x22\x01\0\0\x11\0\
-\x0a\0\x30\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x9f\0\0\0\x11\0\x0a\0\0\0\0\0\0\0\0\
-\0\x20\0\0\0\0\0\0\0\x18\0\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x38\0\0\0\0\0\0\0\
-\x01\0\0\0\x28\0\0\0\x68\0\0\0\0\0\0\0\x01\0\0\0\x37\0\0\0\x98\0\0\0\0\0\0\0\
-\x01\0\0\0\x28\0\0\0\xb0\0\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x20\x01\0\0\0\0\0\0\
-\x01\0\0\0\x28\0\0\0\x50\x01\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x80\x01\0\0\0\0\0\
-\0\x01\0\0\0\x28\0\0\0\xb8\x01\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xd8\x01\0\0\0\0\
-\0\0\x01\0\0\0\x28\0\0\0\x18\x02\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x38\x02\0\0\0\
-\0\0\0\x01\0\0\0\x28\0\0\0\x70\x02\0\0\0\0\0\0\x01\0\0\0\x34\0\0\0\xa0\x02\0\0\
-\0\0\0\0\x01\0\0\0\x27\0\0\0\x38\x03\0\0\0\0\0\0\x01\0\0\0\x34\0\0\0\x68\x03\0\
-\0\0\0\0\0\x01\0\0\0\x27\0\0\0\x90\x03\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x78\x04\
-\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xc0\x05\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xe0\
-\x05\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x10\x06\0\0\0\0\0\0\x01\0\0\0\x37\0\0\0\
-\x40\x06\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x58\x06\0\0\0\0\0\0\x01\0\0\0\x28\0\0\
-\0\xc8\x06\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xf8\x06\0\0\0\0\0\0\x01\0\0\0\x28\0\
-\0\0\x28\x07\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x18\0\0\0\0\0\0\0\x01\0\0\0\x28\0\
-\0\0\x38\0\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x60\0\0\0\0\0\0\0\x01\0\0\0\x37\0\0\
-\0\xa0\0\0\0\0\0\0\0\x01\0\0\0\x37\0\0\0\xc8\0\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\
-\xf0\0\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x10\x01\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\
-\x40\x01\0\0\0\0\0\0\x01\0\0\0\x37\0\0\0\x70\x01\0\0\0\0\0\0\x01\0\0\0\x28\0\0\
-\0\x88\x01\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xf8\x01\0\0\0\0\0\0\x01\0\0\0\x28\0\
-\0\0\x28\x02\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x58\x02\0\0\0\0\0\0\x01\0\0\0\x28\
-\0\0\0\x10\0\0\0\0\0\0\0\x01\0\0\0\x33\0\0\0\x78\0\0\0\0\0\0\0\x01\0\0\0\x28\0\
-\0\0\x98\0\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xc8\0\0\0\0\0\0\0\x01\0\0\0\x36\0\0\
-\0\xe8\0\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x10\x01\0\0\0\0\0\0\x01\0\0\0\x36\0\0\
-\0\x50\x01\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x80\x01\0\0\0\0\0\0\x01\0\0\0\x36\0\
-\0\0\xb0\x01\0\0\0\0\0\0\x01\0\0\0\x27\0\0\0\xe0\x01\0\0\0\0\0\0\x01\0\0\0\x28\
-\0\0\0\x38\x02\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x58\x02\0\0\0\0\0\0\x01\0\0\0\
-\x36\0\0\0\x88\x02\0\0\0\0\0\0\x01\0\0\0\x27\0\0\0\xc0\x02\0\0\0\0\0\0\x01\0\0\
-\0\x36\0\0\0\xe8\x02\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\0\x03\0\0\0\0\0\0\x01\0\0\
-\0\x36\0\0\0\x30\x03\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x50\x03\0\0\0\0\0\0\x01\0\
-\0\0\x28\0\0\0\x70\x03\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xa8\x03\0\0\0\0\0\0\x01\
-\0\0\0\x28\0\0\0\xd8\x03\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\0\x04\0\0\0\0\0\0\x01\
-\0\0\0\x28\0\0\0\x58\x04\0\0\0\0\0\0\x01\0\0\0\x34\0\0\0\x88\x04\0\0\0\0\0\0\
-\x01\0\0\0\x27\0\0\0\xb8\x04\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\xe0\x04\0\0\0\0\0\
-\0\x01\0\0\0\x28\0\0\0\xf8\x04\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x28\x05\0\0\0\0\
-\0\0\x01\0\0\0\x36\0\0\0\x50\x05\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x68\x05\0\0\0\
-\0\0\0\x01\0\0\0\x36\0\0\0\x98\x05\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\xc0\x05\0\0\
-\0\0\0\0\x01\0\0\0\x28\0\0\0\xd8\x05\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x08\x06\0\
-\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x30\x06\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x48\x06\
-\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x78\x06\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\xa0\
-\x06\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xb8\x06\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\
-\xe8\x06\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x10\x07\0\0\0\0\0\0\x01\0\0\0\x28\0\0\
-\0\x28\x07\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x60\x07\0\0\0\0\0\0\x01\0\0\0\x28\0\
-\0\0\x48\x08\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xa0\x09\0\0\0\0\0\0\x01\0\0\0\x28\
-\0\0\0\xd0\x09\0\0\0\0\0\0\x01\0\0\0\x37\0\0\0\0\x0a\0\0\0\0\0\0\x01\0\0\0\x28\
-\0\0\0\x18\x0a\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x88\x0a\0\0\0\0\0\0\x01\0\0\0\
-\x28\0\0\0\xb8\x0a\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\xe8\x0a\0\0\0\0\0\0\x01\0\0\
-\0\x28\0\0\0\x10\x0b\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x38\x0b\0\0\0\0\0\0\x01\0\
-\0\0\x36\0\0\0\x78\x0b\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\xa0\x0b\0\0\0\0\0\0\x01\
-\0\0\0\x28\0\0\0\xc8\x0b\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x08\x0c\0\0\0\0\0\0\
-\x01\0\0\0\x36\0\0\0\x30\x0c\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x58\x0c\0\0\0\0\0\
-\0\x01\0\0\0\x36\0\0\0\x98\x0c\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\xc0\x0c\0\0\0\0\
-\0\0\x01\0\0\0\x28\0\0\0\xe8\x0c\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x28\x0d\0\0\0\
-\0\0\0\x01\0\0\0\x36\0\0\0\x50\x0d\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x78\x0d\0\0\
-\0\0\0\0\x01\0\0\0\x36\0\0\0\xb8\x0d\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\xe0\x0d\0\
-\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x08\x0e\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x48\x0e\
-\0\0\0\0\0\0\x01\0\0\0\x36\0\0\0\x70\x0e\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x08\0\
-\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x51\0\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x84\0\0\
-\0\0\0\0\0\x01\0\0\0\x25\0\0\0\xb7\0\0\0\0\0\0\0\x01\0\0\0\x25\0\0\0\0\x01\0\0\
-\0\0\0\0\x01\0\0\0\x25\0\0\0\x33\x01\0\0\0\0\0\0\x01\0\0\0\x25\0\0\0\x7c\x01\0\
-\0\0\0\0\0\x01\0\0\0\x25\0\0\0\xaf\x01\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\xe2\x01\
-\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x15\x02\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x48\
-\x02\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x8e\x02\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\
-\xd4\x02\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x09\x03\0\0\0\0\0\0\x01\0\0\0\x24\0\0\
-\0\x52\x03\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x85\x03\0\0\0\0\0\0\x01\0\0\0\x26\0\
-\0\0\xb8\x03\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xeb\x03\0\0\0\0\0\0\x01\0\0\0\x26\
-\0\0\0\x1e\x04\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x68\x04\0\0\0\0\0\0\x01\0\0\0\
-\x26\0\0\0\xae\x04\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xfe\x04\0\0\0\0\0\0\x01\0\0\
-\0\x26\0\0\0\x6e\x06\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xab\x07\0\0\0\0\0\0\x01\0\
-\0\0\x26\0\0\0\xe8\x08\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x1b\x09\0\0\0\0\0\0\x01\
-\0\0\0\x26\0\0\0\x4e\x09\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x81\x09\0\0\0\0\0\0\
-\x01\0\0\0\x26\0\0\0\xc8\x09\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x38\x0b\0\0\0\0\0\
-\0\x01\0\0\0\x26\0\0\0\x86\x0b\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xcc\x0b\0\0\0\0\
-\0\0\x01\0\0\0\x26\0\0\0\x12\x0c\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x58\x0c\0\0\0\
-\0\0\0\x01\0\0\0\x26\0\0\0\x8d\x0c\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xd6\x0c\0\0\
-\0\0\0\0\x01\0\0\0\x26\0\0\0\x06\0\0\0\0\0\0\0\x0a\0\0\0\x2a\0\0\0\x0c\0\0\0\0\
-\0\0\0\x0a\0\0\0\x2c\0\0\0\x12\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x16\0\0\0\0\0\
-\0\0\x0a\0\0\0\x2e\0\0\0\x1a\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x26\0\0\0\0\0\0\
-\0\x0a\0\0\0\x2b\0\0\0\x2b\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x37\0\0\0\0\0\0\0\
-\x01\0\0\0\x35\0\0\0\x49\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x54\0\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\x5f\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x6a\0\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\x71\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x78\0\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\x85\0\0\0\0\0\0\0\x01\0\0\0\x2f\0\0\0\x9a\0\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\xa1\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xa8\0\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\xb4\0\0\0\0\0\0\0\x01\0\0\0\x34\0\0\0\xc1\0\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\xcd\0\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xeb\0\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\x04\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x10\x01\0\0\0\0\0\
-\0\x01\0\0\0\x36\0\0\0\x1d\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x29\x01\0\0\0\0\
-\0\0\x0a\0\0\0\x2c\0\0\0\x35\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x41\x01\0\0\0\
-\0\0\0\x0a\0\0\0\x2c\0\0\0\x70\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x7c\x01\0\0\
-\0\0\0\0\x01\0\0\0\x37\0\0\0\x89\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x95\x01\0\
-\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xa1\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xad\x01\
-\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xe6\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xee\
-\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xfc\x01\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\
-\x06\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x12\x02\0\0\0\0\0\0\x01\0\0\0\x28\0\0\
-\0\x1b\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x27\x02\0\0\0\0\0\0\x01\0\0\0\x28\0\
-\0\0\x30\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x3c\x02\0\0\0\0\0\0\x01\0\0\0\x28\
-\0\0\0\x45\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x4d\x02\0\0\0\0\0\0\x0a\0\0\0\
-\x2c\0\0\0\x59\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x65\x02\0\0\0\0\0\0\x0a\0\0\
-\0\x2c\0\0\0\x71\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x7d\x02\0\0\0\0\0\0\x0a\0\
-\0\0\x2c\0\0\0\x89\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x95\x02\0\0\0\0\0\0\x0a\
-\0\0\0\x2c\0\0\0\xa1\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xad\x02\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\xb9\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xc5\x02\0\0\0\0\0\
-\0\x0a\0\0\0\x2c\0\0\0\xd1\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xdd\x02\0\0\0\0\
-\0\0\x0a\0\0\0\x2c\0\0\0\xe9\x02\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xfa\x02\0\0\0\
-\0\0\0\x0a\0\0\0\x2c\0\0\0\x05\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x0c\x03\0\0\
-\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x17\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x22\x03\0\
-\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x2d\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x38\x03\
-\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x3f\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x52\
-\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x5e\x03\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\
-\x67\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x73\x03\0\0\0\0\0\0\x01\0\0\0\x28\0\0\
-\0\x7c\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x88\x03\0\0\0\0\0\0\x01\0\0\0\x28\0\
-\0\0\x9c\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xa3\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\
-\0\0\0\xaa\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xb6\x03\0\0\0\0\0\0\x01\0\0\0\
-\x33\0\0\0\xc9\x03\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xde\x03\0\0\0\0\0\0\x0a\0\0\
-\0\x2c\0\0\0\x05\x04\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x10\x04\0\0\0\0\0\0\x0a\0\
-\0\0\x2c\0\0\0\x26\x04\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x4c\x04\0\0\0\0\0\0\x0a\
-\0\0\0\x2c\0\0\0\x58\x04\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x7e\x04\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\xa0\x04\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xac\x04\0\0\0\0\0\
-\0\x01\0\0\0\x27\0\0\0\xc7\x04\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xed\x04\0\0\0\0\
-\0\0\x0a\0\0\0\x2c\0\0\0\x13\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x31\x05\0\0\0\
-\0\0\0\x0a\0\0\0\x2c\0\0\0\x3d\x05\0\0\0\0\0\0\x01\0\0\0\x27\0\0\0\x53\x05\0\0\
-\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x5f\x05\0\0\0\0\0\0\x01\0\0\0\x28\0\0\0\x68\x05\0\
-\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x8a\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x96\x05\
-\0\0\0\0\0\0\x01\0\0\0\x27\0\0\0\xb4\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xba\
-\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xc9\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\
-\xcf\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xde\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\
-\0\xe4\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xea\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\
-\0\0\xf0\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xfb\x05\0\0\0\0\0\0\x0a\0\0\0\x2c\
-\0\0\0\x06\x06\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x0d\x06\0\0\0\0\0\0\x0a\0\0\0\
-\x2c\0\0\0\x14\x06\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x27\x06\0\0\0\0\0\0\x0a\0\0\
-\0\x29\0\0\0\x35\x06\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x44\x06\0\0\0\0\0\0\x0a\0\
-\0\0\x2c\0\0\0\x50\x06\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x5b\x06\0\0\0\0\0\0\x0a\
-\0\0\0\x2c\0\0\0\x66\x06\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x71\x06\0\0\0\0\0\0\
-\x0a\0\0\0\x2c\0\0\0\x7d\x06\0\0\0\0\0\0\x01\0\0\0\x25\0\0\0\x8b\x06\0\0\0\0\0\
-\0\x0a\0\0\0\x2c\0\0\0\x96\x06\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x9a\x06\0\0\0\0\
-\0\0\x0a\0\0\0\x2c\0\0\0\xa5\x06\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xa9\x06\0\0\0\
-\0\0\0\x0a\0\0\0\x2c\0\0\0\xb4\x06\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xb8\x06\0\0\
-\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xc7\x06\0\0\0\0\0\0\x01\0\0\0\x25\0\0\0\xd7\x06\0\
-\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xe5\x06\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xf0\x06\
-\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xf8\x06\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x09\
-\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x11\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\
-\x1c\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x28\x07\0\0\0\0\0\0\x01\0\0\0\x24\0\0\
-\0\x36\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x41\x07\0\0\0\0\0\0\x0a\0\0\0\x29\0\
-\0\0\x45\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x50\x07\0\0\0\0\0\0\x0a\0\0\0\x29\
-\0\0\0\x54\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x5f\x07\0\0\0\0\0\0\x0a\0\0\0\
-\x29\0\0\0\x63\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x6e\x07\0\0\0\0\0\0\x0a\0\0\
-\0\x2c\0\0\0\x7d\x07\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\x8d\x07\0\0\0\0\0\0\x0a\0\
-\0\0\x29\0\0\0\x9b\x07\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\xab\x07\0\0\0\0\0\0\x0a\
-\0\0\0\x29\0\0\0\xb4\x07\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xc2\x07\0\0\0\0\0\0\
-\x01\0\0\0\x24\0\0\0\xd2\x07\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xe0\x07\0\0\0\0\0\
-\0\x0a\0\0\0\x29\0\0\0\xeb\x07\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xf8\x07\0\0\0\0\
-\0\0\x0a\0\0\0\x2c\0\0\0\x04\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x10\x08\0\0\0\
-\0\0\0\x0a\0\0\0\x2c\0\0\0\x1c\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x28\x08\0\0\
-\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x3a\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x42\x08\0\
-\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x4d\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x58\x08\
-\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x63\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x6e\
-\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x79\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\
-\x8a\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x96\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\
-\0\xa1\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xad\x08\0\0\0\0\0\0\x01\0\0\0\x26\0\
-\0\0\xbb\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xc7\x08\0\0\0\0\0\0\x0a\0\0\0\x29\
-\0\0\0\xcb\x08\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\xdb\x08\0\0\0\0\0\0\x0a\0\0\0\
-\x2b\0\0\0\xe9\x08\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xf2\x08\0\0\0\0\0\0\x0a\0\0\
-\0\x29\0\0\0\xfb\x08\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x04\x09\0\0\0\0\0\0\x0a\0\
-\0\0\x29\0\0\0\x11\x09\0\0\0\0\0\0\x0a\0\0\0\x2b\0\0\0\x1a\x09\0\0\0\0\0\0\x0a\
-\0\0\0\x29\0\0\0\x23\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x2c\x09\0\0\0\0\0\0\
-\x0a\0\0\0\x29\0\0\0\x35\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x43\x09\0\0\0\0\0\
-\0\x01\0\0\0\x26\0\0\0\x54\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x5d\x09\0\0\0\0\
-\0\0\x0a\0\0\0\x29\0\0\0\x6b\x09\0\0\0\0\0\0\x0a\0\0\0\x2b\0\0\0\x74\x09\0\0\0\
-\0\0\0\x0a\0\0\0\x29\0\0\0\x7d\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x8b\x09\0\0\
-\0\0\0\0\x01\0\0\0\x26\0\0\0\x9c\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xaa\x09\0\
-\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xb8\x09\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xc9\x09\
-\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xd2\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xe0\
-\x09\0\0\0\0\0\0\x0a\0\0\0\x2b\0\0\0\xe9\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\
-\xf2\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\xfb\x09\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\
-\0\x04\x0a\0\0\0\0\0\0\x0a\0\0\0\x29\0\0\0\x15\x0a\0\0\0\0\0\0\x0a\0\0\0\x2c\0\
-\0\0\x1d\x0a\0\0\0\0\0\0\x0a\0\0\0\x2c\0\0\0\x29\x0a\0\0\0\0\0\0\x0a\0\0\0\x2c\
-\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x08\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\
-\0\x10\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x18\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\x20\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x28\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\x30\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x38\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\x50\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x58\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\x60\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x68\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\x80\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x88\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\x90\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x98\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\xb0\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xb8\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\xc0\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\xc8\0\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\
-\xe0\0\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\xe8\0\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\
-\xf0\0\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\xf8\0\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\0\
-\x01\0\0\0\0\0\0\x01\0\0\0\x25\0\0\0\x08\x01\0\0\0\0\0\0\x01\0\0\0\x25\0\0\0\
-\x10\x01\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x18\x01\0\0\0\0\0\0\x01\0\0\0\x26\0\0\
-\0\x04\x06\0\0\0\0\0\0\0\0\0\0\x28\0\0\0\x10\x06\0\0\0\0\0\0\0\0\0\0\x28\0\0\0\
-\x1c\x06\0\0\0\0\0\0\0\0\0\0\x28\0\0\0\x28\x06\0\0\0\0\0\0\0\0\0\0\x28\0\0\0\
-\x34\x06\0\0\0\0\0\0\0\0\0\0\x28\0\0\0\x40\x06\0\0\0\0\0\0\0\0\0\0\x28\0\0\0\
-\x4c\x06\0\0\0\0\0\0\0\0\0\0\x28\0\0\0\x64\x06\0\0\0\0\0\0\0\0\0\0\x37\0\0\0\
-\x70\x06\0\0\0\0\0\0\0\0\0\0\x34\0\0\0\x7c\x06\0\0\0\0\0\0\0\0\0\0\x36\0\0\0\
-\x94\x06\0\0\0\0\0\0\x0a\0\0\0\x35\0\0\0\xa0\x06\0\0\0\0\0\0\x0a\0\0\0\x33\0\0\
-\0\xac\x06\0\0\0\0\0\0\x0a\0\0\0\x27\0\0\0\xb8\x06\0\0\0\0\0\0\x0a\0\0\0\x27\0\
-\0\0\xc4\x06\0\0\0\0\0\0\x0a\0\0\0\x27\0\0\0\xdc\x06\0\0\0\0\0\0\0\0\0\0\x2f\0\
-\0\0\x2c\0\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x34\0\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x44\0\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x54\0\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\0\
-\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x78\0\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x88\0\0\0\0\
-\0\0\0\0\0\0\0\x24\0\0\0\x98\0\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xa8\0\0\0\0\0\0\0\
-\0\0\0\0\x24\0\0\0\xb8\0\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xc8\0\0\0\0\0\0\0\0\0\0\
-\0\x24\0\0\0\xd8\0\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xe8\0\0\0\0\0\0\0\0\0\0\0\x24\
-\0\0\0\xf8\0\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x08\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\
-\0\x18\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x28\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x38\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x48\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x58\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x68\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x78\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x88\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x98\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xa8\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xb8\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xc8\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xd8\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xe8\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xf8\x01\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x08\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x18\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x28\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x38\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x48\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x58\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x68\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x78\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x88\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x98\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xa8\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xb8\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xc8\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xd8\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xe8\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xf8\x02\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x08\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x18\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x28\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x38\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x48\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x58\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x68\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x78\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x88\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x98\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xa8\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xb8\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xc8\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xd8\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xe8\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xf8\x03\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x08\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x18\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x28\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x38\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x48\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x58\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x68\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x78\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x88\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x98\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xa8\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xb8\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xc8\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xd8\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\xe8\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\xf8\x04\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x08\x05\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x18\x05\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x28\x05\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x38\x05\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\x48\x05\0\0\0\0\0\0\0\0\0\0\x24\0\0\0\
-\x60\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x70\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\
-\x80\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x90\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\
-\xa0\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xb0\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\
-\xc0\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xd0\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\
-\xe0\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xf0\x05\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\0\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x10\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x20\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x30\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x40\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x50\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x60\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x70\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x80\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x90\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xa0\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xb0\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xc0\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xd0\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xe0\
-\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\xf0\x06\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\0\x07\
-\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x10\x07\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x20\x07\0\
-\0\0\0\0\0\0\0\0\0\x25\0\0\0\x30\x07\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x40\x07\0\0\
-\0\0\0\0\0\0\0\0\x25\0\0\0\x50\x07\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x60\x07\0\0\0\
-\0\0\0\0\0\0\0\x25\0\0\0\x70\x07\0\0\0\0\0\0\0\0\0\0\x25\0\0\0\x80\x07\0\0\0\0\
-\0\0\0\0\0\0\x25\0\0\0\x98\x07\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x07\0\0\0\0\0\
-\0\0\0\0\0\x26\0\0\0\xb8\x07\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x07\0\0\0\0\0\0\
-\0\0\0\0\x26\0\0\0\xd8\x07\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x07\0\0\0\0\0\0\0\
-\0\0\0\x26\0\0\0\xf8\x07\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x08\0\0\0\0\0\0\0\0\
-\0\0\x26\0\0\0\x18\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x08\0\0\0\0\0\0\0\0\0\
-\0\x26\0\0\0\x38\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x08\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x08\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x08\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x08\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x08\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x08\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x08\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x09\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x09\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x0a\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x0a\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x0b\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x0b\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x0c\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x0c\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x0d\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x0d\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x0e\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x0e\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x0f\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x0f\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x10\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x10\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x11\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x11\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x38\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x48\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x58\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x68\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x78\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x88\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x98\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xa8\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xb8\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xc8\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xd8\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\xe8\x12\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\xf8\x12\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x08\x13\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x18\x13\0\0\0\0\0\0\0\0\0\0\x26\0\0\0\x28\x13\0\0\0\0\0\0\0\0\0\0\
-\x26\0\0\0\x14\0\0\0\0\0\0\0\x0a\0\0\0\x2d\0\0\0\x18\0\0\0\0\0\0\0\x01\0\0\0\
-\x24\0\0\0\x2c\0\0\0\0\0\0\0\x0a\0\0\0\x2d\0\0\0\x30\0\0\0\0\0\0\0\x01\0\0\0\
-\x25\0\0\0\x44\0\0\0\0\0\0\0\x0a\0\0\0\x2d\0\0\0\x48\0\0\0\0\0\0\0\x01\0\0\0\
-\x24\0\0\0\x5c\0\0\0\0\0\0\0\x0a\0\0\0\x2d\0\0\0\x60\0\0\0\0\0\0\0\x01\0\0\0\
-\x26\0\0\0\x7b\x01\0\0\0\0\0\0\x01\0\0\0\x24\0\0\0\xdc\x02\0\0\0\0\0\0\x01\0\0\
-\0\x25\0\0\0\x7e\x03\0\0\0\0\0\0\x01\0\0\0\x26\0\0\0\x32\x1c\x30\x37\x2f\x34\
-\x36\x33\x19\x1b\x1a\0\x2e\x64\x65\x62\x75\x67\x5f\x61\x62\x62\x72\x65\x76\0\
-\x2e\x72\x65\x6c\x2e\x74\x65\x78\x74\0\x2e\x72\x65\x6c\x2e\x42\x54\x46\x2e\x65\
-\x78\x74\0\x6c\x64\x69\x73\x74\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x70\x69\x6e\
-\x67\x5f\x63\x70\x75\x2e\x5f\x5f\x5f\x5f\x66\x6d\x74\0\x62\x70\x66\x5f\x68\x72\
-\x74\x5f\x73\x65\x6e\x64\x5f\x65\x76\x65\x6e\x74\x2e\x5f\x5f\x5f\x5f\x66\x6d\
-\x74\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x72\x65\x61\x64\x5f\x74\x73\x63\x2e\x5f\
-\x5f\x5f\x5f\x66\x6d\x74\0\x6d\x61\x78\x5f\x74\0\x6d\x69\x6e\x5f\x74\0\x65\x76\
-\x65\x6e\x74\x73\0\x2e\x62\x73\x73\0\x70\x65\x72\x66\x5f\x63\x6f\x75\x6e\x74\
-\x65\x72\x73\0\x74\x69\x6d\x65\x72\x73\0\x2e\x6d\x61\x70\x73\0\x2e\x72\x65\x6c\
-\x2e\x64\x65\x62\x75\x67\x5f\x72\x61\x6e\x67\x65\x73\0\x2e\x64\x65\x62\x75\x67\
-\x5f\x73\x74\x72\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x73\x74\x61\x72\x74\x5f\x74\
-\x69\x6d\x65\x72\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x6b\x69\x63\x6b\x5f\x74\x69\
-\x6d\x65\x72\0\x2e\x72\x65\x6c\x2e\x64\x65\x62\x75\x67\x5f\x69\x6e\x66\x6f\0\
-\x63\x70\x75\x5f\x6e\x75\x6d\0\x2e\x72\x65\x6c\x73\x79\x73\x63\x61\x6c\x6c\0\
-\x2e\x6c\x6c\x76\x6d\x5f\x61\x64\x64\x72\x73\x69\x67\0\x70\x65\x72\x66\0\x5f\
-\x6c\x69\x63\x65\x6e\x73\x65\0\x2e\x72\x65\x6c\x2e\x64\x65\x62\x75\x67\x5f\x6c\
-\x69\x6e\x65\0\x6c\x74\x69\x6d\x65\0\x2e\x72\x65\x6c\x2e\x64\x65\x62\x75\x67\
-\x5f\x66\x72\x61\x6d\x65\0\x62\x70\x66\x5f\x68\x72\x74\x5f\x63\x70\x75\x5f\x69\
-\x64\x6c\x65\0\x2e\x72\x65\x6c\x74\x70\x5f\x62\x74\x66\x2f\x63\x70\x75\x5f\x69\
-\x64\x6c\x65\0\x6c\x69\x6e\x75\x78\x5f\x76\x65\x72\x73\x69\x6f\x6e\x5f\x63\x6f\
-\x64\x65\0\x74\x69\x6d\x65\x72\x5f\x61\x72\x6d\x65\x64\0\x2e\x72\x65\x6c\x2e\
-\x64\x65\x62\x75\x67\x5f\x6c\x6f\x63\0\x62\x70\x66\x2d\x68\x72\x74\x2e\x63\0\
-\x62\x70\x66\x5f\x68\x72\x74\x5f\x74\x69\x6d\x65\x72\x5f\x63\x62\0\x2e\x73\x74\
-\x72\x74\x61\x62\0\x2e\x73\x79\x6d\x74\x61\x62\0\x2e\x72\x6f\x64\x61\x74\x61\0\
-\x2e\x72\x65\x6c\x2e\x42\x54\x46\0\x4c\x42\x42\x33\x5f\x31\x39\0\x4c\x42\x42\
-\x33\x5f\x38\0\x4c\x42\x42\x33\x5f\x32\x38\0\x4c\x42\x42\x32\x5f\x31\x37\0\x4c\
-\x42\x42\x33\x5f\x36\0\x4c\x42\x42\x31\x5f\x36\0\x4c\x42\x42\x33\x5f\x32\x36\0\
-\x4c\x42\x42\x32\x5f\x35\0\x4c\x42\x42\x31\x5f\x35\0\x4c\x42\x42\x33\x5f\x34\
-\x35\0\x4c\x42\x42\x33\x5f\x34\0\x4c\x42\x42\x32\x5f\x34\0\x4c\x42\x42\x30\x5f\
-\x34\0\x4c\x42\x42\x33\x5f\x32\x34\0\x4c\x42\x42\x32\x5f\x31\x33\0\x4c\x42\x42\
-\x33\x5f\x33\x32\0\x4c\x42\x42\x33\x5f\x31\x32\0\x4c\x42\x42\x32\x5f\x31\x32\0\
-\x4c\x42\x42\x33\x5f\x33\x31\0\x4c\x42\x42\x33\x5f\x31\x31\0\x4c\x42\x42\x33\
-\x5f\x33\x30\0\x4c\x42\x42\x33\x5f\x32\x30\0\x4c\x42\x42\x33\x5f\x31\x30\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xc5\x01\0\0\x03\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x4b\x96\0\0\0\0\0\0\x96\x02\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x13\0\0\0\x01\0\0\0\x06\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\0\0\x58\x07\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x0f\0\0\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\x60\x6a\0\0\0\0\0\0\xa0\x01\0\0\0\0\0\0\x1d\0\0\0\x02\0\0\0\x08\0\0\0\
-\0\0\0\0\x10\0\0\0\0\0\0\0\x0c\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x98\x07\0\0\0\0\0\0\x88\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\x08\x01\0\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x6c\0\
-\0\0\0\0\0\xd0\0\0\0\0\0\0\0\x1d\0\0\0\x04\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\
-\0\0\0\x6c\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x20\x0a\0\0\0\0\
-\0\0\xa0\x0e\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x68\
-\x01\0\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xd0\x6c\0\0\0\0\0\0\x60\x04\
-\0\0\0\0\0\0\x1d\0\0\0\x06\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\xd5\x01\0\
-\0\x01\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xc0\x18\0\0\0\0\0\0\x85\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x8c\0\0\0\x08\0\0\0\
-\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x48\x19\0\0\0\0\0\0\x78\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xa6\0\0\0\x01\0\0\0\x03\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x48\x19\0\0\0\0\0\0\x50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x28\x01\0\0\x01\0\0\0\x03\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\x98\x19\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x9f\x01\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x9c\x19\0\0\0\0\0\0\x01\x0d\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\x9b\x01\0\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x30\x71\0\0\
-\0\0\0\0\x40\x02\0\0\0\0\0\0\x1d\0\0\0\x0c\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\
-\0\0\0\x01\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x9d\x26\0\0\0\0\0\0\
-\x95\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf4\0\0\
-\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x32\x29\0\0\0\0\0\0\x36\x0a\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf0\0\0\0\x09\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x70\x73\0\0\0\0\0\0\x60\x0c\0\0\0\0\0\0\x1d\0\0\
-\0\x0f\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\xb0\0\0\0\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x68\x33\0\0\0\0\0\0\x30\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xac\0\0\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\xd0\x7f\0\0\0\0\0\0\xc0\x01\0\0\0\0\0\0\x1d\0\0\0\x11\0\0\0\x08\0\0\0\
-\0\0\0\0\x10\0\0\0\0\0\0\0\xbe\0\0\0\x01\0\0\0\x30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x98\x34\0\0\0\0\0\0\x24\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\
-\x01\0\0\0\0\0\0\0\xe1\x01\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbc\
-\x38\0\0\0\0\0\0\x80\x11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\xdd\x01\0\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x90\x81\0\0\0\0\
-\0\0\0\x01\0\0\0\0\0\0\x1d\0\0\0\x14\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\
-\x1d\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x3c\x4a\0\0\0\0\0\0\x38\
-\x13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x19\0\0\0\
-\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x90\x82\0\0\0\0\0\0\0\x13\0\0\0\0\0\
-\0\x1d\0\0\0\x16\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x4a\x01\0\0\x01\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x78\x5d\0\0\0\0\0\0\x70\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x46\x01\0\0\x09\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x90\x95\0\0\0\0\0\0\x80\0\0\0\0\0\0\0\x1d\0\0\0\x18\0\0\0\
-\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x34\x01\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\xe8\x5d\0\0\0\0\0\0\x32\x07\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\x30\x01\0\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x10\x96\0\0\0\0\0\0\x30\0\0\0\0\0\0\0\x1d\0\0\0\x1a\0\0\0\x08\0\0\0\0\0\0\0\
-\x10\0\0\0\0\0\0\0\x14\x01\0\0\x03\x4c\xff\x6f\0\0\0\x80\0\0\0\0\0\0\0\0\0\0\0\
-\0\x40\x96\0\0\0\0\0\0\x0b\0\0\0\0\0\0\0\x1d\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\xcd\x01\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x20\x65\0\
-\0\0\0\0\0\x40\x05\0\0\0\0\0\0\x01\0\0\0\x2f\0\0\0\x08\0\0\0\0\0\0\0\x18\0\0\0\
-\0\0\0\0";
-
-	return 0;
-err:
-	bpf_object__destroy_skeleton(s);
-	return -1;
-}
-
-#endif /* __BPF_HRT_SKEL_H__ */
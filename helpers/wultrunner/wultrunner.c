@@ -13,11 +13,16 @@
 #include <getopt.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <linux/perf_event.h>
 #include <sched.h>
+#include <signal.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <sys/ioctl.h>
 #include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "wultrunner.h"
@@ -25,17 +30,38 @@
 
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
 
+/*
+ * Default launch distance range and snapshot interval for the daemon mode.
+ * The long launch distance keeps the sampling rate, and therefore the
+ * overhead, low.
+ */
+#define DAEMON_DEFAULT_MIN_LDIST 10000000
+#define DAEMON_DEFAULT_MAX_LDIST 50000000
+#define DAEMON_DEFAULT_INTERVAL 10
+
 static char ver_buf[256];
 static char *version = ver_buf;
 
 static bool verbose;
+static bool idle_hist_raw;
+static bool thread_mode;
+/* The thread mode launch time and the time the thread ran after it (in ns). */
+static u64 thread_ltime;
+static u64 thread_ts;
 static int perf_ev_amt;
+static volatile sig_atomic_t exit_requested;
 
 static const struct option long_options[] = {
 	{ "help", no_argument, NULL, 'h' },
 	{ "cpu", required_argument, NULL, 'c' },
+	{ "daemon", no_argument, NULL, 'D' },
 	{ "debug", no_argument, NULL, 'd' },
+	{ "interval", required_argument, NULL, 'i' },
 	{ "ldist", required_argument, NULL, 'l' },
+	{ "output", required_argument, NULL, 'o' },
+	{ "perf-event", required_argument, NULL, 'e' },
+	{ "idle-hist-raw", no_argument, NULL, 'r' },
+	{ "thread", no_argument, NULL, 't' },
 	{ "version", no_argument, NULL, 'v' },
 	{ 0 },
 };
@@ -44,6 +70,7 @@ static const char *output_vars[] = {
 	"LTime",
 	"LDist",
 	"ReqCState",
+	"EntCState",
 	"TBI",
 	"TAI",
 	"TIntr",
@@ -54,6 +81,12 @@ static const char *output_vars[] = {
 	"TotCyc",
 	"SMICnt",
 	"CC0Cyc",
+	"IdleHistCnt",
+	"IdleHistLast",
+	"IdleHistMin",
+	"IdleHistMax",
+	"IdleHistAvg",
+	"IdleHistWult",
 };
 
 enum {
@@ -65,12 +98,16 @@ enum {
 	WULTRUNNER_PERF_EVENT_MSR,
 	WULTRUNNER_PERF_EVENT_CORE,
 	WULTRUNNER_PERF_EVENT_PKG,
+	WULTRUNNER_PERF_EVENT_USER,
 };
 
+#define PERF_EVENT_NAME_LEN 64
+
 struct pmu_cfg {
 	struct perf_event_attr attr;
 	int type;
 	int index;
+	char name[PERF_EVENT_NAME_LEN];
 };
 
 #define CORE_STATE_AMT 4
@@ -92,6 +129,10 @@ static const int pkg_indices[PKG_STATE_AMT] = {
 
 static struct pmu_cfg pmu_configs[WULTRUNNER_NUM_PERF_COUNTERS];
 
+/* User-specified perf event specifications from the command line */
+static const char *user_events[WULTRUNNER_NUM_PERF_COUNTERS];
+static int user_ev_amt;
+
 static int _parse_perf_events(int type)
 {
 	const int *indices;
@@ -213,22 +254,316 @@ static int parse_perf_events(void)
 	return err;
 }
 
+static int read_sysfs_line(const char *fname, char *buf, size_t bufsize)
+{
+	FILE *file;
+	char *nl;
+
+	file = fopen(fname, "r");
+	if (!file)
+		return -1;
+
+	if (!fgets(buf, bufsize, file)) {
+		fclose(file);
+		return -1;
+	}
+
+	fclose(file);
+
+	nl = strchr(buf, '\n');
+	if (nl)
+		*nl = 0;
+
+	return 0;
+}
+
+/*
+ * Encode a single 'term=val' perf event term into 'attr'. The term format is
+ * described in the PMU 'format' sysfs directory, e.g. 'config:0-7' or
+ * 'config1:0-15,32-35'.
+ */
+static int encode_perf_term(const char *pmu, const char *term, u64 val,
+			    struct perf_event_attr *attr)
+{
+	char fname[BUFSIZ];
+	char buf[BUFSIZ];
+	char *ranges;
+	char *range;
+	char *saveptr;
+	u64 *target;
+	u64 mask;
+	int lo, hi;
+
+	snprintf(fname, BUFSIZ, "/sys/bus/event_source/devices/%s/format/%s",
+		 pmu, term);
+	if (read_sysfs_line(fname, buf, BUFSIZ)) {
+		errmsg("Unknown term '%s' for PMU '%s'", term, pmu);
+		return -1;
+	}
+
+	ranges = strchr(buf, ':');
+	if (!ranges) {
+		errmsg("Bad format '%s' in %s", buf, fname);
+		return -1;
+	}
+	*ranges++ = 0;
+
+	if (!strcmp(buf, "config")) {
+		target = (u64 *)&attr->config;
+	} else if (!strcmp(buf, "config1")) {
+		target = (u64 *)&attr->config1;
+	} else if (!strcmp(buf, "config2")) {
+		target = (u64 *)&attr->config2;
+	} else {
+		errmsg("Unsupported format field '%s' in %s", buf, fname);
+		return -1;
+	}
+
+	for (range = strtok_r(ranges, ",", &saveptr); range;
+	     range = strtok_r(NULL, ",", &saveptr)) {
+		if (sscanf(range, "%d-%d", &lo, &hi) < 2)
+			hi = lo = atoi(range);
+
+		if (lo < 0 || hi > 63 || hi < lo) {
+			errmsg("Bad bit range '%s' in %s", range, fname);
+			return -1;
+		}
+
+		mask = hi - lo == 63 ? ~0ULL : (1ULL << (hi - lo + 1)) - 1;
+		*target |= (val & mask) << lo;
+		val = hi - lo == 63 ? 0 : val >> (hi - lo + 1);
+	}
+
+	return 0;
+}
+
+/*
+ * Check if 'name' is the name of a CSV column printed by wultrunner itself, or
+ * of an already added user perf event.
+ */
+static bool is_reserved_field(const char *name)
+{
+	unsigned int idx;
+	int pos = 0;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(output_vars); i++)
+		if (!strcmp(name, output_vars[i]))
+			return true;
+
+	/* The C-state cycle counters: 'CC<n>Cyc' and 'PC<n>Cyc'. */
+	if ((name[0] == 'C' || name[0] == 'P') && name[1] == 'C' &&
+	    sscanf(name + 2, "%u%n", &idx, &pos) == 1 && !strcmp(name + 2 + pos, "Cyc"))
+		return true;
+
+	/* The raw idle history and the thread mode columns. */
+	if (!strncmp(name, "IdleHist", 8) || !strcmp(name, "TThread"))
+		return true;
+
+	for (i = 0; i < perf_ev_amt; i++)
+		if (pmu_configs[i].type == WULTRUNNER_PERF_EVENT_USER &&
+		    !strcmp(name, pmu_configs[i].name))
+			return true;
+
+	return false;
+}
+
+/*
+ * Parse a user perf event specification and add it to 'pmu_configs'. The
+ * specification format is 'NAME=SPEC', where 'NAME' is the CSV column name
+ * and 'SPEC' is one of:
+ *   - 'PMU/TERMS', where 'TERMS' is a comma-separated list of 'term=val'
+ *     (e.g., 'cpu/event=0x2e,umask=0x41');
+ *   - 'PMU/ALIAS', where 'ALIAS' is an event name from the PMU 'events'
+ *     sysfs directory (e.g., 'cpu/cache-misses');
+ *   - 'TYPE:CONFIG', raw numeric perf event type and config values.
+ */
+static int parse_user_perf_event(const char *spec)
+{
+	struct pmu_cfg *pmu_config = &pmu_configs[perf_ev_amt];
+	struct perf_event_attr *attr = &pmu_config->attr;
+	char fname[BUFSIZ];
+	char buf[BUFSIZ];
+	char terms[BUFSIZ];
+	char *pmu;
+	char *term;
+	char *eq;
+	char *saveptr;
+	unsigned long long val;
+	unsigned int pmu_type;
+
+	if (perf_ev_amt == WULTRUNNER_NUM_PERF_COUNTERS) {
+		errmsg("Out of perf counter storage, increase WULTRUNNER_NUM_PERF_COUNTERS.");
+		return -1;
+	}
+
+	snprintf(buf, BUFSIZ, "%s", spec);
+
+	eq = strchr(buf, '=');
+	if (!eq || eq == buf || eq - buf >= PERF_EVENT_NAME_LEN ||
+	    memchr(buf, ',', eq - buf)) {
+		errmsg("Bad perf event '%s', expected 'NAME=SPEC'", spec);
+		return -1;
+	}
+	*eq++ = 0;
+
+	if (is_reserved_field(buf)) {
+		errmsg("Bad perf event '%s': name '%s' is already used by another CSV column",
+		       spec, buf);
+		return -1;
+	}
+
+	memset(pmu_config, 0, sizeof(*pmu_config));
+	snprintf(pmu_config->name, PERF_EVENT_NAME_LEN, "%s", buf);
+	pmu_config->type = WULTRUNNER_PERF_EVENT_USER;
+	attr->size = sizeof(*attr);
+
+	if (sscanf(eq, "%u:%lli", &pmu_type, &val) == 2) {
+		attr->type = pmu_type;
+		attr->config = val;
+		goto out;
+	}
+
+	pmu = eq;
+	term = strchr(pmu, '/');
+	if (!term) {
+		errmsg("Bad perf event '%s', expected 'PMU/TERMS' or 'TYPE:CONFIG'",
+		       spec);
+		return -1;
+	}
+	*term++ = 0;
+
+	snprintf(fname, BUFSIZ, "/sys/bus/event_source/devices/%s/type", pmu);
+	if (read_sysfs_line(fname, terms, BUFSIZ)) {
+		errmsg("Unable to find perf event_source '%s'", pmu);
+		return -1;
+	}
+	attr->type = atol(terms);
+
+	/* No '=' means an event alias, read its terms from sysfs */
+	if (strchr(term, '=')) {
+		snprintf(terms, BUFSIZ, "%s", term);
+	} else {
+		snprintf(fname, BUFSIZ, "/sys/bus/event_source/devices/%s/events/%s",
+			 pmu, term);
+		if (read_sysfs_line(fname, terms, BUFSIZ)) {
+			errmsg("Unknown event '%s' for PMU '%s'", term, pmu);
+			return -1;
+		}
+	}
+
+	for (term = strtok_r(terms, ",", &saveptr); term;
+	     term = strtok_r(NULL, ",", &saveptr)) {
+		eq = strchr(term, '=');
+		if (eq) {
+			*eq++ = 0;
+			val = strtoull(eq, NULL, 0);
+		} else {
+			/* Flag terms, such as 'edge', have no value */
+			val = 1;
+		}
+
+		if (encode_perf_term(pmu, term, val, attr))
+			return -1;
+	}
+
+out:
+	verbose("Created PMU config[%d]: name=%s, type=%d, cfg=%lld",
+		perf_ev_amt, pmu_config->name, attr->type, attr->config);
+
+	perf_ev_amt++;
+	return 0;
+}
+
+static int parse_user_perf_events(void)
+{
+	int i;
+
+	for (i = 0; i < user_ev_amt; i++) {
+		if (parse_user_perf_event(user_events[i]))
+			return -1;
+	}
+
+	return 0;
+}
+
 static void usage(void)
 {
 	extern const char *__progname;
 
-	printf("Usage: %s [--help] [--cpu <num>] [--timeout <range>]\n",
+	printf("Usage: %s [--help] [--cpu <num>] [--timeout <range>] [--daemon]\n",
 	       __progname);
 
 	printf("\nOptions:\n");
 	printf("    --help, -h		this help\n");
 	printf("    --cpu, -c <num>	run on CPU <num>\n");
+	printf("    --daemon, -D	run in daemon mode: instead of printing every\n");
+	printf("			datapoint, aggregate per-C-state wake latency\n");
+	printf("			histograms and periodically save snapshots\n");
 	printf("    --debug		enable debug\n");
+	printf("    --idle-hist-raw, -r	print the raw idle history in addition to its\n");
+	printf("			summary: the last %d idle durations in the\n",
+	       WULTRUNNER_IDLE_HIST_LEN);
+	printf("			'IdleHist<n>' columns, most recent first, and the\n");
+	printf("			'IdleHistWultMask' column with bit 'n-1' set if\n");
+	printf("			'IdleHist<n>' was ended by the wult timer\n");
+	printf("    --interval, -i <sec>	daemon mode snapshot interval in seconds\n");
+	printf("			(default %d)\n", DAEMON_DEFAULT_INTERVAL);
 	printf("    --ldist, -l <range>	timeout range (e.g. 100,200) in ns.\n");
+	printf("    --output, -o <path>	daemon mode snapshot file path, the file is\n");
+	printf("			atomically replaced on every snapshot\n");
+	printf("			(default: print snapshots to stdout)\n");
+	printf("    --thread, -t	measure the wake latency of a user thread: arm a\n");
+	printf("			'timerfd' timer instead of the eBPF timer, sleep\n");
+	printf("			on it, and print the time the thread ran after\n");
+	printf("			the timer expired in the 'TThread' CSV column\n");
+	printf("    --perf-event, -e <NAME=SPEC>\n");
+	printf("			read a perf event on idle entry and exit and\n");
+	printf("			print the delta in the 'NAME' CSV column. 'SPEC'\n");
+	printf("			is 'PMU/term=val,...' (e.g. 'cpu/event=0x2e,umask=0x41'),\n");
+	printf("			'PMU/alias' (e.g. 'cpu/cache-misses') or\n");
+	printf("			'TYPE:CONFIG'. Can be used multiple times.\n");
 	printf("    --version		print version info and exit (both program version\n");
 	printf("			and linux kernel against which this tool was built)\n");
 }
 
+/*
+ * Print the idle history summary, or the raw idle history if 'raw' is true.
+ * The history is printed from the most recent idle period to the oldest one.
+ */
+static void print_idle_hist(const struct bpf_event *e, bool raw)
+{
+	u64 dur[WULTRUNNER_IDLE_HIST_LEN] = { 0 };
+	u64 min = 0, max = 0, sum = 0;
+	u32 wult_mask = 0;
+	u32 i, idx, wult_cnt = 0;
+
+	for (i = 0; i < e->idle_hist_cnt; i++) {
+		idx = (e->idle_hist_idx - 1 - i) & (WULTRUNNER_IDLE_HIST_LEN - 1);
+		dur[i] = e->idle_hist[idx];
+		if (e->idle_hist_wult & (1 << idx)) {
+			wult_mask |= 1 << i;
+			wult_cnt++;
+		}
+
+		if (i == 0 || dur[i] < min)
+			min = dur[i];
+		if (dur[i] > max)
+			max = dur[i];
+		sum += dur[i];
+	}
+
+	if (raw) {
+		for (i = 0; i < WULTRUNNER_IDLE_HIST_LEN; i++)
+			printf("%lu,", dur[i]);
+		printf("%u,", wult_mask);
+		return;
+	}
+
+	printf("%u,%lu,%lu,%lu,%lu,%u,", e->idle_hist_cnt, dur[0], min, max,
+	       e->idle_hist_cnt ? sum / e->idle_hist_cnt : 0, wult_cnt);
+}
+
 static int handle_rb_event(void *ctx, void *data, size_t sz)
 {
 	const struct bpf_event *e = data;
@@ -238,12 +573,19 @@ static int handle_rb_event(void *ctx, void *data, size_t sz)
 	if (e->type == HRT_EVENT_PING)
 		return 0;
 
-	printf("%lu,%d,%d,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,",
-		e->ltime, e->ldist, e->req_cstate, e->tbi, e->tai, e->tintr,
+	/* Skip stale events the thread did not measure. */
+	if (thread_mode && e->ltime != thread_ltime)
+		return 0;
+
+	printf("%lu,%d,%d,%d,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,",
+		e->ltime, e->ldist, e->req_cstate, e->ent_cstate, e->tbi,
+		e->tai, e->tintr,
 		e->aits1, e->aits2, e->intrts1, e->intrts2,
 		e->aic - e->bic, e->perf_counters[MSR_SMI],
 		e->perf_counters[MSR_MPERF]);
 
+	print_idle_hist(e, false);
+
 	/*
 	 * Print out perf events, index 0..n are generic MSR events and
 	 * are only used by the BPF program itself, so don't print these
@@ -252,6 +594,12 @@ static int handle_rb_event(void *ctx, void *data, size_t sz)
 	for (i = MSR_EVENT_COUNT; i < perf_ev_amt; i++)
 		printf("%ld,", e->perf_counters[i]);
 
+	if (idle_hist_raw)
+		print_idle_hist(e, true);
+
+	if (thread_mode)
+		printf("%lu,", thread_ts);
+
 	printf("\n");
 
 	return 0;
@@ -290,6 +638,199 @@ static int get_command(char *buf, size_t bufsize)
 	return CMD_NONE;
 }
 
+/*
+ * Returns 'true' if a cpuidle driver is registered. Without it, 'cpuidle_enter()'
+ * is never called and the entered C-state cannot be tracked.
+ */
+static bool have_cpuidle_driver(void)
+{
+	char buf[BUFSIZ];
+
+	if (read_sysfs_line("/sys/devices/system/cpu/cpuidle/current_driver",
+			    buf, BUFSIZ))
+		return false;
+
+	return strcmp(buf, "none") != 0;
+}
+
+static void handle_signal(int sig)
+{
+	exit_requested = 1;
+}
+
+/*
+ * Save a snapshot of the latency histograms to 'path', or to stdout if 'path'
+ * is NULL. The counters are cumulative since the start of the daemon. The file
+ * is written under a temporary name and then renamed, so that readers never
+ * see a partially written snapshot.
+ */
+static int save_snapshot(int hist_fd, const char *path)
+{
+	char tmp_path[PATH_MAX];
+	struct timespec ts;
+	FILE *f = stdout;
+	u64 count;
+	u64 from;
+	u64 to;
+	u32 key;
+	int cstate;
+	int bucket;
+
+	if (path) {
+		snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+		f = fopen(tmp_path, "w");
+		if (!f) {
+			syserrmsg("failed to open '%s'", tmp_path);
+			return -1;
+		}
+	}
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+
+	fprintf(f, "Timestamp,CState,LatencyFrom,LatencyTo,Count\n");
+
+	for (cstate = 0; cstate < WULTRUNNER_MAX_CSTATES; cstate++) {
+		for (bucket = 0; bucket < WULTRUNNER_HIST_BUCKETS; bucket++) {
+			key = cstate * WULTRUNNER_HIST_BUCKETS + bucket;
+			if (bpf_map_lookup_elem(hist_fd, &key, &count) || !count)
+				continue;
+
+			from = bucket ? 1ULL << bucket : 0;
+			to = 1ULL << (bucket + 1);
+			fprintf(f, "%ld,%d,%lu,%lu,%lu\n", ts.tv_sec, cstate,
+				from, to, count);
+		}
+	}
+
+	if (!path) {
+		fflush(f);
+		return 0;
+	}
+
+	if (fclose(f)) {
+		syserrmsg("failed to write '%s'", tmp_path);
+		return -1;
+	}
+
+	if (rename(tmp_path, path)) {
+		syserrmsg("failed to rename '%s' to '%s'", tmp_path, path);
+		return -1;
+	}
+
+	return 0;
+}
+
+static u64 get_monotonic_sec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec;
+}
+
+/* Returns the boot time in nanoseconds, same as 'bpf_ktime_get_boot_ns()'. */
+static u64 get_boottime_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_BOOTTIME, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * The thread mode main loop. Arm a 'timerfd' timer, sleep on it, and time
+ * stamp the moment this thread runs after the timer expires. The BPF program
+ * sends the idle and the interrupt data for the same launch time before the
+ * thread gets to run, so they are printed together.
+ */
+static int run_thread(struct ring_buffer *event_rb, struct bpf_hrt *skel,
+		      const struct bpf_args *args)
+{
+	struct itimerspec its = { 0 };
+	char buf[BUFSIZ];
+	u64 expirations;
+	u32 ldist;
+	int tfd;
+	int err = 0;
+
+	tfd = timerfd_create(CLOCK_BOOTTIME, 0);
+	if (tfd < 0) {
+		syserrmsg("failed to create a timerfd timer");
+		return -1;
+	}
+
+	while (get_command(buf, BUFSIZ) != CMD_EXIT) {
+		ldist = args->min_t;
+		if (args->max_t > args->min_t)
+			ldist += random() % (args->max_t - args->min_t);
+
+		/* The BPF program has to know the launch time before the timer is armed. */
+		thread_ltime = get_boottime_ns() + ldist;
+		skel->bss->ldist = ldist;
+		skel->bss->ltime = thread_ltime;
+
+		its.it_value.tv_sec = thread_ltime / 1000000000ULL;
+		its.it_value.tv_nsec = thread_ltime % 1000000000ULL;
+		if (timerfd_settime(tfd, TFD_TIMER_ABSTIME, &its, NULL)) {
+			syserrmsg("failed to arm the timerfd timer");
+			err = -1;
+			break;
+		}
+
+		if (read(tfd, &expirations, sizeof(expirations)) < 0) {
+			if (errno == EINTR)
+				continue;
+			syserrmsg("failed to read the timerfd timer");
+			err = -1;
+			break;
+		}
+
+		thread_ts = get_boottime_ns();
+
+		err = ring_buffer__consume(event_rb);
+		if (err < 0) {
+			errmsg("ring_buffer__consume: error=%d", err);
+			break;
+		}
+		err = 0;
+	}
+
+	close(tfd);
+	return err;
+}
+
+/*
+ * The daemon mode main loop. The BPF program does not send datapoints in this
+ * mode, but the ring buffer still has to be polled, because it carries the
+ * wake-up pings for the polling idle state.
+ */
+static int run_daemon(struct ring_buffer *event_rb, int hist_fd,
+		      int interval, const char *path)
+{
+	u64 next;
+	int err;
+
+	signal(SIGINT, handle_signal);
+	signal(SIGTERM, handle_signal);
+
+	next = get_monotonic_sec() + interval;
+
+	while (!exit_requested) {
+		err = ring_buffer__poll(event_rb, interval * 1000);
+		if (err < 0 && err != -EINTR)
+			errmsg("ring_buffer__poll: error=%d", err);
+
+		if (get_monotonic_sec() < next)
+			continue;
+
+		if (save_snapshot(hist_fd, path))
+			return -1;
+		next = get_monotonic_sec() + interval;
+	}
+
+	return save_snapshot(hist_fd, path);
+}
+
 int main(int argc, char **argv)
 {
 	int err = 0;
@@ -299,6 +840,10 @@ int main(int argc, char **argv)
 	int count;
 	u32 value;
 	struct bpf_args args = { .min_t = 1000, .max_t = 4000000 };
+	bool ldist_set = false;
+	bool daemon = false;
+	int interval = DAEMON_DEFAULT_INTERVAL;
+	const char *output = NULL;
 	int opt;
 	int fd;
 	int pmu_fd;
@@ -315,20 +860,47 @@ int main(int argc, char **argv)
 			.ctx_size_in = sizeof(args),
 	);
 
-	while ((opt = getopt_long(argc, argv, "hdc:l:v", long_options,
+	while ((opt = getopt_long(argc, argv, "hdc:De:i:l:o:rtv", long_options,
 				  NULL)) != -1) {
 		switch (opt) {
 		case 'c':
 			cpu = atol(optarg);
 			break;
+		case 'D':
+			daemon = true;
+			break;
 		case 'd':
 			verbose = true;
 			break;
+		case 'e':
+			if (user_ev_amt == WULTRUNNER_NUM_PERF_COUNTERS) {
+				errmsg("Too many perf events.");
+				exit(1);
+			}
+			user_events[user_ev_amt++] = optarg;
+			break;
+		case 'i':
+			interval = atol(optarg);
+			if (interval <= 0) {
+				errmsg("Bad snapshot interval: %s", optarg);
+				exit(1);
+			}
+			break;
 		case 'l':
 			if (sscanf(optarg, "%d,%d", &args.min_t, &args.max_t) < 2) {
 				errmsg("Failed to parse ldist range: %s", optarg);
 				exit(1);
 			}
+			ldist_set = true;
+			break;
+		case 'o':
+			output = optarg;
+			break;
+		case 'r':
+			idle_hist_raw = true;
+			break;
+		case 't':
+			thread_mode = true;
 			break;
 		case 'v':
 			/*
@@ -371,8 +943,27 @@ int main(int argc, char **argv)
 		exit(err);
 	}
 
-	/* Check available perf counters */
-	parse_perf_events();
+	if (daemon && thread_mode) {
+		errmsg("The daemon mode and the thread mode are mutually exclusive.");
+		exit(1);
+	}
+
+	if (daemon && user_ev_amt) {
+		errmsg("Perf events are not supported in the daemon mode.");
+		exit(1);
+	}
+
+	if (daemon && !ldist_set) {
+		args.min_t = DAEMON_DEFAULT_MIN_LDIST;
+		args.max_t = DAEMON_DEFAULT_MAX_LDIST;
+	}
+
+	/* Check available perf counters, they are not used in daemon mode */
+	if (!daemon) {
+		parse_perf_events();
+		if (parse_user_perf_events())
+			exit(1);
+	}
 
 	skel = bpf_hrt__open();
 	if (!skel) {
@@ -381,6 +972,18 @@ int main(int argc, char **argv)
 	}
 
 	skel->rodata->cpu_num = cpu;
+	skel->rodata->daemon_mode = daemon;
+	skel->rodata->track_entered = have_cpuidle_driver();
+	if (!skel->rodata->track_entered)
+		bpf_program__set_autoload(skel->progs.bpf_hrt_cpuidle_enter_exit,
+					  false);
+	verbose("Entered C-state tracking: %s",
+		skel->rodata->track_entered ? "on" : "off");
+
+	skel->rodata->thread_mode = thread_mode;
+	if (!thread_mode)
+		bpf_program__set_autoload(skel->progs.bpf_hrt_hrtimer_expire_entry,
+					  false);
 
 	verbose("Updated min_t to %d", args.min_t);
 	verbose("Updated max_t to %d", args.max_t);
@@ -399,6 +1002,26 @@ int main(int argc, char **argv)
 		goto cleanup;
 	}
 
+	if (skel->rodata->track_entered) {
+		skel->links.bpf_hrt_cpuidle_enter_exit =
+			bpf_program__attach(skel->progs.bpf_hrt_cpuidle_enter_exit);
+		if (!skel->links.bpf_hrt_cpuidle_enter_exit) {
+			errmsg("BPF program attach failed for cpuidle_enter");
+			err = 1;
+			goto cleanup;
+		}
+	}
+
+	if (thread_mode) {
+		skel->links.bpf_hrt_hrtimer_expire_entry =
+			bpf_program__attach(skel->progs.bpf_hrt_hrtimer_expire_entry);
+		if (!skel->links.bpf_hrt_hrtimer_expire_entry) {
+			errmsg("BPF program attach failed for hrtimer_expire_entry");
+			err = 1;
+			goto cleanup;
+		}
+	}
+
 	err = perf_map_fd = bpf_map__fd(skel->maps.perf);
 	if (err < 0) {
 		errmsg("Unable to find 'perf' map.");
@@ -455,6 +1078,18 @@ int main(int argc, char **argv)
 		goto cleanup;
 	}
 
+	if (daemon) {
+		fd = bpf_map__fd(skel->maps.hist);
+		if (fd < 0) {
+			errmsg("Unable to find 'hist' map.");
+			err = fd;
+			goto cleanup;
+		}
+
+		err = run_daemon(event_rb, fd, interval, output);
+		goto cleanup;
+	}
+
 	for (i = 0; i < ARRAY_SIZE(output_vars); i++)
 		printf("%s,", output_vars[i]);
 
@@ -471,9 +1106,21 @@ int main(int argc, char **argv)
 		case WULTRUNNER_PERF_EVENT_PKG:
 			printf("PC%dCyc,", pmu_configs[i].index);
 			break;
+		case WULTRUNNER_PERF_EVENT_USER:
+			printf("%s,", pmu_configs[i].name);
+			break;
 		}
 	}
 
+	if (idle_hist_raw) {
+		for (i = 0; i < WULTRUNNER_IDLE_HIST_LEN; i++)
+			printf("IdleHist%d,", i + 1);
+		printf("IdleHistWultMask,");
+	}
+
+	if (thread_mode)
+		printf("TThread,");
+
 	printf("\n");
 
 	if (setvbuf(stdout, NULL, _IOLBF, 0) || setvbuf(stdin, NULL, _IOLBF, 0)) {
@@ -488,6 +1135,11 @@ int main(int argc, char **argv)
 		goto cleanup;
 	}
 
+	if (thread_mode) {
+		err = run_thread(event_rb, skel, &args);
+		goto cleanup;
+	}
+
 	while (1) {
 		/*
 		 * Following function is called ring_buffer__poll but it is
@@ -30,7 +30,22 @@ typedef uint32_t u32;
 				##__VA_ARGS__, strerror(errno)); \
 	} while (0)
 
-#define WULTRUNNER_NUM_PERF_COUNTERS 16
+#define WULTRUNNER_NUM_PERF_COUNTERS 32
+
+/*
+ * Daemon mode latency histograms: one row of log2 buckets per requested
+ * C-state index. Bucket 'n' counts wake latencies in the [2^n, 2^(n+1)) ns
+ * range, except for bucket 0, which counts the [0, 2) ns range. The last bucket
+ * also accumulates everything above it.
+ */
+#define WULTRUNNER_MAX_CSTATES 16
+#define WULTRUNNER_HIST_BUCKETS 32
+
+/*
+ * Count of the last idle periods of the measured CPU kept in the idle history.
+ * Must be a power of 2.
+ */
+#define WULTRUNNER_IDLE_HIST_LEN 8
 
 enum {
 	MSR_TSC,
@@ -59,7 +74,13 @@ enum {
  * @intrts1: time at hrtimer interrupt #1
  * @intrts2: time at hrtimer interrupt #2
  * @req_cstate: requested cstate
+ * @ent_cstate: entered cstate
  * @perf_counters: contents of requested perf counters
+ * @idle_hist: durations of the last idle periods (in ns)
+ * @idle_hist_idx: index of the next @idle_hist slot to use
+ * @idle_hist_cnt: count of used @idle_hist slots
+ * @idle_hist_wult: bit 'n' is set if @idle_hist slot 'n' idle period was
+ *		    ended by the wult timer
  */
 struct bpf_event {
 	u8 type;
@@ -75,7 +96,12 @@ struct bpf_event {
 	u64 intrts1;
 	u64 intrts2;
 	int req_cstate;
+	int ent_cstate;
 	u64 perf_counters[WULTRUNNER_NUM_PERF_COUNTERS];
+	u64 idle_hist[WULTRUNNER_IDLE_HIST_LEN];
+	u32 idle_hist_idx;
+	u32 idle_hist_cnt;
+	u32 idle_hist_wult;
 };
 
 struct bpf_args {
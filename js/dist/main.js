@@ -734,7 +734,7 @@
         <circle class="spinner__track"></circle>
         <circle class="spinner__indicator"></circle>
       </svg>
-    `}};Js.styles=Zs,Js=vt([De("sl-spinner")],Js);class Gs extends ot{static styles=r`
+    `}};Js.styles=Zs,Js=vt([De("sl-spinner")],Js);const Gh=new Map;function Gf(t){return Gh.has(t)||Gh.set(t,fetch(t).then((t=>t.json()))),Gh.get(t)}class Gs extends ot{static styles=r`
     .plot {
         position: relative;
         height: 100%;
@@ -745,18 +745,34 @@
         height: 100%;
         width: 100%;
     }
+    .error {
+        font-family: Arial, sans-serif;
+    }
+    .details {
+        position: absolute;
+        top: 40px;
+        right: 10px;
+        z-index: 10;
+        padding: 5px;
+        font-family: Arial, sans-serif;
+        font-size: 13px;
+        background: #E2E2E2;
+        border: 1px solid #FFFFFF;
+        pointer-events: none;
+    }
     .loading {
         display: flex;
         justify-content: center;
         padding: 5% 0%;
         font-size: 15vw;
     }
-  `;static properties={path:{type:String},_visible:{type:Boolean,state:!0}};connectedCallback(){super.connectedCallback(),this.observer=new IntersectionObserver(((t,e)=>{t.forEach((t=>{t.isIntersecting?this._visible=!0:this._visible=!1}))})),this.observer.observe(this.parentElement)}disconnectedCallback(){super.disconnectedCallback(),this.observer.disconnect()}constructor(){super(),this._visible=!1}hideLoading(){this.renderRoot.querySelector("#loading").style.display="none"}render(){return this._visible?H`
+  `;static properties={path:{type:String},_visible:{type:Boolean,state:!0},_error:{type:String,state:!0},_details:{type:Array,state:!0}};connectedCallback(){super.connectedCallback(),this.observer=new IntersectionObserver(((t,e)=>{t.forEach((t=>{t.isIntersecting?this._visible=!0:this._visible=!1}))})),this.observer.observe(this.parentElement)}disconnectedCallback(){super.disconnectedCallback(),this.observer.disconnect()}constructor(){super(),this._visible=!1,this._spec=void 0,this._details=void 0}async showDetails(t){const e=t.points[0],s=e.data.meta;if(!s||!s.hover_data||void 0===e.customdata)return;const o=e.customdata;try{const t=await Gf(`${s.hover_data}/info.json`),e=Math.floor(o/t.chunk_size),i=(await Gf(`${s.hover_data}/${e}.json`))[o];if(!i)return;this._details=t.metrics.map((([t,e],s)=>`${t}: ${i[s]}`))}catch(t){this._details=[`Failed to load hover data: ${t}`]}}hideLoading(){const t=this.renderRoot.querySelector("#loading");t&&(t.style.display="none")}adoptPlotlyStyles(){if(!this.renderRoot.querySelector('style[id^="plotly.js-style"]'))for(const t of document.querySelectorAll('style[id^="plotly.js-style"]'))this.renderRoot.appendChild(t.cloneNode(!0))}async plot(){try{this._spec||(this._spec=await(await fetch(this.path)).json());const t=this.renderRoot.querySelector("#frame");if(!t)return;await window.Plotly.newPlot(t,this._spec.data,this._spec.layout,{showLink:!1,responsive:!0}),this.adoptPlotlyStyles(),t.on("plotly_hover",(t=>this.showDetails(t))),t.on("plotly_unhover",(()=>{this._details=void 0}))}catch(t){this._error=`Failed to render diagram '${this.path}': ${t}`}this.hideLoading()}updated(t){t.has("_visible")&&this._visible&&this.plot()}render(){return this._error?H`<p class="error">${this._error}</p>`:this._visible?H`
                 <div id="loading" class="loading">
                     <sl-spinner></sl-spinner>
                 </div>
                 <div class="plot">
-                    <iframe @load=${this.hideLoading} seamless frameborder="0" scrolling="no" class="frame" src="${this.path}"></iframe>
+                    <div id="frame" class="frame"></div>
+                    ${this._details?H`<div class="details">${this._details.map((t=>H`${t}<br>`))}</div>`:H``}
                 </div>
             `:H``}}customElements.define("sc-diagram",Gs);var Qs=class extends Event{constructor(t){super("formdata"),this.formData=t}},to=class extends FormData{constructor(t){var e=(...t)=>{super(...t)};t?(e(t),this.form=t,t.dispatchEvent(new Qs(this))):e()}append(t,e){if(!this.form)return super.append(t,e);let s=this.form.elements[t];if(s||(s=document.createElement("input"),s.type="hidden",s.name=t,this.form.appendChild(s)),this.has(t)){const o=this.getAll(t),i=o.indexOf(s.value);-1!==i&&o.splice(i,1),o.push(e),this.set(t,o)}else super.append(t,e);s.value=e}};function eo(){window.FormData&&!function(){const t=document.createElement("form");let e=!1;return document.body.append(t),t.addEventListener("submit",(t=>{new FormData(t.target),t.preventDefault()})),t.addEventListener("formdata",(()=>e=!0)),t.dispatchEvent(new Event("submit",{cancelable:!0})),t.remove(),e}()&&(window.FormData=to,window.addEventListener("submit",(t=>{t.defaultPrevented||new FormData(t.target)})))}"complete"===document.readyState?eo():window.addEventListener("DOMContentLoaded",(()=>eo()));var so=new WeakMap,oo=Ft`
   ${Ne}
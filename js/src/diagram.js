@@ -11,8 +11,25 @@
 import { LitElement, html, css } from 'lit'
 import '@shoelace-style/shoelace/dist/components/spinner/spinner.js'
 
+// Hover data files fetched so far, shared by all diagrams. Maps file path to a promise of the
+// parsed file contents.
+const hoverFiles = new Map()
+
+/**
+ * Fetches and returns the JSON file at 'path', every file is fetched only once.
+ * @param {String} path - path to the JSON file.
+ */
+function fetchHoverFile (path) {
+    if (!hoverFiles.has(path)) {
+        hoverFiles.set(path, fetch(path).then((resp) => resp.json()))
+    }
+    return hoverFiles.get(path)
+}
+
 /**
- * Responsible for creating a 'div' element containing a plot.
+ * Responsible for creating a 'div' element containing a plot. Diagrams are stored as plotly JSON
+ * specifications ('data' and 'layout') and rendered with the plotly library, which is loaded once
+ * for the whole report.
  * @class ScDiagram
  * @extends {LitElement}
  */
@@ -28,6 +45,21 @@ class ScDiagram extends LitElement {
         height: 100%;
         width: 100%;
     }
+    .error {
+        font-family: Arial, sans-serif;
+    }
+    .details {
+        position: absolute;
+        top: 40px;
+        right: 10px;
+        z-index: 10;
+        padding: 5px;
+        font-family: Arial, sans-serif;
+        font-size: 13px;
+        background: #E2E2E2;
+        border: 1px solid #FFFFFF;
+        pointer-events: none;
+    }
     .loading {
         display: flex;
         justify-content: center;
@@ -38,7 +70,9 @@ class ScDiagram extends LitElement {
 
     static properties = {
         path: { type: String },
-        _visible: { type: Boolean, state: true }
+        _visible: { type: Boolean, state: true },
+        _error: { type: String, state: true },
+        _details: { type: Array, state: true }
     };
 
     /**
@@ -72,24 +106,105 @@ class ScDiagram extends LitElement {
     constructor () {
         super()
         this._visible = false
+        this._spec = undefined
+        this._details = undefined
     }
 
     /**
-     * Hides the loading indicator once the diagram 'iframe' has finished loading. Intended to be
-     * called when a 'load' event is detected.
+     * Looks up hover text details of the hovered datapoint in the hover data files of the result
+     * and shows them. Scatter plot traces carry the datapoint index in 'customdata' and the hover
+     * data directory path in 'meta.hover_data'.
+     * @param {Object} event - the 'plotly_hover' event data.
+     */
+    async showDetails (event) {
+        const point = event.points[0]
+        const meta = point.data.meta
+        if (!meta || !meta.hover_data || point.customdata === undefined) {
+            return
+        }
+
+        const idx = point.customdata
+        try {
+            const info = await fetchHoverFile(`${meta.hover_data}/info.json`)
+            const chunkNum = Math.floor(idx / info.chunk_size)
+            const chunk = await fetchHoverFile(`${meta.hover_data}/${chunkNum}.json`)
+            const vals = chunk[idx]
+            if (!vals) {
+                return
+            }
+            this._details = info.metrics.map(([title, _], i) => `${title}: ${vals[i]}`)
+        } catch (err) {
+            this._details = [`Failed to load hover data: ${err}`]
+        }
+    }
+
+    /**
+     * Hides the loading indicator once the diagram has been rendered.
      */
     hideLoading () {
-        this.renderRoot.querySelector('#loading').style.display = 'none'
+        const loading = this.renderRoot.querySelector('#loading')
+        if (loading) {
+            loading.style.display = 'none'
+        }
+    }
+
+    /**
+     * Plotly injects its styles (e.g. for the mode bar and hover labels) into the document head,
+     * which does not apply to the shadow DOM of this element. Copy them to the shadow root.
+     */
+    adoptPlotlyStyles () {
+        if (this.renderRoot.querySelector('style[id^="plotly.js-style"]')) {
+            return
+        }
+        for (const style of document.querySelectorAll('style[id^="plotly.js-style"]')) {
+            this.renderRoot.appendChild(style.cloneNode(true))
+        }
+    }
+
+    /**
+     * Fetches the diagram JSON specification (only once) and renders it with plotly.
+     */
+    async plot () {
+        try {
+            if (!this._spec) {
+                const resp = await fetch(this.path)
+                this._spec = await resp.json()
+            }
+            const frame = this.renderRoot.querySelector('#frame')
+            if (!frame) {
+                return
+            }
+            await window.Plotly.newPlot(frame, this._spec.data, this._spec.layout,
+                { showLink: false, responsive: true })
+            this.adoptPlotlyStyles()
+            frame.on('plotly_hover', (event) => this.showDetails(event))
+            frame.on('plotly_unhover', () => { this._details = undefined })
+        } catch (err) {
+            this._error = `Failed to render diagram '${this.path}': ${err}`
+        }
+        this.hideLoading()
+    }
+
+    updated (changedProperties) {
+        if (changedProperties.has('_visible') && this._visible) {
+            this.plot()
+        }
     }
 
     render () {
+        if (this._error) {
+            return html`<p class="error">${this._error}</p>`
+        }
         if (this._visible) {
             return html`
                 <div id="loading" class="loading">
                     <sl-spinner></sl-spinner>
                 </div>
                 <div class="plot">
-                    <iframe @load=${this.hideLoading} seamless frameborder="0" scrolling="no" class="frame" src="${this.path}"></iframe>
+                    <div id="frame" class="frame"></div>
+                    ${this._details
+                        ? html`<div class="details">${this._details.map((line) => html`${line}<br>`)}</div>`
+                        : html``}
                 </div>
             `
         }
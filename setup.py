@@ -49,7 +49,9 @@ def get_data_files(installdir, subdir, exclude=None):
     return list(files_dict.items())
 
 # Python helpers get installed as scripts. We exclude these scripts from being installed as data.
-_PYTHON_HELPERS = ["helpers/stc-agent/stc-agent", "helpers/stc-agent/ipmi-helper"]
+_PYTHON_HELPERS = ["helpers/stc-agent/stc-agent", "helpers/stc-agent/ipmi-helper",
+                   "helpers/stc-agent/stream-shim", "helpers/stc-agent/interrupts-helper",
+                   "helpers/stc-agent/ipmi-inband-helper"]
 
 setup(
     name="wult",
@@ -82,7 +82,7 @@ class DefsBase:
         """
 
         # The sub-keys to look and substitute the placeholders in.
-        mangle_subkeys = { "title", "descr", "fsname", "name" }
+        mangle_subkeys = { "title", "descr", "fsname", "name", "expr" }
 
         for pinfo in placeholders_info:
             values = pinfo["values"]
@@ -0,0 +1,28 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""This module provides an API to the interrupts statistics definitions (AKA 'defs')."""
+
+from statscollectlibs.defs import _STCDefsBase
+
+class InterruptsDefs(_STCDefsBase.STCDefsBase):
+    """This class provides an API to the interrupts statistics definitions (AKA 'defs')."""
+
+    def __init__(self, hardirqs, softirqs):
+        """
+        The class constructor. Arguments are as follows:
+         * hardirqs - a list of hardware interrupt names (e.g., "LOC" or "24") from
+                      '/proc/interrupts'.
+         * softirqs - a list of software interrupt names (e.g., "TIMER") from '/proc/softirqs'.
+        """
+
+        super().__init__("interrupts")
+
+        placeholders_info = [{"placeholder": "HNAME", "values": hardirqs},
+                             {"placeholder": "SNAME", "values": softirqs}]
+        self._mangle_placeholders(placeholders_info)
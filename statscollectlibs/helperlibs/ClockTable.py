@@ -0,0 +1,185 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides API for recording and using clock-correlation tables, and for reading the SUT
+clocks.
+
+A clock-correlation table is a CSV file where every row is a snapshot of the SUT clocks taken at
+the same moment. 'stc-agent' records the table in the statistics directory at the start and the
+end of the statistics collection, and periodically in between. The table is used only for finding
+the start time of the statistics collection, so that all the statistics of a result share the same
+time axis. The statistics time-stamps are not converted between clocks: all the statistics are
+time-stamped with the time of day already.
+
+Note, the table records the clocks of the SUT. The out-of-band statistics (e.g., AC power or
+out-of-band IPMI) are time-stamped with the clock of the host which collects them. They end up on
+the same time axis only if the clocks of both hosts are synchronized (e.g., with NTP).
+
+The CSV file columns are as follows.
+  * Label - the snapshot label: "start", "periodic", or "stop".
+  * MonotonicRaw - 'CLOCK_MONOTONIC_RAW' in nanoseconds.
+  * Boottime - 'CLOCK_BOOTTIME' in nanoseconds.
+  * Realtime - 'CLOCK_REALTIME' in nanoseconds.
+"""
+
+import os
+import csv
+import time
+import logging
+from pepclibs.helperlibs.Exceptions import Error
+
+_LOG = logging.getLogger()
+
+# Name of the clock-correlation table file.
+FILENAME = "clocks.raw.txt"
+
+# The clocks and the matching 'time' module clock IDs.
+_CLOCKS = (("MonotonicRaw", time.CLOCK_MONOTONIC_RAW), ("Boottime", time.CLOCK_BOOTTIME),
+           ("Realtime", time.CLOCK_REALTIME))
+
+# The python code which takes a clocks snapshot on a remote host and prints it as a CSV row. Keep
+# it in sync with 'ClockTableWriter._snapshot()'.
+_REMOTE_SNAPSHOT_CODE = """
+import time
+ts1 = time.clock_gettime_ns(time.CLOCK_MONOTONIC_RAW)
+bt = time.clock_gettime_ns(time.CLOCK_BOOTTIME)
+rt = time.clock_gettime_ns(time.CLOCK_REALTIME)
+ts2 = time.clock_gettime_ns(time.CLOCK_MONOTONIC_RAW)
+print("%d,%d,%d" % ((ts1 + ts2) // 2, bt, rt))
+"""
+
+def take_remote_snapshot(pman):
+    """
+    Take a clocks snapshot on the host defined by the 'pman' process manager object. Returns the
+    snapshot dictionary with the clock names as keys, or 'None' if the snapshot could not be taken
+    (e.g., there is no python on the host).
+    """
+
+    code = _REMOTE_SNAPSHOT_CODE.replace("'", "'\\''")
+    try:
+        stdout, _ = pman.run_verify(f"python3 -c '{code}'")
+    except Error as err:
+        _LOG.debug("failed to take a clocks snapshot%s:\n%s", pman.hostmsg, err)
+        return None
+
+    vals = stdout.strip().split(",")
+    names = [name for name, _ in _CLOCKS]
+    return {name: int(val) for name, val in zip(names, vals)}
+
+class ClockTableWriter:
+    """
+    This class represents a clock-correlation table file opened for writing. Snapshots can be
+    either taken by this class with 'add()', or provided by the user with 'add_snapshot()'.
+    """
+
+    @staticmethod
+    def _snapshot():
+        """Take a snapshot of all the clocks and return it as a dictionary."""
+
+        # Read the clocks with the raw monotonic clock reads around them, and use the average of
+        # the raw monotonic clock reads, to compensate for the time it takes to read the clocks.
+        ts1 = time.clock_gettime_ns(time.CLOCK_MONOTONIC_RAW)
+        snapshot = {name: time.clock_gettime_ns(clkid) for name, clkid in _CLOCKS[1:]}
+        ts2 = time.clock_gettime_ns(time.CLOCK_MONOTONIC_RAW)
+        snapshot["MonotonicRaw"] = (ts1 + ts2) // 2
+        return snapshot
+
+    def add_snapshot(self, label, snapshot):
+        """
+        Add a row to the table. The arguments are as follows.
+          * label - the snapshot label (e.g., "start").
+          * snapshot - the snapshot dictionary with the clock names as keys.
+        """
+
+        if not self._colnames:
+            self._colnames = ["Label"] + [name for name, _ in _CLOCKS]
+            if not self._cont:
+                self._writer.writerow(self._colnames)
+
+        row = [label] + [snapshot.get(name, "") for name in self._colnames[1:]]
+        try:
+            self._writer.writerow(row)
+            self._fobj.flush()
+        except OSError as err:
+            raise Error(f"failed to write to clock-correlation table '{self.path}':\n{err}") \
+                        from None
+
+    def add(self, label):
+        """Take a snapshot of the clocks and add it to the table with label 'label'."""
+
+        self.add_snapshot(label, self._snapshot())
+
+    def close(self):
+        """Close the table file."""
+
+        if getattr(self, "_fobj", None):
+            self._fobj.close()
+            self._fobj = None
+
+    def __init__(self, path):
+        """
+        The class constructor. The arguments are as follows.
+          * path - path to the table file. If the file exists, the snapshots are appended to it.
+        """
+
+        self.path = path
+        self._fobj = None
+        self._colnames = None
+        self._cont = os.path.exists(path)
+
+        if self._cont:
+            try:
+                with open(path, "r", encoding="utf-8") as fobj:
+                    self._colnames = next(csv.reader(fobj), None)
+            except OSError as err:
+                raise Error(f"failed to read clock-correlation table '{path}':\n{err}") from None
+
+        try:
+            # pylint: disable=consider-using-with
+            self._fobj = open(path, "a", encoding="utf-8", newline="")
+        except OSError as err:
+            raise Error(f"failed to open clock-correlation table '{path}':\n{err}") from None
+
+        self._writer = csv.writer(self._fobj)
+
+class ClockTable:
+    """This class represents a clock-correlation table file opened for reading."""
+
+    def get_time_range(self):
+        """
+        Returns the '(start, end)' tuple of the time since the epoch in seconds of the first and the
+        last snapshot in the table.
+        """
+
+        realtime = [row["Realtime"] for row in self.rows if "Realtime" in row]
+        return realtime[0] / 1000000000, realtime[-1] / 1000000000
+
+    def __init__(self, path):
+        """
+        The class constructor. The arguments are as follows.
+          * path - path to the table file.
+        """
+
+        self.path = path
+        # The snapshots, sorted by time. Each snapshot is a '{clock: value}' dictionary. Empty
+        # values are not included.
+        self.rows = []
+
+        try:
+            with open(path, "r", encoding="utf-8") as fobj:
+                for row in csv.DictReader(fobj):
+                    snapshot = {clock: int(val) for clock, val in row.items()
+                                if clock not in ("Label", None) and val}
+                    if snapshot:
+                        self.rows.append(snapshot)
+        except (OSError, ValueError, TypeError) as err:
+            raise Error(f"failed to read clock-correlation table '{path}':\n{err}") from None
+
+        if not any("Realtime" in row for row in self.rows):
+            raise Error(f"no snapshots found in clock-correlation table '{path}'")
@@ -0,0 +1,144 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides the functionality for producing plotly diagrams of per-bin statistics of a
+metric versus another metric. For example, 'WakeLatency' percentiles versus 'LDist' bins, or the
+shares of requested C-states versus 'LDist' bins.
+"""
+
+import numpy
+import pandas
+import plotly
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.htmlreport import _Plot
+
+# Default amount of X-axis bins.
+DEFAULT_BINS = 100
+# Default percentiles to show for numeric Y-axis metrics.
+DEFAULT_PERCENTILES = (50, 99, 99.9)
+
+class BinnedStats(_Plot.Plot):
+    """
+    This class provides the functionality to generate plotly diagrams of per-bin statistics. The
+    X-axis metric values are split on equal-width bins. If the Y-axis metric is numeric, the diagram
+    includes a line for every percentile and for the maximum value in the bins. Otherwise, the
+    diagram includes a line for every Y-axis metric value with its share of datapoints in the bins.
+
+    Only the per-bin statistics are stored in the diagram, so it stays small regardless of the
+    amount of datapoints.
+    """
+
+    def _get_bins(self, xdata):
+        """
+        Split 'xdata' values on 'self.bins' equal-width bins. Returns the '(binidx, centers)' tuple,
+        where 'binidx' is a 'numpy' array of bin indices of 'xdata' values, and 'centers' is a
+        'numpy' array of the bin centers.
+        """
+
+        xmin, xmax = xdata.min(), xdata.max()
+        if xmin == xmax:
+            return numpy.zeros(len(xdata), dtype=int), numpy.array([xmin])
+
+        edges = numpy.linspace(xmin, xmax, self.bins + 1)
+        binidx = ((xdata - xmin) * (self.bins / (xmax - xmin))).astype(int)
+        binidx = numpy.minimum(binidx, self.bins - 1)
+
+        return binidx, (edges[:-1] + edges[1:]) / 2
+
+    def calc_percentiles(self, df):
+        """
+        Calculate per-bin percentiles and the maximum of the Y-axis metric in 'pandas.DataFrame'
+        'df'. Returns the '(xdata, pdata)' tuple, where 'xdata' is a 'numpy' array of bin centers,
+        and 'pdata' is a '{name: numpy array}' dictionary, where 'name' is a percentile or "max".
+        Bins without datapoints are not included. A percentile is 'NaN' in bins with too few
+        datapoints to calculate it (e.g., less than 1000 datapoints for the 99.9th percentile).
+        """
+
+        df = df[[self.xcolname, self.ycolname]].dropna()
+        if df.empty:
+            raise Error(f"no data for diagram '{self.ycolname} vs {self.xcolname}'")
+
+        binidx, centers = self._get_bins(df[self.xcolname].to_numpy(dtype=float))
+        groups = df[self.ycolname].groupby(binidx)
+
+        qtls = groups.quantile([pct / 100 for pct in self.percentiles]).unstack()
+        counts = groups.size().to_numpy()
+
+        pdata = {}
+        for pct, qtl in zip(self.percentiles, qtls.columns):
+            mincnt = 100 / (100 - pct) if pct < 100 else 1
+            pdata[pct] = numpy.where(counts >= mincnt, qtls[qtl].to_numpy(), numpy.nan)
+        pdata["max"] = groups.max().to_numpy()
+
+        return centers[qtls.index.to_numpy()], pdata
+
+    def calc_shares(self, df):
+        """
+        Calculate per-bin shares of every Y-axis metric value in 'pandas.DataFrame' 'df'. Returns
+        the '(xdata, sdata)' tuple, where 'xdata' is a 'numpy' array of bin centers, and 'sdata' is
+        a '{value: numpy array}' dictionary with shares in percent. Bins without datapoints are not
+        included.
+        """
+
+        df = df[[self.xcolname, self.ycolname]].dropna()
+        if df.empty:
+            raise Error(f"no data for diagram '{self.ycolname} vs {self.xcolname}'")
+
+        binidx, centers = self._get_bins(df[self.xcolname].to_numpy(dtype=float))
+        codes, vals = pandas.factorize(df[self.ycolname], sort=True)
+
+        # Count datapoints for every (bin, value) pair at once.
+        counts = numpy.bincount(binidx * len(vals) + codes, minlength=len(centers) * len(vals))
+        counts = counts.reshape(len(centers), len(vals))
+        totals = counts.sum(axis=1)
+        nonempty = totals > 0
+        shares = counts[nonempty] * 100 / totals[nonempty, None]
+
+        sdata = {val: shares[:, idx] for idx, val in enumerate(vals)}
+        return centers[nonempty], sdata
+
+    def add_df(self, df, name, hover_data=None):
+        """
+        Overrides the 'add_df' function in the base class 'Plot'. See more details in
+        'Plot.add_df()'. The 'hover_data' argument is ignored, because the diagram does not include
+        datapoints.
+        """
+
+        if self._is_numeric_col(df, self.ycolname):
+            xdata, ydata = self.calc_percentiles(df)
+            names = {key: f"{name} max" if key == "max" else f"{name} p{key:g}" for key in ydata}
+        else:
+            xdata, ydata = self.calc_shares(df)
+            names = {key: f"{name} {key}" for key in ydata}
+
+        for key, vals in ydata.items():
+            try:
+                gobj = plotly.graph_objs.Scatter(x=xdata, y=vals, mode="lines+markers",
+                                                 name=names[key], opacity=self.opacity,
+                                                 marker={"size" : 4})
+            except Exception as err:
+                raise Error(f"failed to create diagram '{self.ycolname} vs {self.xcolname}':\n"
+                            f"{err}") from err
+            self._gobjs.append(gobj)
+
+    def __init__(self, xcolname, ycolname, outpath, xaxis_label=None, yaxis_label=None,
+                 xaxis_unit=None, yaxis_unit=None, bins=None, percentiles=None):
+        """
+        The class constructor. The arguments are the same as in 'Plot()' except for the following.
+         * bins - amount of X-axis bins, default is 'DEFAULT_BINS'.
+         * percentiles - an iterable collection of percentiles to show for a numeric Y-axis metric,
+                         default is 'DEFAULT_PERCENTILES'.
+        """
+
+        self.bins = bins if bins else DEFAULT_BINS
+        self.percentiles = percentiles if percentiles else DEFAULT_PERCENTILES
+
+        super().__init__(xcolname, ycolname, outpath, xaxis_label=xaxis_label,
+                         yaxis_label=yaxis_label, xaxis_unit=xaxis_unit, yaxis_unit=yaxis_unit,
+                         opacity=1)
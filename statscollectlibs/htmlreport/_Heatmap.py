@@ -0,0 +1,96 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""This module provides the functionality for producing plotly heatmaps."""
+
+import numpy
+import plotly
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.htmlreport import _Plot
+
+class Heatmap(_Plot.Plot):
+    """
+    This class provides the functionality to generate plotly heatmaps of a metric over two
+    dimensions, for example CPU number versus time.
+    """
+
+    @staticmethod
+    def reduce_columns(xdata, zdata, target):
+        """
+        Reduce the amount of columns in the 'zdata' matrix to maximum 'target' by averaging adjacent
+        columns. Returns the '(xdata, zdata)' tuple with the reduced X-axis values and matrix. The
+        arguments are as follows.
+         * xdata - the X-axis values, one per 'zdata' column.
+         * zdata - 'numpy' 2D array, rows correspond to Y-axis values, columns to X-axis values.
+         * target - maximum amount of columns, '0' means no limit.
+        """
+
+        colcnt = zdata.shape[1]
+        if not target or colcnt <= target:
+            return xdata, zdata
+
+        # Split columns on 'target' buckets of (nearly) equal size, and average every bucket. The
+        # X-axis value of a bucket is the X-axis value of its first column.
+        edges = numpy.linspace(0, colcnt, target + 1).astype(int)
+        xdata = numpy.asarray(xdata)[edges[:-1]]
+        with numpy.errstate(invalid="ignore"):
+            sums = numpy.add.reduceat(numpy.nan_to_num(zdata), edges[:-1], axis=1)
+            cnts = numpy.add.reduceat((~numpy.isnan(zdata)).astype(int), edges[:-1], axis=1)
+            zdata = numpy.where(cnts > 0, sums / numpy.maximum(cnts, 1), numpy.nan)
+
+        return xdata, zdata
+
+    def add_matrix(self, xdata, ydata, zdata, name):
+        """
+        Add a matrix of data to the heatmap. The arguments are as follows.
+         * xdata - the X-axis values, one per 'zdata' column.
+         * ydata - the Y-axis values, one per 'zdata' row.
+         * zdata - 'numpy' 2D array with the metric values.
+         * name - name of the data set.
+        """
+
+        hovertemplate = f"{self.yaxis_label}: %{{y}}<br>{self.xaxis_label}: %{{x:.4s}}" \
+                        f"{self.xaxis_unit}<br>{self.zaxis_label}: %{{z:.4s}}{self.zaxis_unit}" \
+                        f"<extra>{name}</extra>"
+        try:
+            gobj = plotly.graph_objs.Heatmap(x=xdata, y=ydata, z=zdata, name=name,
+                                             colorscale="Viridis", hoverongaps=False,
+                                             hovertemplate=hovertemplate,
+                                             colorbar={"title" : self.zaxis_label,
+                                                       "ticksuffix" : self.zaxis_unit})
+        except Exception as err:
+            raise Error(f"failed to create heatmap '{self.zaxis_label}':\n{err}") from err
+
+        self._gobjs.append(gobj)
+
+    def _configure_layout(self):
+        """Extends 'super()._configure_layout()' with heatmap-specific layout configuration."""
+
+        layout = super()._configure_layout()
+        layout["showlegend"] = False
+        # The Y-axis values are identifiers (e.g., CPU numbers), not quantities.
+        layout["yaxis"] = {**layout["yaxis"], "type" : "category", "tickformat" : None,
+                           "showgrid" : False, "zeroline" : False}
+        layout["xaxis"] = {**layout["xaxis"], "showgrid" : False, "zeroline" : False}
+        return layout
+
+    def __init__(self, xcolname, ycolname, zcolname, outpath, xaxis_label=None, yaxis_label=None,
+                 zaxis_label=None, xaxis_unit=None, zaxis_unit=None):
+        """
+        The class constructor. The arguments are the same as in 'Plot()' except for the following.
+         * zcolname - name of the metric represented by the heatmap colors.
+         * zaxis_label - label which describes the metric represented by the heatmap colors.
+         * zaxis_unit - unit of the metric represented by the heatmap colors.
+        """
+
+        self.zcolname = zcolname
+        self.zaxis_label = zaxis_label if zaxis_label else zcolname
+        self.zaxis_unit = zaxis_unit if zaxis_unit else ""
+
+        super().__init__(xcolname, ycolname, outpath, xaxis_label=xaxis_label,
+                         yaxis_label=yaxis_label, xaxis_unit=xaxis_unit)
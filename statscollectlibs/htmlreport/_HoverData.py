@@ -0,0 +1,109 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides the functionality for generating per-result hover data files for HTML reports.
+
+Diagrams do not include the hover text details of every datapoint. Instead, the details are stored
+once per result, and the JavaScript side fetches them by datapoint index when the user hovers over
+a datapoint. The hover data directory has the following structure.
+  * info.json - the metric titles and units, and the amount of datapoints per chunk file:
+                {"metrics": [[title, unit], ...], "chunk_size": chunk_size}
+  * <chunk number>.json - formatted metric values of datapoints with indices in the
+                          '[chunk number * chunk_size, (chunk number + 1) * chunk_size)' range:
+                          {datapoint_index: [value1, value2, ...], ...}
+"""
+
+import json
+import numpy
+import pandas
+from pepclibs.helperlibs.Exceptions import Error
+
+# Count of datapoints in a hover data chunk file.
+CHUNK_SIZE = 4096
+
+# Units which don't include any SI-prefixes.
+_BASE_UNITS = {"s"}
+_SI_PREFIXES = numpy.array(["p", "n", "u", "m", "", "k", "M", "G", "T"])
+
+def _format_si(vals):
+    """
+    Format numbers in 'numpy.ndarray' 'vals' with 3 significant digits and an SI prefix, e.g.
+    '12.3m'. Returns a 'numpy.ndarray' of strings.
+    """
+
+    finite = numpy.isfinite(vals) & (vals != 0)
+    with numpy.errstate(divide="ignore", invalid="ignore"):
+        exp = numpy.floor(numpy.log10(numpy.abs(vals)) / 3)
+    exp = numpy.clip(numpy.where(finite, exp, 0), -4, 4).astype(int)
+
+    result = numpy.char.mod("%.3g", vals / 1000.0 ** exp)
+    return numpy.char.add(result, _SI_PREFIXES[exp + 4])
+
+def _format_col(col, mdef):
+    """
+    Format metric values in 'pandas.Series' 'col' for the hover text, 'mdef' is the metric
+    definition. Returns a 'numpy.ndarray' of strings.
+    """
+
+    unit = mdef.get("short_unit")
+
+    if mdef.get("type") == "float":
+        vals = pandas.to_numeric(col, errors="coerce").to_numpy(dtype=float)
+        if unit in _BASE_UNITS:
+            result = _format_si(vals)
+        else:
+            result = numpy.char.mod("%.2f", vals)
+    else:
+        result = col.astype(str).to_numpy(dtype=str)
+
+    if unit and unit != "%":
+        result = numpy.char.add(result, str(unit))
+    return result
+
+def _dump_json(obj, path):
+    """Dump python object 'obj' to JSON file 'path'."""
+
+    try:
+        with open(path, "w", encoding="utf-8") as fobj:
+            json.dump(obj, fobj, separators=(",", ":"))
+    except Exception as err:
+        raise Error(f"failed to JSON dump hover data to '{path}':\n{err}") from None
+
+def generate(df, hov_defs, outdir):
+    """
+    Generate hover data files for 'pandas.DataFrame' 'df'. The arguments are as follows.
+     * df - the 'pandas.DataFrame' with the datapoints. The index of 'df' is the datapoint index
+            which diagrams refer to.
+     * hov_defs - list of definitions dictionaries of the metrics to include into the hover text.
+     * outdir - the hover data directory path.
+    """
+
+    hov_defs = [mdef for mdef in hov_defs if mdef["name"] in df]
+
+    try:
+        outdir.mkdir(parents=True, exist_ok=True)
+    except OSError as err:
+        raise Error(f"failed to create directory '{outdir}': {err}") from None
+
+    metrics = [[mdef["title"], mdef.get("short_unit", "")] for mdef in hov_defs]
+    _dump_json({"metrics" : metrics, "chunk_size" : CHUNK_SIZE}, outdir / "info.json")
+
+    if not hov_defs or df.empty:
+        return
+
+    # Format the values column by column, and then split the rows into chunks.
+    rows = numpy.column_stack([_format_col(df[mdef["name"]], mdef) for mdef in hov_defs])
+    indices = df.index.to_numpy(dtype=numpy.int64)
+    chunknums = indices // CHUNK_SIZE
+
+    order = numpy.argsort(chunknums, kind="stable")
+    chunknums, starts = numpy.unique(chunknums[order], return_index=True)
+    for chunknum, rows_idx in zip(chunknums, numpy.split(order, starts[1:])):
+        chunk = dict(zip(indices[rows_idx].tolist(), rows[rows_idx].tolist()))
+        _dump_json(chunk, outdir / f"{chunknum}.json")
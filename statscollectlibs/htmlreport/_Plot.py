@@ -42,56 +42,21 @@ _LEGEND = {"font"    : {"size" : 14},
 
 _LOG = logging.getLogger()
 
+def write_plotlyjs(outpath):
+    """
+    Write the plotly JavaScript library bundle to 'outpath'. Diagrams are saved as JSON
+    specifications without the library, and the report viewer loads the bundle only once.
+    """
+
+    try:
+        with open(outpath, "w", encoding="utf-8") as fobj:
+            fobj.write(plotly.offline.get_plotlyjs())
+    except Exception as err:
+        raise Error(f"failed to write the plotly JavaScript bundle to '{outpath}':\n{err}") from err
+
 class Plot:
     """This class provides the common defaults and logic for producing plotly diagrams."""
 
-    def create_hover_template(self, hov_defs, df):
-        """
-        Create and return a 'plotly'-compatible hover template for the 'pandas.DataFrame' 'df'.
-        Arguments are as follows:
-         * hov_defs - a list of definitions dictionaries which represent metrics for which hovertext
-                      should be generated.
-         * df - the 'pandas.DataFrame' which contains the datapoints to label.
-        """
-
-        _LOG.debug("Preparing hover text for '%s vs %s'", self.ycolname, self.xcolname)
-
-        hov_defs = {mdef["name"]: mdef for mdef in hov_defs}
-
-        templ = "(%{x}, %{y})<br>"
-        # Units which don't include any SI-prefixes.
-        base_units = {"s"}
-
-        for idx, col in enumerate(df.columns):
-            if col not in hov_defs:
-                continue
-
-            mdef = hov_defs[col]
-            # Metrics on the X-axis and Y-axis will be included at the beginning of the hovertext.
-            if (mdef["title"] == self.xaxis_label) or (mdef["title"] == self.yaxis_label):
-                continue
-
-            # 'customdata' is a way 'plotly' allows other data to be included in each hovertext.
-            # Plot classes will pass 'df' as 'customdata' to 'plotly'.
-            templ += f"{col}: %{{customdata[{idx}]"
-
-            if mdef.get("type") == "float":
-                # If the data uses a unit with no SI-prefixes, let plotly scale it accordingly.
-                if mdef.get("short_unit") in base_units:
-                    # "s" formatting is decimal notation with an SI prefix, rounded to significant
-                    # digits. This should apply to floats which aren't represented as a percentage.
-                    templ += ":.3s"
-                else:
-                    templ += ":.2f"
-            templ += "}"
-
-            unit = mdef.get("short_unit")
-            if unit and unit != "%":
-                templ += str(unit)
-            templ += "<br>"
-
-        return templ
-
     @staticmethod
     def _is_numeric_col(df, colname):
         """
@@ -105,16 +70,17 @@ class Plot:
         # boolean, in which case it returns False.
         return is_numeric_dtype(df[colname]) and df[colname].dtype != 'bool'
 
-    def add_df(self, df, name, hover_template=None):
+    def add_df(self, df, name, hover_data=None):
         """
         Add a single 'pandas.DataFrame' of data to the plot.
          * df - 'pandas.DataFrame' containing the data to be plotted for that test run.
          * name - plots with multiple sets of data will include a legend indicating which plot
                   points are from which set of data. This 'name' parameter will be used to label
                   the data given when this function is called.
-         * hover_template - a 'plotly'-compatible hover text template for each datapoint. May use
-                            the 'customdata' attribute. This method will provide 'df' to plotly as
-                            'customdata'.
+         * hover_data - path to the hover data directory of the test run relative to the report
+                        root directory (see '_HoverData'). If provided, the hover text of a
+                        datapoint includes the details looked up in the hover data by the
+                        datapoint index ('df' index).
         """
 
         raise NotImplementedError()
@@ -122,7 +88,8 @@ class Plot:
     def generate(self):
         """
         Generates a plotly diagram based on the data in all instances of 'pandas.DataFrame' saved
-        with 'self.add_df()'. Then saves it to a file at the output path 'self.outpath'.
+        with 'self.add_df()'. Then saves its JSON specification to a file at the output path
+        'self.outpath'. The plotly library is not included, see 'write_plotlyjs()'.
         """
 
         try:
@@ -133,8 +100,8 @@ class Plot:
                 fig.update_layout(template="plotly_white")
 
             _LOG.info("Generating plot: %s vs %s.", self.yaxis_label, self.xaxis_label)
-            plotly.offline.plot(fig, filename=str(self.outpath), auto_open=False,
-                                config={"showLink" : False})
+            with open(self.outpath, "w", encoding="utf-8") as fobj:
+                fobj.write(fig.to_json())
         except Exception as err:
             raise Error(f"failed to create the '{self.outpath}' diagram:\n{err}") from err
 
@@ -177,7 +144,7 @@ class Plot:
         The class constructor. The arguments are as follows.
          * xcolname - name of the column to use as the X-axis.
          * ycolname - name of the column to use as the Y-axis.
-         * outpath - desired filepath of resultant plot HTML.
+         * outpath - desired filepath of resultant plot JSON specification.
          * xaxis_label - label which describes the data plotted on the X-axis.
          * yaxis_label - label which describes the data plotted on the Y-axis.
          * xaxis_unit - the unit provided will be appended as a suffix to datapoints and along the
@@ -0,0 +1,155 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides the functionality for producing plotly diagrams of metric percentiles over a
+sliding window of datapoints, for example the 50th and 99th percentiles of 'WakeLatency' over the
+duration of a test run.
+"""
+
+import math
+import numpy
+import plotly
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.htmlreport import _Plot
+
+# Default percentiles to show in the diagram.
+DEFAULT_PERCENTILES = (50, 99, 99.9)
+# Default maximum amount of points in every percentile line.
+DEFAULT_POINTS = 1000
+# Amount of value bins used for estimating percentiles. The bins are logarithmic for positive data,
+# so the estimation error is bounded by the relative bin width 'ln(max / min) / _BINS'. E.g., it is
+# about 0.9% of the value for data spanning 4 orders of magnitude (linear interpolation within the
+# bin usually makes the error smaller). More bins make the per-block histograms proportionally
+# larger.
+_BINS = 1024
+# Amount of datapoints to process at once when counting them in bins.
+_CHUNK = 4 * 1024 * 1024
+
+class RollingPercentiles(_Plot.Plot):
+    """
+    This class provides the functionality to generate plotly diagrams of metric percentiles over a
+    sliding window of datapoints.
+    """
+
+    @staticmethod
+    def calc(ydata, percentiles=DEFAULT_PERCENTILES, points=DEFAULT_POINTS, window=None):
+        """
+        Calculate percentiles of 'ydata' values over a sliding window. Returns the '(xdata, pdata)'
+        tuple, where 'xdata' is a 'numpy' array of datapoint indices of the window ends, and 'pdata'
+        is a '{percentile: numpy array}' dictionary. The arguments are as follows.
+         * ydata - the values to calculate the percentiles for.
+         * percentiles - an iterable collection of percentiles to calculate (e.g., '99.9').
+         * points - maximum amount of windows to calculate the percentiles for.
+         * window - size of the sliding window in datapoints. Default is 2% of the datapoints.
+
+        Sorting every window is too slow for runs with hundreds of millions of datapoints. Instead,
+        values are counted in '_BINS' bins per block of datapoints, windows are sums of adjacent
+        blocks (calculated as differences of cumulative sums), and a percentile is interpolated
+        within the bin it falls into. The complexity is 'O(N)' for 'N' datapoints.
+        """
+
+        ydata = numpy.asarray(ydata, dtype=float)
+        ydata = ydata[~numpy.isnan(ydata)]
+        count = len(ydata)
+        if not count:
+            raise Error("no data to calculate rolling percentiles for")
+
+        blksize = max(1, math.ceil(count / points))
+        blkcnt = math.ceil(count / blksize)
+        if window is None:
+            window = count // 50
+        wblocks = min(max(1, round(window / blksize)), blkcnt)
+
+        ymin, ymax = ydata.min(), ydata.max()
+        if ymin == ymax:
+            # A single zero-width bin, all percentiles are equal to the value.
+            edges = numpy.array([ymin, ymax])
+            scale = 0
+        elif ymin > 0:
+            edges = numpy.geomspace(ymin, ymax, _BINS + 1)
+            scale = _BINS / numpy.log(ymax / ymin)
+        else:
+            edges = numpy.linspace(ymin, ymax, _BINS + 1)
+            scale = _BINS / (ymax - ymin)
+        binscnt = len(edges) - 1
+
+        # Build per-block histograms. Process the data in chunks of whole blocks to limit the
+        # amount of memory used for temporary arrays.
+        hists = numpy.zeros((blkcnt, binscnt), dtype=numpy.int64)
+        chunk = max(1, _CHUNK // blksize) * blksize
+        for start in range(0, count, chunk):
+            vals = ydata[start:start + chunk]
+            if ymin > 0:
+                binidx = numpy.log(vals / ymin) * scale
+            else:
+                binidx = (vals - ymin) * scale
+            binidx = numpy.minimum(binidx.astype(numpy.int64), binscnt - 1)
+
+            blk = start // blksize
+            blkidx = numpy.arange(len(vals)) // blksize
+            nblks = int(blkidx[-1]) + 1
+            counts = numpy.bincount(blkidx * binscnt + binidx, minlength=nblks * binscnt)
+            hists[blk:blk + nblks] += counts.reshape(nblks, binscnt)
+
+        # Cumulative sums of the histograms over blocks (with a leading row of zeros).
+        cumhists = numpy.zeros((blkcnt + 1, binscnt), dtype=numpy.int64)
+        numpy.cumsum(hists, axis=0, out=cumhists[1:])
+        del hists
+
+        # Only full windows are included. Window 'i' ends at block 'ends[i] - 1'.
+        ends = numpy.arange(wblocks, blkcnt + 1)
+        whists = cumhists[ends] - cumhists[ends - wblocks]
+        del cumhists
+        wcum = numpy.cumsum(whists, axis=1)
+        totals = wcum[:, -1]
+
+        rows = numpy.arange(len(ends))
+        pdata = {}
+        for pct in percentiles:
+            target = totals * pct / 100
+            # Index of the bin the percentile falls into.
+            idx = numpy.minimum((wcum < target[:, None]).sum(axis=1), binscnt - 1)
+            below = numpy.where(idx > 0, wcum[rows, idx - 1], 0)
+            inbin = numpy.maximum(whists[rows, idx], 1)
+            frac = numpy.clip((target - below) / inbin, 0, 1)
+            pdata[pct] = edges[idx] + frac * (edges[idx + 1] - edges[idx])
+
+        xdata = numpy.minimum(ends * blksize, count) - 1
+        return xdata, pdata
+
+    def add_data(self, ydata, name, percentiles=DEFAULT_PERCENTILES, window=None):
+        """
+        Add percentile lines of 'ydata' values to the diagram. The arguments are as follows.
+         * ydata - the metric values in the order they were measured.
+         * name - name of the data set.
+         * percentiles - an iterable collection of percentiles to add lines for.
+         * window - size of the sliding window in datapoints, see 'calc()'.
+        """
+
+        xdata, pdata = self.calc(ydata, percentiles=percentiles, points=self.points, window=window)
+
+        for pct, vals in pdata.items():
+            try:
+                gobj = plotly.graph_objs.Scattergl(x=xdata, y=vals, mode="lines",
+                                                   name=f"{name} p{pct:g}", opacity=self.opacity)
+            except Exception as err:
+                raise Error(f"failed to create rolling percentiles diagram '{self.ycolname}':\n"
+                            f"{err}") from err
+            self._gobjs.append(gobj)
+
+    def __init__(self, ycolname, outpath, yaxis_label=None, yaxis_unit=None, points=None):
+        """
+        The class constructor. The arguments are the same as in 'Plot()' except for the following.
+         * points - maximum amount of points in every percentile line.
+        """
+
+        self.points = points if points else DEFAULT_POINTS
+
+        super().__init__("Datapoint", ycolname, outpath, xaxis_label="Datapoint number",
+                         yaxis_label=yaxis_label, yaxis_unit=yaxis_unit, opacity=1)
@@ -12,6 +12,7 @@
 
 import itertools
 import logging
+import warnings
 import numpy
 import pandas
 import plotly
@@ -117,7 +118,67 @@ class ScatterPlot(_Plot.Plot):
         # Include all the colums in reduced version of the 'pandas.DataFrame'.
         return rawdf.loc[copy_cols]
 
-    def add_df(self, df, name, hover_template=None):
+    def downsample_ts(self, rawdf, reportid, target):
+        """
+        Downsample the time-series 'pandas.DataFrame' 'rawdf' to maximum 'target' datapoints using
+        the "Largest-Triangle-Three-Buckets" (LTTB) algorithm. Unlike 'reduce_df_density()', which
+        drops datapoints in dense areas, this keeps the visual shape of the time-series: spikes and
+        dips are preserved.
+
+        The datapoints (except for the first and the last ones) are split on 'target - 2' buckets.
+        From every bucket, the datapoint forming the largest triangle with the previously selected
+        datapoint and the average of the next bucket is selected.
+        """
+
+        dpcnt = len(rawdf)
+        if target < 3 or dpcnt <= target:
+            return rawdf
+
+        if not self._is_numeric_col(rawdf, self.xcolname) or \
+           not self._is_numeric_col(rawdf, self.ycolname):
+            return rawdf
+
+        _LOG.info("Downsampling report ID '%s', diagram '%s vs %s': %d datapoints to %d",
+                  reportid, self.yaxis_label, self.xaxis_label, dpcnt, target)
+
+        xdata = rawdf[self.xcolname].to_numpy(dtype=float)
+        ydata = rawdf[self.ycolname].to_numpy(dtype=float)
+
+        # Bucket boundaries, 'edges[i]' is the first datapoint of bucket 'i'.
+        edges = numpy.floor(numpy.arange(target - 1) * (dpcnt - 2) / (target - 2)).astype(int) + 1
+        edges[-1] = dpcnt - 1
+
+        selected = numpy.empty(target, dtype=int)
+        selected[0] = 0
+        selected[-1] = dpcnt - 1
+        prev = 0
+
+        # Buckets consisting of 'NaN' values only are fine, they just are not preferred, so silence
+        # the "mean of empty slice" warnings.
+        with warnings.catch_warnings():
+            warnings.simplefilter("ignore", category=RuntimeWarning)
+            for bucket in range(target - 2):
+                start, end = edges[bucket], edges[bucket + 1]
+
+                # The average point of the next bucket, the last datapoint for the last bucket.
+                if bucket < target - 3:
+                    nstart, nend = end, edges[bucket + 2]
+                    if nend > nstart:
+                        avgx = numpy.nanmean(xdata[nstart:nend])
+                        avgy = numpy.nanmean(ydata[nstart:nend])
+                    else:
+                        avgx, avgy = xdata[-1], ydata[-1]
+                else:
+                    avgx, avgy = xdata[-1], ydata[-1]
+
+                areas = numpy.abs((xdata[prev] - avgx) * (ydata[start:end] - ydata[prev]) -
+                                  (xdata[prev] - xdata[start:end]) * (avgy - ydata[prev]))
+                prev = start + int(numpy.argmax(numpy.nan_to_num(areas, nan=-1)))
+                selected[bucket + 1] = prev
+
+        return rawdf.iloc[selected]
+
+    def add_df(self, df, name, hover_data=None):
         """
         Overrides the 'add_df' function in the base class 'Plot'. See more details in
         'Plot.add_df()'.
@@ -135,10 +196,17 @@ class ScatterPlot(_Plot.Plot):
             marker_symbol = "line-ns"
 
         marker = {"size" : marker_size, "symbol" : marker_symbol, "opacity" : self.opacity}
+
+        # Only the datapoint indices are included, the JavaScript side uses them for looking up
+        # the hover text details in the hover data files.
+        if hover_data:
+            hover_args = {"customdata" : df.index, "meta" : {"hover_data" : str(hover_data)}}
+        else:
+            hover_args = {}
+
         gobj = plotly.graph_objs.Scattergl(x=df[self.xcolname], y=df[self.ycolname],
-                                           hovertemplate=hover_template, customdata=df,
                                            opacity=self.opacity, marker=marker, mode="markers",
-                                           name=name)
+                                           name=name, **hover_args)
         self._gobjs.append(gobj)
 
     def __init__(self, xcolname, ycolname, outpath, xaxis_label=None, yaxis_label=None,
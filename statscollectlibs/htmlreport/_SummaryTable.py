@@ -86,13 +86,15 @@ class SummaryTable:
             "funcs": {}
         }
 
-    def add_smry_func(self, reportid, metric, funcname, val):
+    def add_smry_func(self, reportid, metric, funcname, val, descr=None):
         """
         Add summary functions to the summary table. Arguments are as follows:
          * reportid - the reportid of the results which this summary function summarises.
          * metric - name of the metric which this function summarises.
          * funcname - what kind of summary has been calculated. E.g. 'max', 'min' etc.
          * val - raw value of the summary function calculation.
+         * descr - description of the summary function. Required for functions not supported by
+                   'DFSummary'.
         """
 
         if metric not in self.smrytbl["title"]:
@@ -114,8 +116,9 @@ class SummaryTable:
         }
 
         if funcname not in self.smrytbl["title"][metric]["funcs"]:
-            func_descr = DFSummary.get_smry_func_descr(funcname)
-            self.smrytbl["title"][metric]["funcs"][funcname] = func_descr
+            if descr is None:
+                descr = DFSummary.get_smry_func_descr(funcname)
+            self.smrytbl["title"][metric]["funcs"][funcname] = descr
 
     def _get_hovertext(self, val, reportid, metric, funcname):
         """
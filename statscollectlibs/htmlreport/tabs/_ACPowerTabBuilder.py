@@ -46,9 +46,6 @@ class ACPowerTabBuilder(_TabBuilderBase.TabBuilderBase):
         if self._time_metric not in sdf:
             raise Error(f"column '{self._time_metric}' not found in statistics file '{path}'.")
 
-        # Convert Time column from time since epoch to time since the first data point was recorded.
-        sdf[self._time_metric] = sdf[self._time_metric] - sdf[self._time_metric][0]
-
         return sdf
 
     def get_tab(self):
@@ -58,7 +55,9 @@ class ACPowerTabBuilder(_TabBuilderBase.TabBuilderBase):
         """
 
         dtab_bldr = _DTabBuilder.DTabBuilder(self._reports, self._outdir,
-                                             self._defs.info[self._power_metric], self._basedir)
+                                             self._defs.info[self._power_metric], self._basedir,
+                                             time_metric=self._time_metric)
+        dtab_bldr.ts_points = self.ts_points
         scatter_axes = [(self._defs.info[self._time_metric], self._defs.info[self._power_metric])]
         dtab_bldr.add_plots(scatter_axes, [self._defs.info[self._power_metric]])
         smry_funcs = {self._power_metric: ["max", "99.999%", "99.99%", "99.9%", "99%", "med", "avg",
@@ -18,6 +18,9 @@ from statscollectlibs.htmlreport.tabs import _Tabs
 
 _LOG = logging.getLogger()
 
+# Default maximum count of datapoints in time-series scatter plots.
+DEFAULT_TS_POINTS = 5000
+
 class DTabBuilder:
     """
     This base class provides the capability of populating a data tab.
@@ -74,31 +77,40 @@ class DTabBuilder:
 
         return _Tabs.DTabDC(self.title, ppaths, smry_path)
 
-    def _add_scatter(self, xdef, ydef, hover_defs=None):
+    def _add_scatter(self, xdef, ydef, hover_data=None):
         """
         Helper function for 'add_plots()'. Add a scatter plot to the report. Arguments are as
         follows:
          * xdef - definitions dictionary for the metric on the X-axis.
          * ydef - definitions dictionary for the metric on the Y-axis.
-         * hover_defs - a mapping between report id and lists of definitions dictionaries which
-                        represent metrics for which hovertext should be generated for that result.
-                        By default, only includes hovertext for 'xdef' and 'ydef'.
+         * hover_data - a mapping between report id and the hover data directory of that result
+                        (see '_HoverData'). By default, the hovertext includes only 'xdef' and
+                        'ydef'.
         """
 
         # Initialise scatter plot.
-        fname = f"{ydef['fsname']}-vs-{xdef['fsname']}.html"
+        fname = f"{ydef['fsname']}-vs-{xdef['fsname']}.json"
         s_path = self._outdir / fname
         s = _ScatterPlot.ScatterPlot(xdef["name"], ydef["name"], s_path, xdef.get("title"),
                                      ydef.get("title"), xdef.get("short_unit"),
                                      ydef.get("short_unit"))
 
         for reportid, df in self._reports.items():
-            reduced_df = s.reduce_df_density(df, reportid)
-            if hover_defs is not None:
-                hovertext = s.create_hover_template(hover_defs[reportid], reduced_df)
+            if self._time_metric and xdef["name"] == self._time_metric and self.ts_points:
+                reduced_df = s.downsample_ts(df, reportid, self.ts_points)
+            else:
+                reduced_df = s.reduce_df_density(df, reportid)
+            if hover_data is not None:
+                hover_path = hover_data.get(reportid)
             else:
-                hovertext = None
-            s.add_df(reduced_df, reportid, hovertext)
+                hover_path = None
+            if hover_path:
+                if reportid in self.hover_indices:
+                    index = self.hover_indices[reportid].union(reduced_df.index)
+                else:
+                    index = reduced_df.index
+                self.hover_indices[reportid] = index
+            s.add_df(reduced_df, reportid, hover_path)
 
         s.generate()
         self._ppaths.append(s_path)
@@ -112,9 +124,9 @@ class DTabBuilder:
 
         # Initialise histogram.
         if cumulative:
-            h_path = self._outdir / f"Percentile-vs-{mdef['fsname']}.html"
+            h_path = self._outdir / f"Percentile-vs-{mdef['fsname']}.json"
         else:
-            h_path = self._outdir / f"Count-vs-{mdef['fsname']}.html"
+            h_path = self._outdir / f"Count-vs-{mdef['fsname']}.json"
 
         h = _Histogram.Histogram(mdef["name"], h_path, mdef.get("title"), mdef.get("short_unit"),
                                  cumulative=cumulative, xbins=xbins)
@@ -156,7 +168,7 @@ class DTabBuilder:
 
         return False
 
-    def add_plots(self, plot_axes=None, hist=None, chist=None, hover_defs=None):
+    def add_plots(self, plot_axes=None, hist=None, chist=None, hover_data=None):
         """
         Initialise the plots and populate them using the 'pandas.DataFrame' objects in 'reports'
         which was provided to the class constructor. Arguments are as follows:
@@ -164,8 +176,11 @@ class DTabBuilder:
                        (xdef, ydef).
          * hist - a list of defs which represent metrics to create histograms for.
          * chist - a list of defs which represent metrics to create cumulative histograms for.
-         * hover_defs - a mapping from 'reportid' to defs of metrics which should be included in
-                        the hovertext of scatter plots.
+         * hover_data - a mapping from 'reportid' to the path of the hover data directory
+                        (relative to the report root directory) with the details to include in the
+                        hovertext of scatter plots. Refer to '_HoverData' for more information.
+                        The indices of the datapoints which the scatter plots refer to are stored
+                        in 'hover_indices'.
         """
 
         if plot_axes is None and hist is None and chist is None:
@@ -180,7 +195,7 @@ class DTabBuilder:
 
         for xdef, ydef in plot_axes:
             if not self._skip_metric_plot("scatter plot", xdef, ydef):
-                self._add_scatter(xdef, ydef, hover_defs)
+                self._add_scatter(xdef, ydef, hover_data)
 
         for mdef in hist:
             if not self._skip_metric_plot("histogram", mdef):
@@ -190,7 +205,7 @@ class DTabBuilder:
             if not self._skip_metric_plot("cumulative histogram", mdef):
                 self._add_histogram(mdef, cumulative=True)
 
-    def __init__(self, reports, outdir, metric_def, basedir=None):
+    def __init__(self, reports, outdir, metric_def, basedir=None, time_metric=None):
         """
         The class constructor. Adding a data tab will create a sub-directory named after the metric
         in 'metric_def' and store plots and the summary table in it. Arguments are as follows:
@@ -200,9 +215,15 @@ class DTabBuilder:
          * metric_def - dictionary containing the definition for this metric.
          * basedir - base directory of the report. All paths should be made relative to this.
                      Defaults to 'outdir'.
+         * time_metric - name of the time metric. Scatter plots with this metric on the X-axis are
+                         time-series and they get downsampled to 'ts_points' datapoints.
         """
 
         self._reports = reports
+        self._time_metric = time_metric
+        # Maximum count of datapoints in time-series scatter plots. Users can change this, '0'
+        # disables time-series downsampling.
+        self.ts_points = DEFAULT_TS_POINTS
         # File system-friendly tab name.
         self._fsname = metric_def["fsname"]
         self.title = metric_def["name"]
@@ -222,3 +243,6 @@ class DTabBuilder:
 
         # Paths of plots generated for this tab.
         self._ppaths = []
+        # The '{reportid: index}' dictionary of the datapoints on the scatter plots which refer to
+        # the hover data. Only these datapoints need hover data.
+        self.hover_indices = {}
@@ -10,13 +10,12 @@
 This module provides the capability of populating the IPMI statistics Tab.
 """
 
-import numpy
 import pandas
 from pepclibs.helperlibs import Trivial
 from pepclibs.helperlibs.Exceptions import Error
 from statscollectlibs.defs import DefsBase, IPMIDefs
 from statscollectlibs.htmlreport.tabs import _TabBuilderBase
-from statscollectlibs.parsers import IPMIParser
+from statscollectlibs.parsers import IPMIParser, IPMIBinParser
 
 class IPMITabBuilder(_TabBuilderBase.TabBuilderBase):
     """
@@ -133,16 +132,11 @@ class IPMITabBuilder(_TabBuilderBase.TabBuilderBase):
 
         time_colname = "timestamp"
 
-        def _ipmi_to_df(ipmi):
-            """Convert IPMIParser dict to 'pandas.DataFrame'."""
-
-            # Reduce IPMI values from ('value', 'unit') to just 'value'.
-            # If "no reading" is parsed in a line of a raw IPMI file, 'None' is returned. In this
-            # case, we should exclude that IPMI metric.
-            i = {k:[v[0]] for k, v in ipmi.items() if v[0] is not None}
-            return pandas.DataFrame.from_dict(i)
-
-        ipmi_gen = IPMIParser.IPMIParser(path).next()
+        # The in-band IPMI statistics collected via the kernel IPMI device are in binary format.
+        if path.suffix == ".bin":
+            ipmi_gen = IPMIBinParser.IPMIBinParser(path).next()
+        else:
+            ipmi_gen = IPMIParser.IPMIParser(path).next()
 
         try:
             # Try to read the first data point from raw statistics file.
@@ -153,21 +147,24 @@ class IPMITabBuilder(_TabBuilderBase.TabBuilderBase):
 
         # Populate 'self._metrics' using the columns from the first data point.
         self._categorise_cols(i)
-        sdf = _ipmi_to_df(i)
 
-        for i in ipmi_gen:
-            df = _ipmi_to_df(i)
-            # Append dataset for a single timestamp to the main 'pandas.DataFrame'.
-            sdf = pandas.concat([sdf, df], ignore_index=True)
+        # Reduce IPMI values from ('value', 'unit') to just 'value'. If "no reading" is parsed in a
+        # line of a raw IPMI file, 'None' is returned. In this case, we should exclude that IPMI
+        # metric.
+        rows = []
+        for i in [i, *ipmi_gen]:
+            row = {k: v[0] for k, v in i.items() if v[0] is not None}
+            # Use time since the epoch, like all the other statistics.
+            if time_colname in row:
+                row[time_colname] = row[time_colname].timestamp()
+            rows.append(row)
+
+        sdf = pandas.DataFrame.from_records(rows)
 
         # Confirm that the time column is in the 'pandas.DataFrame'.
         if time_colname not in sdf:
             raise Error(f"column '{time_colname}' not found in statistics file '{path}'.")
 
-        # Convert Time column from time stamp to time since the first data point was recorded.
-        sdf[time_colname] = sdf[time_colname] - sdf[time_colname][0]
-        sdf[time_colname] = sdf[time_colname] / numpy.timedelta64(1, "s")
-
         sdf = sdf.rename(columns={time_colname: self._time_metric})
         return sdf
 
@@ -179,8 +176,6 @@ class IPMITabBuilder(_TabBuilderBase.TabBuilderBase):
         '_TabBuilderBase.TabBuilderBase'.
         """
 
-        self._time_metric = "Time"
-
         # Metrics in IPMI statistics can be represented by multiple columns. For example the
         # "FanSpeed" of several different fans can be measured and represented in columns "Fan1",
         # "Fan2" etc. This dictionary maps the metrics to the appropriate columns. Initialise it
@@ -188,4 +183,5 @@ class IPMITabBuilder(_TabBuilderBase.TabBuilderBase):
         defs = IPMIDefs.IPMIDefs()
         self._metrics = {metric: [] for metric in defs.info}
 
-        super().__init__(stats_paths, outdir, ["ipmi.raw.txt", "ipmi-inband.raw.txt"], defs)
+        stats_files = ["ipmi.raw.txt", "ipmi-inband.raw.bin", "ipmi-inband.raw.txt"]
+        super().__init__(stats_paths, outdir, stats_files, defs, time_metric="Time")
@@ -0,0 +1,155 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides the capability of populating the interrupts statistics tab.
+"""
+
+from pathlib import Path
+import pandas
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.defs import InterruptsDefs
+from statscollectlibs.parsers import InterruptsParser
+from statscollectlibs.htmlreport.tabs import _TabBuilderBase
+
+# Maximum count of per-interrupt data tabs of each kind (hardware and software interrupts). The
+# interrupts with the highest average rate get a data tab.
+_MAX_SOURCES = 16
+
+class InterruptsTabBuilder(_TabBuilderBase.TabBuilderBase):
+    """
+    This class provides the capability of populating the interrupts statistics tab.
+
+    Public methods overview:
+    1. Generate a '_Tabs.CTabDC' instance containing data tabs with interrupt rates on the measured
+       CPU over time.
+        * 'get_tab()'
+    """
+
+    name = "Interrupts"
+
+    def _read_stats_file(self, path):
+        """
+        Returns a 'pandas.DataFrame' containing interrupt rates calculated from the raw interrupts
+        statistics file at 'path'. Only interrupts on the measured CPU are counted. If the measured
+        CPU is not known, interrupts on all CPUs are counted.
+        """
+
+        mcpu = self._statdir_to_mcpu.get(path.parent)
+        if mcpu is not None:
+            mcpu = int(mcpu)
+
+        rows = []
+        prev_time = None
+
+        try:
+            for snapshot in InterruptsParser.InterruptsParser(path=path).next():
+                time = snapshot["Time"]
+                if prev_time is None:
+                    # The first snapshot is the base for the deltas in the next snapshot.
+                    prev_time = time
+                    continue
+
+                period = time - prev_time
+                prev_time = time
+                if period <= 0:
+                    continue
+
+                row = {self._time_metric: time}
+                totals = {"HardIRQ": 0, "SoftIRQ": 0}
+
+                for cpu, cpuinfo in snapshot["CPU"].items():
+                    if mcpu is not None and cpu != mcpu:
+                        continue
+
+                    for kind, prefix, total_metric in (("IRQ", "IRQ_", "HardIRQ"),
+                                                       ("SoftIRQ", "SoftIRQ_", "SoftIRQ")):
+                        for name, delta in cpuinfo[kind].items():
+                            metric = prefix + name
+                            row[metric] = row.get(metric, 0) + delta / period
+                            totals[total_metric] += delta
+
+                row["HardIRQ"] = totals["HardIRQ"] / period
+                row["SoftIRQ"] = totals["SoftIRQ"] / period
+                row["Total"] = row["HardIRQ"] + row["SoftIRQ"]
+                rows.append(row)
+        except Error as err:
+            raise Error(f"failed to parse interrupts statistics file '{path}':\n{err}") from None
+
+        if not rows:
+            raise Error(f"no interrupts data found in statistics file '{path}'.")
+
+        # Interrupts are only recorded in the snapshots where they happened, so the missing values
+        # are zero rates.
+        return pandas.DataFrame.from_records(rows).fillna(0)
+
+    def _get_sources(self, prefix):
+        """
+        Returns the list of per-interrupt metrics with the 'prefix' prefix (e.g., "IRQ_") which have
+        the highest average rate in any of the results. Adds the metrics to results which do not
+        have them with zero rates.
+        """
+
+        rates = {}
+        for sdf in self._reports.values():
+            for metric in sdf.columns:
+                if metric.startswith(prefix):
+                    rates[metric] = max(rates.get(metric, 0), sdf[metric].mean())
+
+        sources = sorted(rates, key=lambda metric: rates[metric], reverse=True)[:_MAX_SOURCES]
+
+        for sdf in self._reports.values():
+            for metric in sources:
+                if metric not in sdf:
+                    sdf[metric] = 0.0
+
+        return sources
+
+    def get_tab(self):
+        """
+        Returns a '_Tabs.CTabDC' instance containing data tabs for the total interrupt rates, and
+        container tabs with data tabs for the most frequent hardware and software interrupts.
+        """
+
+        hard_metrics = self._get_sources("IRQ_")
+        soft_metrics = self._get_sources("SoftIRQ_")
+
+        self._defs = InterruptsDefs.InterruptsDefs([m[len("IRQ_"):] for m in hard_metrics],
+                                                   [m[len("SoftIRQ_"):] for m in soft_metrics])
+
+        tab_hierarchy = {"dtabs": ["Total", "HardIRQ", "SoftIRQ"]}
+        if hard_metrics:
+            tab_hierarchy["Hardware Interrupts"] = {"dtabs": hard_metrics}
+        if soft_metrics:
+            tab_hierarchy["Software Interrupts"] = {"dtabs": soft_metrics}
+
+        tdef = self._defs.info[self._time_metric]
+        plots = {}
+        for metric in ["Total", "HardIRQ", "SoftIRQ"] + hard_metrics + soft_metrics:
+            mdef = self._defs.info[metric]
+            plots[metric] = {"scatter": [(tdef, mdef)], "hist": [mdef]}
+
+        return self._build_ctab(self.name, tab_hierarchy, self._outdir, plots)
+
+    def __init__(self, stats_paths, outdir, measured_cpus=None):
+        """
+        The class constructor. Adding an interrupts statistics container tab will create an
+        "Interrupts" sub-directory and store data tabs inside it. The arguments are the same as in
+        '_TabBuilderBase.TabBuilderBase' except for:
+         * measured_cpus - dictionary in the format {'reportid': 'measured_cpu'} where
+                           'measured_cpu' is the CPU that was being tested during the workload. If
+                           not provided, interrupts on all CPUs are counted.
+        """
+
+        measured_cpus = measured_cpus if measured_cpus else {}
+        self._statdir_to_mcpu = {}
+        for reportid, cpu in measured_cpus.items():
+            if stats_paths.get(reportid):
+                self._statdir_to_mcpu[Path(stats_paths[reportid])] = cpu
+
+        super().__init__(stats_paths, outdir, ["interrupts.raw.txt"], time_metric="Time")
@@ -14,10 +14,49 @@ from pathlib import Path
 import logging
 from pepclibs.helperlibs.Exceptions import Error, ErrorNotFound
 from statscollectlibs.defs import DefsBase
+from statscollectlibs.helperlibs import ClockTable
 from statscollectlibs.htmlreport.tabs import _DTabBuilder, _Tabs
 
 _LOG = logging.getLogger()
 
+# If the first statistics timestamp is further than this amount of seconds from the start of the
+# clock-correlation table, the table is considered to be unrelated to the statistics.
+_MAX_SKEW = 60
+
+def get_time_origin(statsdir, first_time):
+    """
+    Returns the time since the epoch in seconds which the statistics time axis starts from. The
+    arguments are as follows.
+     * statsdir - the statistics directory path.
+     * first_time - the time since the epoch of the first datapoint in the statistics.
+
+    All statistics of a result share the same time axis, which starts when the statistics collection
+    started according to the clock-correlation table in 'statsdir'. If there is no usable table, the
+    time axis starts from the first datapoint.
+
+    Note, out-of-band statistics (e.g., AC power) are time-stamped with the clock of the collecting
+    host, not the SUT. If the clocks of the hosts are not synchronized, the out-of-band statistics
+    are shifted on the time axis. A skew larger than '_MAX_SKEW' makes them use their own time
+    origin.
+    """
+
+    path = Path(statsdir) / ClockTable.FILENAME
+    if not path.exists():
+        return first_time
+
+    try:
+        start, _ = ClockTable.ClockTable(path).get_time_range()
+    except Error as err:
+        _LOG.debug("ignoring the clock-correlation table:\n%s", err)
+        return first_time
+
+    if abs(first_time - start) > _MAX_SKEW:
+        _LOG.debug("clock-correlation table '%s' does not match the statistics, time difference is "
+                   "%f seconds", path, first_time - start)
+        return first_time
+
+    return start
+
 class TabBuilderBase:
     """
     This base class can be inherited from to populate a group of statistics tabs.
@@ -78,7 +117,8 @@ class TabBuilderBase:
                     continue
                 try:
                     tab = _DTabBuilder.DTabBuilder(self._reports, outdir, self._defs.info[metric],
-                                                   self._basedir)
+                                                   self._basedir, time_metric=self._time_metric)
+                    tab.ts_points = self.ts_points
                     if metric in plots:
                         tab.add_plots(plots[metric].get("scatter"), plots[metric].get("hist"),
                                       plots[metric].get("chist"))
@@ -138,6 +178,13 @@ class TabBuilderBase:
                          "\nInvalid statistics file: %s \n", reportid, self.name, err)
             return
 
+        # Convert the time metric from time since the epoch to time since the start of the
+        # statistics collection.
+        if self._time_metric and self._time_metric in sdf and not sdf.empty:
+            first_time = sdf[self._time_metric].iloc[0]
+            origin = get_time_origin(rawpath.parent, first_time)
+            sdf[self._time_metric] = sdf[self._time_metric] - origin
+
         self._reports[reportid] = sdf
 
 
@@ -168,7 +215,7 @@ class TabBuilderBase:
                                 f"statistics files were found in any statistics directory: "
                                 f"'{self._stats_files}'.")
 
-    def __init__(self, stats_paths, outdir, stats_files, defs=None):
+    def __init__(self, stats_paths, outdir, stats_files, defs=None, time_metric=None):
         """
         The class constructor. Adding a statistics container tab will create a sub-directory and
         store tabs inside it. These tabs will represent all of the metrics stored in 'stats_file'.
@@ -179,6 +226,8 @@ class TabBuilderBase:
          * stats_files - a list of the possible names of the raw statistics file.
          * defs - a '_DefsBase.DefsBase' instance containing definitions for the metrics which
                   should be included in the output tab.
+         * time_metric - name of the time metric if the statistics are time-series, 'None'
+                         otherwise.
         """
 
         if self.name is None:
@@ -187,6 +236,9 @@ class TabBuilderBase:
 
         self._reports = {}
         self._basedir = outdir
+        self._time_metric = time_metric
+        # Maximum count of datapoints in time-series scatter plots. Users can change this.
+        self.ts_points = _DTabBuilder.DEFAULT_TS_POINTS
         self._outdir = outdir / DefsBase.get_fsname(self.name)
         self._defs = defs
 
@@ -0,0 +1,173 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides the capability of populating the "All CPUs" turbostat level 2 tab.
+
+Unlike the other level 2 tabs, this tab does not build a 'pandas.DataFrame' from every turbostat
+snapshot. Instead, per-CPU metric values are parsed directly into CPU x time matrices, and every
+metric is visualised with a single heatmap diagram per result, showing the whole system at once.
+"""
+
+import logging
+from pathlib import Path
+import numpy
+from pepclibs.helperlibs.Exceptions import Error, ErrorNotFound
+from statscollectlibs.defs import DefsBase, TurbostatDefs
+from statscollectlibs.parsers import TurbostatParser
+from statscollectlibs.htmlreport import _Heatmap
+from statscollectlibs.htmlreport.tabs import _DTabBuilder, _Tabs, _TabBuilderBase
+
+_LOG = logging.getLogger()
+
+class AllCPUsL2TabBuilder:
+    """
+    This class provides the capability of populating the "All CPUs" turbostat level 2 tab.
+
+    Public methods overview:
+    1. Generate a '_Tabs.CTabDC' instance containing a data tab with a heatmap for every metric.
+       * 'get_tab()'
+    """
+
+    name = "All CPUs"
+
+    @staticmethod
+    def _is_heatmap_metric(metric):
+        """Returns 'True' if a heatmap should be generated for metric 'metric'."""
+
+        if metric in ("Busy%", "Bzy_MHz", "Avg_MHz", "IPC", "IRQ"):
+            return True
+        return TurbostatDefs.is_hwcs_metric(metric) or TurbostatDefs.is_reqcs_metric(metric)
+
+    def _read_stats_file(self, path):
+        """
+        Parse raw turbostat statistics file at 'path' and return the CPU x time matrices dictionary
+        (see 'TurbostatParser.get_cpu_matrices()').
+        """
+
+        try:
+            parser = TurbostatParser.TurbostatParser(path)
+            matrices = parser.get_cpu_matrices()
+        except Exception as err:
+            raise Error(f"error reading raw statistics file '{path}': {err}.") from None
+
+        if not matrices["times"]:
+            raise Error(f"no turbostat data found in raw statistics file '{path}'.")
+
+        # Keep only metrics with at least some per-CPU data.
+        for metric in list(matrices["metrics"]):
+            if not self._is_heatmap_metric(metric):
+                del matrices["metrics"][metric]
+                continue
+
+            zdata = numpy.array(matrices["metrics"][metric], dtype=float)
+            if numpy.isnan(zdata).all():
+                del matrices["metrics"][metric]
+            else:
+                matrices["metrics"][metric] = zdata
+
+        # Convert timestamps to time since the start of the statistics collection.
+        times = numpy.array(matrices["times"], dtype=float)
+        matrices["times"] = times - _TabBuilderBase.get_time_origin(path.parent, times[0])
+
+        return matrices
+
+    def _read_stats(self, stats_paths):
+        """Read raw turbostat statistics files in statistics directories 'stats_paths'."""
+
+        for reportid, statsdir in stats_paths.items():
+            path = Path(statsdir) / "turbostat.raw.txt" if statsdir else None
+            if not path or not path.exists():
+                raise ErrorNotFound(f"failed to generate '{self.name}' tab: no raw turbostat "
+                                    f"statistics file found for report '{reportid}'.")
+            try:
+                self._matrices[reportid] = self._read_stats_file(path)
+            except Error as err:
+                _LOG.warning("unfortunately report '%s' had issues with turbostat data, here are "
+                             "the details: \nInvalid statistics file: %s \n", reportid, err)
+
+        if not self._matrices:
+            raise ErrorNotFound(f"failed to generate '{self.name}' tab: no usable raw turbostat "
+                                f"statistics files found.")
+
+    def _get_defs(self, metrics):
+        """Return turbostat metrics definitions for metrics in 'metrics'."""
+
+        cstates = []
+        for metric in metrics:
+            if TurbostatDefs.is_reqcs_metric(metric):
+                cstates.append(metric[:-1])
+            elif TurbostatDefs.is_hwcs_metric(metric):
+                cstates.append(metric[4:].upper())
+
+        return TurbostatDefs.TurbostatDefs(cstates)
+
+    def get_tab(self):
+        """
+        Returns a '_Tabs.CTabDC' instance, titled 'self.name', containing a data tab for every
+        metric common to all results. Each data tab contains a CPU versus time heatmap per result.
+        """
+
+        metric_sets = [set(matrices["metrics"]) for matrices in self._matrices.values()]
+        common_metrics = set.intersection(*metric_sets)
+
+        # Maintain the order in which turbostat prints the metrics.
+        first = next(iter(self._matrices.values()))
+        metrics = [metric for metric in first["metrics"] if metric in common_metrics]
+        if not metrics:
+            raise Error(f"unable to generate the '{self.name}' tab: no per-CPU metrics common to "
+                        f"all results.")
+
+        defs = self._get_defs(metrics)
+        tdef = defs.info["Time"]
+
+        dtabs = []
+        for metric in metrics:
+            mdef = defs.info.get(metric, {"name" : metric, "title" : metric, "short_unit" : ""})
+            tabdir = self._outdir / DefsBase.get_fsname(metric)
+            try:
+                tabdir.mkdir(parents=True, exist_ok=True)
+            except OSError as err:
+                raise Error(f"failed to create directory '{tabdir}': {err}") from None
+
+            ppaths = []
+            for reportid, matrices in self._matrices.items():
+                path = tabdir / f"{DefsBase.get_fsname(reportid)}-heatmap.json"
+                hmap = _Heatmap.Heatmap(tdef["name"], "CPU", metric, path,
+                                        xaxis_label=tdef.get("title"), yaxis_label="CPU",
+                                        zaxis_label=f"{mdef['title']} ({reportid})",
+                                        xaxis_unit=tdef.get("short_unit"),
+                                        zaxis_unit=mdef.get("short_unit"))
+
+                xdata, zdata = hmap.reduce_columns(matrices["times"],
+                                                   matrices["metrics"][metric], self.ts_points)
+                hmap.add_matrix(xdata, matrices["cpus"], zdata, reportid)
+                hmap.generate()
+                ppaths.append(path.relative_to(self._basedir))
+
+            dtabs.append(_Tabs.DTabDC(metric, ppaths))
+
+        return _Tabs.CTabDC(self.name, dtabs)
+
+    def __init__(self, stats_paths, outdir, basedir):
+        """
+        The class constructor. Adding the "All CPUs" turbostat level 2 tab will create an
+        "AllCPUs" sub-directory and store data tabs inside it. The arguments are as follows.
+         * stats_paths - dictionary in the format {'reportid': 'statistics_directory_path'}.
+         * outdir - the output directory in which to create the sub-directory for the tab.
+         * basedir - base directory of the report. All asset paths will be made relative to this.
+        """
+
+        self._basedir = basedir
+        self._outdir = outdir / DefsBase.get_fsname(self.name)
+        # The '{reportid: matrices}' dictionary, see 'TurbostatParser.get_cpu_matrices()'.
+        self._matrices = {}
+        # Maximum count of time columns in heatmaps. Users can change this.
+        self.ts_points = _DTabBuilder.DEFAULT_TS_POINTS
+
+        self._read_stats(stats_paths)
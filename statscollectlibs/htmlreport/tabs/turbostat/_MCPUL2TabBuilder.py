@@ -22,56 +22,49 @@ class MCPUL2TabBuilder(_TurbostatL2TabBuilderBase.TurbostatL2TabBuilderBase):
 
     name = "Measured CPU"
 
-    def _get_cpus_tstat(self, tstat):
+    def _turbostat_to_df(self, frames, path):
         """
-        Get a dictionary in the format {'cpu': 'tstat_subdict'}' from the 'tstat' dictionary
-        produced by 'TurbostatParser', where 'tstat_subdict' is a sub-dictionary of 'tstat' limited
-        to turbostat statistics only for the 'cpu' CPU.
-        """
-
-        cpus_tstat = {}
-
-        # Only return turbostat data for measured CPUs.
-        cpus_to_keep = set(self._statdir_to_mcpu.values())
-
-        # Traverse dictionary looking for measured CPUs.
-        for package in tstat["packages"].values():
-            for core in package["cores"].values():
-                for cpunum, tstats in core["cpus"].items():
-                    if cpunum in cpus_to_keep:
-                        # Include the core totals as for metrics which are not available at the CPU
-                        # level.
-                        cpus_tstat[cpunum] = {**core["totals"], **tstats}
-
-                    # If all measured CPUs have already been extracted then return.
-                    if cpus_to_keep - set(cpus_tstat.keys()) == set():
-                        return cpus_tstat
-
-        return cpus_tstat
-
-    def _turbostat_to_df(self, tstat, path):
-        """
-        Convert the 'tstat' dictionary produced by 'TurbostatParser' to a 'pandas.DataFrame'. See
+        Convert the frames produced by 'TurbostatParser.get_frames()' to a 'pandas.DataFrame'. See
         base class '_TurbostatL2TabBuilderBase.TurbostatL2TabBuilderBase' for arguments.
         """
 
         _time_colname = "Time_Of_Day_Seconds"
-        totals = tstat["totals"]
-        cpu_tstat = self._get_cpus_tstat(tstat)
+        totals = frames["totals"]
         mcpu = self._statdir_to_mcpu[path.parent]
 
-        # 'tstat_reduced' is a reduced version of the 'tstat' which contains only the columns we
-        # want to include in the report. Initialize it by adding the timestamp column.
-        tstat_reduced = {self._time_metric: [totals[_time_colname]]}
+        cpu_df = frames["cpus"]
+        cpu_df = cpu_df[cpu_df["CPU"] == mcpu]
+
+        # Turbostat prints core level metrics only for one CPU of the core. Use the core totals for
+        # metrics turbostat never printed for the measured CPU. Other missing values are per-line
+        # gaps and stay 'NaN'.
+        keys = ["Snapshot", "Package", "Core"]
+        core_df = frames["cores"]
+        core_cols = [col for col in core_df.columns if col not in keys]
+        cpu_df = cpu_df.merge(core_df[keys + core_cols], on=keys, how="left",
+                              suffixes=("", "_core"))
+        for col in core_cols:
+            if f"{col}_core" not in cpu_df:
+                continue
+            core_vals = cpu_df.pop(f"{col}_core")
+            if cpu_df[col].isna().all():
+                cpu_df[col] = core_vals
+
+        # The timestamps come from the totals lines.
+        cpu_df = cpu_df.drop(columns=[_time_colname], errors="ignore")
+        cpu_df = cpu_df.merge(totals[["Snapshot", _time_colname]], on="Snapshot", how="left")
+
+        # Include only the columns we want in the report. Start with the timestamp column.
+        sdf = pandas.DataFrame({self._time_metric: cpu_df[_time_colname]})
 
         for metric in self._defs.info:
             if metric == self._time_metric:
                 continue
 
-            if metric in totals:
-                tstat_reduced[metric] = [cpu_tstat[mcpu][metric]]
+            if metric in totals and metric in cpu_df and cpu_df[metric].notna().any():
+                sdf[metric] = cpu_df[metric]
 
-        return pandas.DataFrame.from_dict(tstat_reduced)
+        return sdf.reset_index(drop=True)
 
     def __init__(self, stats_paths, outdir, basedir, measured_cpus):
         """
@@ -47,26 +47,25 @@ class TotalsL2TabBuilder(_TurbostatL2TabBuilderBase.TurbostatL2TabBuilderBase):
 
         return harchy
 
-    def _turbostat_to_df(self, tstat, path=None):
+    def _turbostat_to_df(self, frames, path=None):
         """
-        Convert the 'tstat' dictionary produced by 'TurbostatParser' to a 'pandas.DataFrame'. See
+        Convert the frames produced by 'TurbostatParser.get_frames()' to a 'pandas.DataFrame'. See
         base class '_TurbostatL2TabBuilderBase.TurbostatL2TabBuilderBase' for arguments.
         """
 
         _time_colname = "Time_Of_Day_Seconds"
-        totals = tstat["totals"]
+        totals = frames["totals"]
 
-        # 'tstat_reduced' is a reduced version of the 'tstat' which contains only the columns we
-        # want to include in the report. Initialise it by adding the timestamp column.
-        tstat_reduced = {self._time_metric: [totals[_time_colname]]}
+        # Include only the columns we want in the report. Start with the timestamp column.
+        sdf = pandas.DataFrame({self._time_metric: totals[_time_colname]})
 
         for metric in self._defs.info:
             if metric == self._time_metric:
                 continue
             if metric in totals:
-                tstat_reduced[metric] = [totals[metric]]
+                sdf[metric] = totals[metric]
 
-        return pandas.DataFrame.from_dict(tstat_reduced)
+        return sdf
 
     def get_tab(self):
         """
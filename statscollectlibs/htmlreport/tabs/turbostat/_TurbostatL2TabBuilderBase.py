@@ -14,7 +14,6 @@ For each level 2 turbostat tab, we parse raw turbostat statistics files differen
 base class expects child classes to implement '_turbostat_to_df()'.
 """
 
-import pandas
 from pepclibs.helperlibs.Exceptions import Error
 from statscollectlibs.defs import TurbostatDefs
 from statscollectlibs.parsers import TurbostatParser
@@ -25,30 +24,32 @@ class TurbostatL2TabBuilderBase(_TabBuilderBase.TabBuilderBase):
     The base class for turbostat level 2 tab builder classes.
 
     This base class requires child classes to implement the following methods:
-    1. Convert the 'tstat' dictionary produced by 'TurbostatParser' to a 'pandas.DataFrame'.
+    1. Convert the frames produced by 'TurbostatParser.get_frames()' to a 'pandas.DataFrame'.
        * '_turbostat_to_df()'
     """
 
-    def _turbostat_to_df(self, tstat, path):
+    def _turbostat_to_df(self, frames, path):
         """
-        Convert the 'tstat' dictionary to a 'pandas.DataFrame'. Arguments are as follows:
-         * tstat - dictionary produced by 'TurbostatParser'.
+        Convert turbostat data to a 'pandas.DataFrame' with one row per turbostat snapshot.
+        Arguments are as follows:
+         * frames - dictionary produced by 'TurbostatParser.get_frames()'.
          * path - path of the original raw turbostat statistics file which was parsed to produce
-                  'tstat'.
+                  'frames'.
         """
 
         raise NotImplementedError()
 
-    def _extract_cstates(self, tstat):
+    def _extract_cstates(self, totals):
         """
-        Extract the C-states with data in 'tstat', the dictionary produced by 'TurbostatParser'.
+        Extract the C-states with data in 'totals', the turbostat totals 'pandas.DataFrame'
+        produced by 'TurbostatParser.get_frames()'.
         """
 
         req_cstates = []
         hw_cstates = []
         pkg_cstates = []
 
-        for metric in tstat["totals"]:
+        for metric in totals.columns:
             if TurbostatDefs.is_reqcs_metric(metric):
                 req_cstates.append(metric[:-1])
             elif TurbostatDefs.is_hwcs_metric(metric):
@@ -68,25 +69,16 @@ class TurbostatL2TabBuilderBase(_TabBuilderBase.TabBuilderBase):
         """
 
         try:
-            tstat_gen = TurbostatParser.TurbostatParser(path).next()
+            frames = TurbostatParser.TurbostatParser(path).get_frames()
 
-            # Use the first turbostat snapshot to see which hardware and requestable C-states the
-            # platform under test has.
-            tstat = next(tstat_gen)
-            hw_cstates, req_cstates = self._extract_cstates(tstat)
+            # See which hardware and requestable C-states the platform under test has.
+            hw_cstates, req_cstates = self._extract_cstates(frames["totals"])
 
             # Instantiate 'self._defs' if it has not already been instantiated.
             if not self._defs:
                 self._defs = TurbostatDefs.TurbostatDefs(hw_cstates + req_cstates)
 
-            # Initialise the stats 'pandas.DataFrame' ('sdf') with data from the first 'tstat'
-            # dictionary.
-            sdf = self._turbostat_to_df(tstat, path)
-
-            # Add the rest of the data from the raw turbostat statistics file to 'sdf'.
-            for tstat in tstat_gen:
-                df = self._turbostat_to_df(tstat, path)
-                sdf = pandas.concat([sdf, df], ignore_index=True)
+            sdf = self._turbostat_to_df(frames, path)
         except Exception as err:
             raise Error(f"error reading raw statistics file '{path}': {err}.") from None
 
@@ -94,9 +86,6 @@ class TurbostatL2TabBuilderBase(_TabBuilderBase.TabBuilderBase):
         if self._time_metric not in sdf:
             raise Error(f"timestamps could not be parsed in raw statistics file '{path}'.")
 
-        # Convert 'Time' column from time since epoch to time since first data point was recorded.
-        sdf[self._time_metric] = sdf[self._time_metric] - sdf[self._time_metric][0]
-
         return sdf
 
     @staticmethod
@@ -198,7 +187,6 @@ class TurbostatL2TabBuilderBase(_TabBuilderBase.TabBuilderBase):
          * basedir - base directory of the report. All asset paths will be made relative to this.
         """
 
-        self._time_metric = "Time"
         self.outdir = outdir
 
         # After C-states have been extracted from the first raw turbostat statistics file, this
@@ -215,5 +203,5 @@ class TurbostatL2TabBuilderBase(_TabBuilderBase.TabBuilderBase):
             }
         }
 
-        super().__init__(stats_paths, outdir, ["turbostat.raw.txt"])
+        super().__init__(stats_paths, outdir, ["turbostat.raw.txt"], time_metric="Time")
         self._basedir = basedir
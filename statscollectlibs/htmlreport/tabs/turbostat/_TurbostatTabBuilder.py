@@ -10,8 +10,13 @@
 This module provides the capability of populating the turbostat statistics tab.
 """
 
-from statscollectlibs.htmlreport.tabs import _Tabs
-from statscollectlibs.htmlreport.tabs.turbostat import _MCPUL2TabBuilder, _TotalsL2TabBuilder
+import logging
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.htmlreport.tabs import _DTabBuilder, _Tabs
+from statscollectlibs.htmlreport.tabs.turbostat import _AllCPUsL2TabBuilder, _MCPUL2TabBuilder
+from statscollectlibs.htmlreport.tabs.turbostat import _TotalsL2TabBuilder
+
+_LOG = logging.getLogger()
 
 class TurbostatTabBuilder:
     """
@@ -33,16 +38,26 @@ class TurbostatTabBuilder:
         test.
         2. A "Totals" container tab will be generated containing turbostat tabs which
         visualise the turbostat system summaries.
+        3. If 'all_cpus' was 'True' in the constructor, an "All CPUs" container tab will be
+        generated containing CPU versus time heatmaps of per-CPU turbostat metrics.
         """
 
         l2_tabs = []
         for stab_bldr in self.l2tab_bldrs:
-            l2_tabs.append(stab_bldr.get_tab())
+            stab_bldr.ts_points = self.ts_points
+            try:
+                l2_tabs.append(stab_bldr.get_tab())
+            except Error as err:
+                _LOG.warning("skipping '%s' tab in '%s' tab: error occurred during tab "
+                             "generation:\n%s", stab_bldr.name, self.name, err)
+
+        if not l2_tabs:
+            raise Error(f"unable to generate the '{self.name}' tab.")
 
         return _Tabs.CTabDC(self.name, l2_tabs)
 
 
-    def __init__(self, stats_paths, outdir, measured_cpus=None):
+    def __init__(self, stats_paths, outdir, measured_cpus=None, all_cpus=False):
         """
         The class constructor. Adding a turbostat statistics container tab will create a "Turbostat"
         sub-directory and store level 2 tabs inside it. Level 2 tabs will represent metrics stored
@@ -53,9 +68,14 @@ class TurbostatTabBuilder:
          * measured_cpus - dictionary in the format {'reportid': 'measured_cpu'} where
                            'measured_cpu' is the CPU that was being tested during the workload. If
                            not provided, the "Measured CPU" tab will not be generated.
+         * all_cpus - if 'True', generate the "All CPUs" tab with CPU versus time heatmaps. The
+                      heatmaps are large for systems with many CPUs, so they are not generated by
+                      default.
         """
 
         self.l2tab_bldrs = []
+        # Maximum count of datapoints in time-series scatter plots. Users can change this.
+        self.ts_points = _DTabBuilder.DEFAULT_TS_POINTS
 
         if measured_cpus:
             self.l2tab_bldrs.append(_MCPUL2TabBuilder.MCPUL2TabBuilder(stats_paths,
@@ -64,3 +84,10 @@ class TurbostatTabBuilder:
 
         self.l2tab_bldrs.append(_TotalsL2TabBuilder.TotalsL2TabBuilder(stats_paths,
                                                                        outdir / self.name, outdir))
+
+        if all_cpus:
+            bldr_cls = _AllCPUsL2TabBuilder.AllCPUsL2TabBuilder
+            try:
+                self.l2tab_bldrs.append(bldr_cls(stats_paths, outdir / self.name, outdir))
+            except Error as err:
+                _LOG.warning("skipping '%s' tab in '%s' tab:\n%s", bldr_cls.name, self.name, err)
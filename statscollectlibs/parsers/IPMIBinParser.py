@@ -0,0 +1,74 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module implements parsing for the binary in-band IPMI statistics files produced by the
+'ipmi-inband-helper' tool. The file format is as follows. All numbers are little-endian.
+  * The 8-byte magic string (see 'MAGIC').
+  * 32-bit length of the header, followed by the header: a JSON dictionary in the
+    '{"sensors": [[name, unit], ...]}' format.
+  * The snapshot records. Each record is a 64-bit float timestamp (time since the epoch), followed
+    by a 32-bit float value for every sensor in the header. Sensors without a reading have the 'NaN'
+    value.
+"""
+
+import json
+import math
+import struct
+import datetime
+from pepclibs.helperlibs.Exceptions import Error
+
+MAGIC = b"IPMIBIN1"
+
+class IPMIBinParser:
+    """This class represents the binary in-band IPMI statistics files parser."""
+
+    def next(self):
+        """
+        Generator which yields a dictionary corresponding to one snapshot of IPMI sensor readings at
+        a time. The dictionaries have the same format as the ones produced by 'IPMIParser'.
+        """
+
+        try:
+            with open(self._path, "rb") as fobj:
+                data = fobj.read()
+        except OSError as err:
+            raise Error(f"cannot open '{self._path}':\n{err}") from err
+
+        hdr_start = len(MAGIC) + 4
+        if data[:len(MAGIC)] != MAGIC or len(data) < hdr_start:
+            raise Error(f"'{self._path}' is not a binary IPMI statistics file")
+
+        hdr_end = hdr_start + struct.unpack_from("<I", data, len(MAGIC))[0]
+        try:
+            sensors = json.loads(data[hdr_start:hdr_end])["sensors"]
+        except (ValueError, KeyError, TypeError) as err:
+            raise Error(f"bad header in binary IPMI statistics file '{self._path}':\n{err}") \
+                        from None
+
+        record = struct.Struct(f"<d{len(sensors)}f")
+        # The last record may be incomplete if the collector got killed while writing it.
+        end = hdr_end + (len(data) - hdr_end) // record.size * record.size
+
+        for vals in record.iter_unpack(data[hdr_end:end]):
+            data_set = {"timestamp": (datetime.datetime.fromtimestamp(vals[0]), "")}
+            for (name, unit), val in zip(sensors, vals[1:]):
+                if math.isnan(val):
+                    data_set[name] = (None, unit)
+                else:
+                    data_set[name] = (val, unit)
+
+            yield data_set
+
+    def __init__(self, path):
+        """
+        The class constructor. The arguments are as follows.
+          * path - path to the binary IPMI statistics file to parse.
+        """
+
+        self._path = path
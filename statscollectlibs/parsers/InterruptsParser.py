@@ -0,0 +1,71 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module implements parsing for the raw interrupts statistics files produced by the
+'interrupts-helper' tool. The file contains snapshots of per-CPU interrupt counter deltas. Every
+snapshot starts with the "Time: XYZ" line.
+"""
+
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.parsers import _ParserBase
+
+def _parse_deltas(text):
+    """Parse a space-separated list of 'name=delta' pairs and return the '{name: delta}' dict."""
+
+    deltas = {}
+    for pair in text.split():
+        name, delta = pair.rsplit("=", 1)
+        deltas[name] = int(delta)
+
+    return deltas
+
+class InterruptsParser(_ParserBase.ParserBase):
+    """This class represents the parser for raw interrupts statistics files."""
+
+    def _next(self):
+        """
+        Yield a dictionary for every snapshot. The dictionaries have the following format.
+          {"Time": time since the epoch,
+           "CPU": {cpu: {"IRQ": {name: delta, ...}, "SoftIRQ": {name: delta, ...}}, ...}}
+
+        The first snapshot in a file has no CPU data, it just provides the base time for the deltas
+        in the next snapshot. CPUs without interrupts since the previous snapshot are not included.
+        """
+
+        snapshot = None
+        for line in self._lines:
+            line = line.strip()
+            if not line:
+                continue
+
+            if line.startswith("Time: "):
+                if snapshot:
+                    yield snapshot
+
+                try:
+                    snapshot = {"Time": float(line[6:]), "CPU": {}}
+                except ValueError:
+                    raise Error(f"bad timestamp in line: {line}") from None
+                continue
+
+            if snapshot is None or not line.startswith("CPU"):
+                raise Error(f"unexpected line: {line}")
+
+            # Interrupt counter deltas line. Example:
+            # CPU0: LOC=250 RES=3 | TIMER=249 RCU=10
+            try:
+                cpu, deltas = line[3:].split(":", 1)
+                hard, soft = deltas.split("|", 1)
+                snapshot["CPU"][int(cpu)] = {"IRQ": _parse_deltas(hard),
+                                             "SoftIRQ": _parse_deltas(soft)}
+            except ValueError:
+                raise Error(f"bad interrupt deltas line: {line}") from None
+
+        if snapshot:
+            yield snapshot
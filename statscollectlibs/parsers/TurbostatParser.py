@@ -12,7 +12,10 @@ consist of one or multiple turbostat data tables.
 """
 
 import re
+import math
+from array import array
 from itertools import zip_longest
+import pandas
 from pepclibs.helperlibs import Trivial
 from pepclibs.helperlibs.Exceptions import Error
 from statscollectlibs.parsers import _ParserBase
@@ -230,9 +233,295 @@ def _add_nontable_data(nontable, line):
 
     _parse_cpu_flags(nontable, line)
 
+def _get_float(fields, idx):
+    """
+    Return field number 'idx' of the split turbostat line 'fields' as a float, or 'NaN' if it is not
+    available.
+    """
+
+    if idx >= len(fields) or fields[idx] == "-":
+        return math.nan
+    try:
+        return float(fields[idx])
+    except ValueError:
+        return math.nan
+
+# Names of the columns identifying the CPU a turbostat table line belongs to.
+_TOPOLOGY_COLS = ("Package", "Core", "CPU")
+
+
+def _lines_to_frame(heading, lines, snapshots):
+    """
+    Create and return a 'pandas.DataFrame' for split turbostat table lines 'lines' with columns
+    'heading'. The 'snapshots' argument is the list of snapshot numbers of the lines.
+    """
+
+    width = len(heading)
+    lines = [line + [None] * (width - len(line)) if len(line) < width else line[:width]
+             for line in lines]
+    df = pandas.DataFrame(lines, columns=heading)
+
+    for col in df.columns:
+        if col in _TOPOLOGY_COLS:
+            continue
+        # Values like "-" become 'NaN'.
+        df[col] = pandas.to_numeric(df[col], errors="coerce")
+
+    # On single package and single core systems turbostat does not include the "Package" or "Core"
+    # and "CPU" columns. Make sure we always have them.
+    for col in _TOPOLOGY_COLS:
+        if col not in df:
+            df[col] = "0"
+
+    df.insert(0, "Snapshot", snapshots)
+    return df
+
+def _aggregate(df, keys, exclude=()):
+    """
+    Aggregate metrics in 'pandas.DataFrame' 'df' grouped by columns 'keys' using the turbostat
+    aggregation methods (see 'get_aggregation_method()'). Metrics in 'exclude' are dropped.
+
+    Groups with only 'NaN' values of a metric get a 'NaN' value, so that a metric turbostat did not
+    print for a core or package is not confused with a zero sum.
+    """
+
+    cols = {SUM : [], AVG : [], MAX : []}
+    order = []
+    for col in df.columns:
+        if col in keys or col in _TOPOLOGY_COLS or col in exclude or col == "Snapshot":
+            continue
+        cols[get_aggregation_method(col)].append(col)
+        order.append(col)
+
+    grouped = df.groupby(list(keys), sort=False)
+    if not order:
+        return grouped.size().reset_index()[list(keys)]
+
+    aggregated = pandas.concat([grouped[cols[SUM]].sum(min_count=1), grouped[cols[AVG]].mean(),
+                                grouped[cols[MAX]].max()], axis=1)
+    return aggregated[order].reset_index()
+
 class TurbostatParser(_ParserBase.ParserBase):
     """This class represents the turbostat output parser."""
 
+    def get_frames(self):
+        """
+        Parse the entire turbostat output and return it in a columnar form. This is much faster
+        than 'next()', because lines are not converted to per-snapshot dictionaries, and totals are
+        calculated with vectorized 'pandas' operations. Returns a dictionary with the following
+        keys.
+         * totals - 'pandas.DataFrame' with the system totals (the turbostat totals line), one row
+                    per snapshot.
+         * packages - 'pandas.DataFrame' with package totals, one row per snapshot and package.
+         * cores - 'pandas.DataFrame' with core totals, one row per snapshot, package and core.
+         * cpus - 'pandas.DataFrame' with per-CPU data, one row per snapshot and CPU. Core or
+                  package level metrics, which turbostat prints only for some CPUs, are 'NaN' for
+                  the other CPUs (use 'cores' and 'packages' for them).
+         * nontable - same as the "nontable" dictionary produced by 'next()'.
+
+        All the 'pandas.DataFrame' objects include the "Snapshot" column with the snapshot number.
+        The 'packages', 'cores' and 'cpus' ones also include the "Package", "Core" and "CPU"
+        columns (as strings), where applicable. Missing values are 'NaN'. Like in 'next()', the
+        package and core totals do not include the "Avg_MHz" and "Bzy_MHz" metrics.
+        """
+
+        tbl_regex = re.compile(self._cols_regex)
+        nontable = {}
+        # Lines of every table heading: {heading: {"totals": ..., "cpus": ...}}. Normally all the
+        # tables have the same heading.
+        tables = {}
+        tbl = None
+        snapshot = -1
+
+        for line in self._lines:
+            # Ignore empty and 'jitter' lines like "turbostat: cpu65 jitter 2574 5881".
+            if not line or line.startswith("turbostat: "):
+                continue
+
+            # Match the beginning of the turbostat table.
+            if tbl is None and not re.match(tbl_regex, line):
+                _add_nontable_data(nontable, line)
+                continue
+
+            line = line.split()
+            if Trivial.is_float(line[0]):
+                # A per-CPU line of the current table.
+                tbl["cpus"].append(line)
+                tbl["cpu_snapshots"].append(snapshot)
+                continue
+
+            # This is the start of the new table, the next line is total statistics across all
+            # CPUs.
+            snapshot += 1
+            tbl = tables.setdefault(tuple(line), {"totals" : [], "tot_snapshots" : [],
+                                                  "cpus" : [], "cpu_snapshots" : []})
+            tbl["totals"].append(next(self._lines, "").split())
+            tbl["tot_snapshots"].append(snapshot)
+
+        if self._path:
+            self._lines.close()
+
+        if not tables:
+            raise Error("no turbostat tables found")
+
+        totals = []
+        cpus = []
+        for heading, tbl in tables.items():
+            totals_df = _lines_to_frame(heading, tbl["totals"], tbl["tot_snapshots"])
+            totals.append(totals_df)
+
+            # This is the the special case for single-CPU systems. Turbostat does not print the
+            # totals because there is only one CPU and totals is the the same as the CPU
+            # information.
+            missing = set(tbl["tot_snapshots"]) - set(tbl["cpu_snapshots"])
+            if missing:
+                cpus.append(totals_df[totals_df["Snapshot"].isin(missing)].assign(Package="0",
+                                                                                 Core="0",
+                                                                                 CPU="0"))
+            if tbl["cpus"]:
+                cpus.append(_lines_to_frame(heading, tbl["cpus"], tbl["cpu_snapshots"]))
+
+        totals = pandas.concat(totals, ignore_index=True).sort_values("Snapshot", kind="stable")
+        totals = totals.drop(columns=list(_TOPOLOGY_COLS)).reset_index(drop=True)
+        cpus = pandas.concat(cpus, ignore_index=True).sort_values("Snapshot", kind="stable")
+        cpus = cpus.reset_index(drop=True)
+
+        ignore_keys = ("Avg_MHz", "Bzy_MHz", "Time_Of_Day_Seconds")
+        cores = _aggregate(cpus, ("Snapshot", "Package", "Core"), exclude=ignore_keys)
+        packages = _aggregate(cores, ("Snapshot", "Package"))
+
+        return {"totals" : totals, "packages" : packages, "cores" : cores, "cpus" : cpus,
+                "nontable" : nontable}
+
+    def get_cpu_matrices(self, metrics=None):
+        """
+        Parse the entire turbostat output and return per-CPU metric values in a columnar form: a
+        CPU x snapshot matrix for every metric. This is much cheaper than 'next()', because no
+        per-snapshot dictionaries are built, values are appended to flat arrays as lines are
+        parsed. Arguments are as follows:
+         * metrics - an iterable collection of turbostat metric names (table columns) to extract.
+                     By default, all the columns except for 'Package', 'Core', 'CPU' and
+                     'Time_Of_Day_Seconds' are extracted.
+
+        Returns a dictionary with the following keys.
+         * times - list of snapshot timestamps ('Time_Of_Day_Seconds' of the totals line), or
+                   snapshot numbers if the turbostat output does not include timestamps.
+         * cpus - list of CPU numbers (strings), in the order turbostat printed them.
+         * metrics - a '{metric: matrix}' dictionary, where 'matrix' is a 2-dimensional
+                     'numpy.ndarray' with a row per CPU in 'cpus' and a column per snapshot in
+                     'times'. Missing values (e.g., core-level metrics on the second hyper-thread)
+                     are 'NaN'.
+        """
+
+        skip_cols = {"Package", "Core", "CPU", "Time_Of_Day_Seconds"}
+        tbl_regex = re.compile(self._cols_regex)
+
+        times = []
+        cpus = {}
+        # The values in the "long" form: snapshot number and CPU number of every per-CPU line, and
+        # the '{metric: values}' dictionary with a value for every per-CPU line.
+        snapshots = array("l")
+        cpucol = []
+        values = {}
+        # Metric name to column index map for the current table.
+        col_idx = {}
+        cpu_col = None
+        # The totals line and per-CPU lines of the current table.
+        totals = None
+        rows = []
+
+        def store_table():
+            """Store values from the lines of the current table."""
+
+            if not rows:
+                # This is the special case for single-CPU systems, where turbostat prints only
+                # the totals.
+                rows.append(totals)
+
+            snapshot = len(times) - 1
+            for fields in rows:
+                if cpu_col is None or cpu_col >= len(fields):
+                    cpunum = "0"
+                else:
+                    cpunum = fields[cpu_col]
+                cpus[cpunum] = None
+                snapshots.append(snapshot)
+                cpucol.append(cpunum)
+                linecnt = len(cpucol)
+
+                for metric, idx in col_idx.items():
+                    vals = values.get(metric)
+                    if vals is None:
+                        # Turbostat did not print this metric in the previous tables.
+                        vals = values[metric] = array("d", [math.nan] * (linecnt - 1))
+                    vals.append(_get_float(fields, idx))
+
+                if len(values) > len(col_idx):
+                    # Some metrics are not present in this table.
+                    for vals in values.values():
+                        if len(vals) < linecnt:
+                            vals.append(math.nan)
+
+        for line in self._lines:
+            # Ignore empty and 'jitter' lines like "turbostat: cpu65 jitter 2574 5881".
+            if not line or line.startswith("turbostat: "):
+                continue
+
+            # Skip everything before the first table.
+            if totals is None and not re.match(tbl_regex, line):
+                continue
+
+            fields = line.split()
+            if Trivial.is_float(fields[0]):
+                # A per-CPU line of the current table.
+                rows.append(fields)
+                continue
+
+            # This is the start of the new table.
+            if totals is not None:
+                store_table()
+                rows = []
+
+            col_idx = {}
+            for idx, key in enumerate(fields):
+                if key in skip_cols or (metrics is not None and key not in metrics):
+                    continue
+                col_idx[key] = idx
+
+            cpu_col = fields.index("CPU") if "CPU" in fields else None
+            time_col = fields.index("Time_Of_Day_Seconds") \
+                       if "Time_Of_Day_Seconds" in fields else None
+
+            # The next line is total statistics across all CPUs.
+            totals = next(self._lines, "").split()
+            if time_col is not None and time_col < len(totals):
+                times.append(float(totals[time_col]))
+            else:
+                times.append(float(len(times)))
+
+        if totals is not None:
+            store_table()
+
+        if self._path:
+            self._lines.close()
+
+        result = {"times" : times, "cpus" : list(cpus), "metrics" : {}}
+        if not values:
+            return result
+
+        # Turn the "long" form into CPU x snapshot matrices. CPUs and snapshots missing in the
+        # turbostat output get 'NaN' values.
+        df = pandas.DataFrame(values)
+        df["Snapshot"] = snapshots
+        df["CPU"] = cpucol
+        df = df.drop_duplicates(subset=["CPU", "Snapshot"], keep="last")
+        wide = df.pivot(index="CPU", columns="Snapshot")
+        for metric in values:
+            matrix = wide[metric].reindex(index=result["cpus"], columns=range(len(times)))
+            result["metrics"][metric] = matrix.to_numpy(dtype=float)
+
+        return result
+
     def _next(self):
         """
         Generator which yields a dictionary corresponding to one snapshot of turbostat output at a
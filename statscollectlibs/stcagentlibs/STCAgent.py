@@ -18,7 +18,7 @@ from pathlib import Path
 from pepclibs.helperlibs import LocalProcessManager, Trivial, ClassHelpers
 from pepclibs.helperlibs.Exceptions import Error, ErrorExists, ErrorNotFound
 from statscollectlibs.stcagentlibs import SysInfo
-from statscollectlibs.helperlibs import KernelVersion, ProcHelpers, RemoteHelpers
+from statscollectlibs.helperlibs import KernelVersion, ProcHelpers, RemoteHelpers, ClockTable
 
 _LOG = logging.getLogger()
 
@@ -95,9 +95,10 @@ DEFAULT_STINFO = {
     "ipmi-inband": {
         "interval": 5,
         "fallible": True,
-        "toolpath": "ipmi-helper",
-        "description": "Same as the 'ipmi' statistics, but the data are collected by running "
-                       "'ipmitool' on the SUT (in-band).",
+        "toolpath": "ipmi-inband-helper",
+        "description": "Same as the 'ipmi' statistics, but the data are collected on the SUT "
+                       "(in-band). The BMC is accessed directly via the kernel IPMI device "
+                       "('/dev/ipmi0'), without running 'ipmitool'.",
     },
     "acpower": {
         "interval": 1,
@@ -110,6 +111,13 @@ DEFAULT_STINFO = {
             "pmtype" : None,
         }
     },
+    "interrupts": {
+        "interval": 0.5,
+        "toolpath": "interrupts-helper",
+        "description": "Periodically read the '/proc/interrupts' and '/proc/softirqs' counters and "
+                       "collect the per-CPU hardware and software interrupt counts since the "
+                       "previous snapshot.",
+    },
 }
 
 class SCReplyError(Error):
@@ -941,6 +949,9 @@ class _Collector(ClassHelpers.SimpleCloseContext):
                 if value:
                     self._set_collector_property(stname, name, value)
 
+        if self._record_clocks and not discovery:
+            self._send_command("set-clocks-path", arg=str(self._statsdir / ClockTable.FILENAME))
+
         self._send_command("configure")
 
     def discover(self):
@@ -1011,6 +1022,9 @@ class _Collector(ClassHelpers.SimpleCloseContext):
         self._sock = None
         self._timeout = 60
         self._start_time = None
+        # Whether 'stc-agent' should record the clock-correlation table. Only makes sense for the
+        # host where the statistics collectors run.
+        self._record_clocks = False
 
         # Initialize the statistics dictionary.
         _set_stinfo_defaults(self.stinfo)
@@ -1061,6 +1075,11 @@ class _InBandCollector(_Collector):
         # Call the base class constructor.
         super().__init__(pman, pman.hostname, outdir=outdir, scpath=scpath)
 
+        # The in-band statistics are collected on the SUT, so record the SUT clocks. Note, the
+        # out-of-band statistics do not record the clocks, because the in-band and out-of-band
+        # statistics end up in the same directory.
+        self._record_clocks = True
+
         # Cleanup 'self.stinfo' by removing out-of-band statistics.
         for stname in list(self.stinfo):
             if not self.stinfo[stname]["inband"]:
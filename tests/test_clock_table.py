@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+#
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+Test module for the clock-correlation table and the statistics time origin.
+"""
+
+import pytest
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.helperlibs import ClockTable
+from statscollectlibs.htmlreport.tabs import _TabBuilderBase
+
+def _write_clock_table(path, snapshots):
+    """Write a clock-correlation table with 'snapshots' to 'path'."""
+
+    writer = ClockTable.ClockTableWriter(path)
+    try:
+        for label, snapshot in snapshots:
+            writer.add_snapshot(label, snapshot)
+    finally:
+        writer.close()
+
+def test_clock_table(tmp_path):
+    """Test writing and reading a clock-correlation table, including partial rows."""
+
+    path = tmp_path / ClockTable.FILENAME
+    _write_clock_table(path, [("start", {"MonotonicRaw": 10, "Boottime": 20,
+                                         "Realtime": 1000 * 1000000000}),
+                              ("periodic", {"MonotonicRaw": 30}),
+                              ("stop", {"MonotonicRaw": 50, "Boottime": 60,
+                                        "Realtime": 1010 * 1000000000})])
+
+    # Appending to an existing table must not add another header.
+    _write_clock_table(path, [("stop", {"MonotonicRaw": 70, "Realtime": 1020 * 1000000000})])
+
+    table = ClockTable.ClockTable(path)
+    assert table.rows == [{"MonotonicRaw": 10, "Boottime": 20, "Realtime": 1000 * 1000000000},
+                          {"MonotonicRaw": 30},
+                          {"MonotonicRaw": 50, "Boottime": 60, "Realtime": 1010 * 1000000000},
+                          {"MonotonicRaw": 70, "Realtime": 1020 * 1000000000}]
+    assert table.get_time_range() == (1000, 1020)
+
+def test_clock_table_snapshot(tmp_path):
+    """Test taking snapshots of the local clocks."""
+
+    path = tmp_path / ClockTable.FILENAME
+    writer = ClockTable.ClockTableWriter(path)
+    try:
+        writer.add("start")
+        writer.add("stop")
+    finally:
+        writer.close()
+
+    rows = ClockTable.ClockTable(path).rows
+    assert [set(row) for row in rows] == [{"MonotonicRaw", "Boottime", "Realtime"}] * 2
+    assert all(rows[0][clock] <= rows[1][clock] for clock in ("MonotonicRaw", "Boottime"))
+
+def test_clock_table_bad(tmp_path):
+    """Test reading bad clock-correlation tables."""
+
+    path = tmp_path / ClockTable.FILENAME
+    with pytest.raises(Error):
+        ClockTable.ClockTable(path)
+
+    path.write_text("Label,MonotonicRaw,Boottime,Realtime\nstart,1,2,bad\n", encoding="utf-8")
+    with pytest.raises(Error):
+        ClockTable.ClockTable(path)
+
+    path.write_text("Label,MonotonicRaw,Boottime,Realtime\nstart,1,2,\n", encoding="utf-8")
+    with pytest.raises(Error):
+        ClockTable.ClockTable(path)
+
+def test_time_origin(tmp_path):
+    """Test that the time origin comes from the clock-correlation table only if it matches."""
+
+    assert _TabBuilderBase.get_time_origin(tmp_path, 1005) == 1005
+
+    _write_clock_table(tmp_path / ClockTable.FILENAME,
+                       [("start", {"MonotonicRaw": 1, "Realtime": 1000 * 1000000000})])
+    assert _TabBuilderBase.get_time_origin(tmp_path, 1005) == 1000
+    assert _TabBuilderBase.get_time_origin(tmp_path, 5000) == 5000
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+#
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+Test module for the derived metrics of the 'wult' raw results.
+"""
+
+# pylint: disable=redefined-outer-name
+# pylint: disable=protected-access
+
+import shutil
+from pathlib import Path
+import numpy
+import pytest
+from wultlibs.rawresultlibs import RORawResult
+
+_TOOLDIR = Path(__file__).parents[1].resolve() # pylint: disable=no-member
+_TESTDATA = _TOOLDIR / "tests" / "testdata"
+
+@pytest.fixture
+def wult_res(tmp_path, monkeypatch):
+    """Returns a 'RORawResult' object for a copy of the good 'wult' test data."""
+
+    monkeypatch.setenv("WULT_DATA_PATH", str(_TOOLDIR))
+    dirpath = tmp_path / "res"
+    shutil.copytree(_TESTDATA / "wult" / "good", dirpath)
+    return RORawResult.RORawResult(dirpath)
+
+def test_derived_metrics(wult_res):
+    """Test that derived metrics are available only if their dependencies are."""
+
+    # 'IntrLatency - WakeLatency'.
+    assert "IntrDelay" in wult_res.metrics_set
+    # 'SoftIntrLatency - IntrLatency' and 'ThreadLatency - WakeLatency'.
+    assert "SoftIntrDelay" not in wult_res.metrics_set
+    assert "ThreadDelay" not in wult_res.metrics_set
+
+    wult_res.load_df()
+    delay = wult_res.df["IntrLatency"] - wult_res.df["WakeLatency"]
+    assert numpy.allclose(wult_res.df["IntrDelay"], delay)
+
+def test_derived_metrics_funcs(wult_res):
+    """Test which functions derived metric expressions may use."""
+
+    wult_res.defs.info["WakeSqrt"] = {"expr": "sqrt(WakeLatency)", "type": "float"}
+    wult_res.defs.info["WakeLog"] = {"expr": "abs(log10(WakeLatency + 1))", "type": "float"}
+    wult_res.defs.info["WakeWhere"] = {"expr": "where(WakeLatency > 5, 1, 0)", "type": "float"}
+    wult_res.defs.info["WakeUnknown"] = {"expr": "WakeLatency - NoSuchMetric", "type": "float"}
+    wult_res._init_derived_metrics()
+
+    assert {"WakeSqrt", "WakeLog"}.issubset(wult_res.metrics_set)
+    assert "WakeWhere" not in wult_res.metrics_set
+    assert "WakeUnknown" not in wult_res.metrics_set
+
+    wult_res.load_df()
+    assert numpy.allclose(wult_res.df["WakeSqrt"], numpy.sqrt(wult_res.df["WakeLatency"]))
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+#
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+Test module for parsing the frequency sweep lists.
+"""
+
+import pytest
+from pepclibs.helperlibs.Exceptions import Error
+from wultlibs import _FreqSweep
+
+def test_parse_freqs():
+    """Test parsing good frequency sweep lists."""
+
+    assert _FreqSweep.parse_freqs("800") == [800]
+    assert _FreqSweep.parse_freqs("800, 1.2GHz,1500MHz, 2000000kHz") == [800, 1200, 1500, 2000]
+    assert _FreqSweep.parse_freqs("1ghz,900 mhz") == [1000, 900]
+
+@pytest.mark.parametrize("freqs", ["", ",", "abc", "1.2THz", "-800", "0", "0.5kHz", "GHz"])
+def test_parse_freqs_bad(freqs):
+    """Test parsing bad frequency sweep lists."""
+
+    with pytest.raises(Error):
+        _FreqSweep.parse_freqs(freqs)
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+Test module for the ftrace ring buffer page decoder. Decodes hand-made ring buffer pages, so it
+does not require a SUT.
+"""
+
+# pylint: disable=redefined-outer-name
+
+import math
+import struct
+import pytest
+from pepclibs.helperlibs.Exceptions import Error
+from wultlibs import _FTrace
+
+# The ftrace ring buffer page header and event format files, like on x86_64.
+_HEADER_PAGE = """\
+	field: u64 timestamp;	offset:0;	size:8;	signed:0;
+	field: local_t commit;	offset:8;	size:8;	signed:1;
+	field: int overwrite;	offset:8;	size:1;	signed:1;
+	field: char data;	offset:16;	size:4080;	signed:1;
+"""
+
+_EVENT_ID = 1500
+
+_EVENT_FORMAT = f"""\
+name: wult_cpu_idle
+ID: {_EVENT_ID}
+format:
+	field:unsigned short common_type;	offset:0;	size:2;	signed:0;
+	field:unsigned char common_flags;	offset:2;	size:1;	signed:0;
+	field:unsigned char common_preempt_count;	offset:3;	size:1;	signed:0;
+	field:int common_pid;	offset:4;	size:4;	signed:1;
+
+	field:u64 LTime;	offset:8;	size:8;	signed:0;
+	field:s32 Delta;	offset:16;	size:4;	signed:1;
+"""
+
+@pytest.fixture
+def decoder():
+    """Returns a ring buffer page decoder for the test event."""
+    return _FTrace.FTraceRawDecoder(_HEADER_PAGE, _EVENT_FORMAT, "synthetic/wult_cpu_idle")
+
+def _event(evid, ltime, delta):
+    """Returns the payload of an event record with event ID 'evid'."""
+    return struct.pack("<HBBiQi", evid, 0, 0, 1, ltime, delta)
+
+def _make_page(records, missed=False):
+    """Returns a ring buffer page with 'records' (a list of '(header, payload)' tuples)."""
+
+    data = b"".join(struct.pack("<I", hdr) + payload for hdr, payload in records)
+    commit = len(data)
+    if missed:
+        commit |= 1 << 31
+    return (struct.pack("<QQ", 0, commit) + data).ljust(4096, b"\0")
+
+def test_decoder_init():
+    """Test creating the decoder from good and bad format files."""
+
+    decoder = _FTrace.FTraceRawDecoder(_HEADER_PAGE, _EVENT_FORMAT, "synthetic/wult_cpu_idle")
+    assert decoder.fields == ["LTime", "Delta"]
+    assert decoder.page_size == 4096
+
+    with pytest.raises(Error):
+        _FTrace.FTraceRawDecoder(_HEADER_PAGE.replace("commit", "cmt"), _EVENT_FORMAT, "ev")
+    with pytest.raises(Error):
+        _FTrace.FTraceRawDecoder(_HEADER_PAGE, _EVENT_FORMAT.replace("ID:", "Id:"), "ev")
+
+def test_decode_page(decoder):
+    """Test decoding records of various types from a ring buffer page."""
+
+    event1 = _event(_EVENT_ID, 10, -5)
+    event2 = _event(_EVENT_ID, 20, 7)
+    other = _event(_EVENT_ID + 1, 30, 0)
+    records = [(30 | 1 << 5, b"\0" * 4), # Time extend.
+               (len(event1) // 4 | 1 << 5, event1),
+               (29 | 1 << 5, struct.pack("<I", 8) + b"\0" * 4), # Padding.
+               (0, struct.pack("<I", len(other) + 4) + other), # Length in the record.
+               (0, struct.pack("<I", len(event2) + 4) + event2),
+               (29, b"")] # Empty rest of the page.
+    page = _make_page(records)
+
+    assert list(decoder.decode_page(page)) == [{"LTime": 10, "Delta": -5},
+                                               {"LTime": 20, "Delta": 7}]
+    assert decoder.missed_pages == 0
+
+    list(decoder.decode_page(_make_page(records, missed=True)))
+    assert decoder.missed_pages == 1
+
+def test_decode_page_truncated(decoder):
+    """Test decoding a truncated record of the traced event."""
+
+    event = _event(_EVENT_ID, 10, -5)[:12]
+    page = _make_page([(math.ceil(len(event) / 4) | 1 << 5, event)])
+
+    with pytest.raises(Error):
+        list(decoder.decode_page(page))
+
+@pytest.mark.parametrize("record", [(0, struct.pack("<I", 0)), # Zero length in the record.
+                                    (0, struct.pack("<I", 4)), # No data in the record.
+                                    (0, struct.pack("<I", 8192)), # Beyond the page.
+                                    (29 | 1 << 5, struct.pack("<I", 0)), # Zero length padding.
+                                    (29 | 1 << 5, struct.pack("<I", 8192))])
+def test_decode_page_bad_length(decoder, record):
+    """Test decoding records with bad lengths."""
+
+    with pytest.raises(Error):
+        list(decoder.decode_page(_make_page([record])))
+
+def test_decode_page_bad_commit(decoder):
+    """Test decoding a page with data size larger than the page."""
+
+    page = _make_page([(30 | 1 << 5, b"\0" * 4)])
+    with pytest.raises(Error):
+        list(decoder.decode_page(page[:16]))
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+#
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+Test module for the hover data of the 'wult' HTML reports. Generates a report for a result with
+many datapoints and checks that the hover data includes only the datapoints on the scatter plots.
+"""
+
+import json
+import shutil
+from pathlib import Path
+import numpy
+import pandas
+from wultlibs.htmlreport import WultReport
+from wultlibs.rawresultlibs import RORawResult
+from wulttools import _WultCommon
+
+_TOOLDIR = Path(__file__).parents[1].resolve() # pylint: disable=no-member
+_TESTDATA = _TOOLDIR / "tests" / "testdata"
+
+# Count of datapoints in the test result.
+_DPCNT = 5000
+
+def _create_result(dirpath):
+    """
+    Create a test result with '_DPCNT' datapoints in 'dirpath', using the good 'wult' test data as
+    a template. Most of the datapoints are in a dense cluster, so that density reduction drops them.
+    """
+
+    shutil.copytree(_TESTDATA / "wult" / "good", dirpath)
+    path = dirpath / "datapoints.csv"
+    df = pandas.read_csv(path)
+
+    rng = numpy.random.default_rng(0)
+    df = df.sample(_DPCNT, replace=True, random_state=0).reset_index(drop=True)
+    for metric in ("WakeLatency", "IntrLatency", "SilentTime", "LDist"):
+        df[metric] = df[metric] * rng.uniform(0.99, 1.01, _DPCNT)
+    df.to_csv(path, index=False)
+
+def test_hover_data_size(tmp_path, monkeypatch):
+    """Test that hover data is generated only for the datapoints on the scatter plots."""
+
+    monkeypatch.setenv("WULT_DATA_PATH", str(_TOOLDIR))
+    _create_result(tmp_path / "res")
+    res = RORawResult.RORawResult(tmp_path / "res")
+
+    outdir = tmp_path / "report"
+    rep = WultReport.WultReport([res], outdir, xaxes=["SilentTime", "LDist"],
+                                yaxes=["WakeLatency", "IntrLatency"], hist=[], chist=[])
+    rep.set_hover_metrics(_WultCommon.HOVER_METRIC_REGEXS)
+    rep.generate()
+
+    plotted = set()
+    for path in outdir.glob("**/*-vs-*.json"):
+        with open(path, "r", encoding="utf-8") as fobj:
+            for trace in json.load(fobj)["data"]:
+                if "hover_data" in trace.get("meta", {}):
+                    plotted.update(trace["customdata"])
+
+    hover = set()
+    for path in (outdir / "hover-data" / res.reportid).glob("[0-9]*.json"):
+        with open(path, "r", encoding="utf-8") as fobj:
+            hover.update(int(idx) for idx in json.load(fobj))
+
+    assert plotted
+    assert hover == plotted
+    assert len(hover) < _DPCNT / 2
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+#
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+Test module for the 'wult' raw data providers. Creates the providers for the kernel driver and the
+eBPF helper devices via the 'WultRawDataProvider()' factory, with the SUT operations stubbed out.
+Also tests validation of the perf event specifications.
+"""
+
+# pylint: disable=redefined-outer-name
+# pylint: disable=protected-access
+
+import types
+from pathlib import Path
+import pytest
+from pepclibs.helperlibs.Exceptions import Error
+from wultlibs import _RawDataProvider, _WultRawDataProvider
+
+_PERF_EVENTS = ["Misses=cpu/cache-misses", "LdBlk=cpu/event=0x03,umask=0x82"]
+
+class _Pman:
+    """A process manager stub for the local host, which does nothing."""
+
+    hostmsg = ""
+    hostname = "localhost"
+    is_remote = False
+
+    @staticmethod
+    def is_exe(_):
+        """Every path is an executable."""
+        return True
+
+class _FTraceStub:
+    """A stub for the trace buffer classes."""
+
+    def __init__(self, *_, **__):
+        """The constructor."""
+
+    def close(self):
+        """Nothing to close."""
+
+def _get_dev(drvname=None, helpername=None):
+    """Returns a device object stub for a kernel driver or an eBPF helper device."""
+
+    info = {"devid": drvname or helpername, "descr": "test device"}
+    return types.SimpleNamespace(drvname=drvname, helpername=helpername, info=info,
+                                 dmesg_obj=None, helper_opts=None)
+
+@pytest.fixture
+def stubs(monkeypatch):
+    """Stub out the SUT operations of the raw data providers."""
+
+    monkeypatch.setattr(_RawDataProvider.FSHelpers, "mount_debugfs",
+                        lambda pman: (Path("/sys/kernel/debug"), False))
+    monkeypatch.setattr(_RawDataProvider.ProcHelpers, "kill_processes", lambda *_, **__: None)
+    monkeypatch.setattr(_WultRawDataProvider._FTrace, "FTraceRaw", _FTraceStub)
+
+def test_drv_provider(stubs): # pylint: disable=unused-argument
+    """Test creating the kernel driver raw data provider via the factory."""
+
+    prov = _WultRawDataProvider.WultRawDataProvider(_get_dev(drvname="wult_hrt"), _Pman(), 1,
+                                                    ldist=(1000, 2000), idle_hist_raw=True,
+                                                    perf_events=None)
+    assert isinstance(prov, _WultRawDataProvider._WultDrvRawDataProvider)
+    assert [drvobj.name for drvobj in prov.drvobjs] == ["wult", "wult_hrt"]
+
+def test_bpf_provider(stubs): # pylint: disable=unused-argument
+    """Test creating the eBPF helper raw data provider via the factory, including perf events."""
+
+    prov = _WultRawDataProvider.WultRawDataProvider(_get_dev(helpername="wultrunner"), _Pman(), 1,
+                                                    wultrunner_path="/usr/bin/wultrunner",
+                                                    ldist=(1000, 2000), idle_hist_raw=True,
+                                                    perf_events=_PERF_EVENTS)
+    assert isinstance(prov, _WultRawDataProvider._WultBPFRawDataProvider)
+
+    prov.prepare()
+    assert prov._helper_opts == "-c 1 -l 1000,2000 --idle-hist-raw " \
+                                "--perf-event Misses=cpu/cache-misses " \
+                                "--perf-event LdBlk=cpu/event=0x03,umask=0x82"
+
+def test_perf_events(monkeypatch):
+    """Test validating good perf event specifications."""
+
+    monkeypatch.setenv("WULT_DATA_PATH", str(Path(__file__).parents[1].resolve()))
+    assert _WultRawDataProvider.parse_perf_events(_PERF_EVENTS) == _PERF_EVENTS
+    assert _WultRawDataProvider.parse_perf_events(["Raw=4:0x412e"]) == ["Raw=4:0x412e"]
+
+@pytest.mark.parametrize("event", ["cpu/cache-misses", "=cpu/cache-misses", "Misses=",
+                                   "A,B=cpu/cache-misses", f"{'M' * 64}=cpu/cache-misses",
+                                   "LTime=cpu/cache-misses", "TAI=4:1", "CC0Cyc=4:1", "CC6%=4:1",
+                                   "PC10Cyc=4:1", "ReqCState=4:1", "IdleHistCnt=4:1",
+                                   "IdleHist3=4:1", "TThread=4:1", "WakeLatency=4:1",
+                                   "IntrDelay=4:1"])
+def test_perf_events_bad(monkeypatch, event):
+    """Test rejecting bad perf event specifications, including names of other fields."""
+
+    monkeypatch.setenv("WULT_DATA_PATH", str(Path(__file__).parents[1].resolve()))
+    with pytest.raises(Error):
+        _WultRawDataProvider.parse_perf_events([event])
+
+def test_perf_events_dup(monkeypatch):
+    """Test rejecting perf events with the same name."""
+
+    monkeypatch.setenv("WULT_DATA_PATH", str(Path(__file__).parents[1].resolve()))
+    with pytest.raises(Error):
+        _WultRawDataProvider.parse_perf_events(["Misses=cpu/cache-misses", "Misses=4:1"])
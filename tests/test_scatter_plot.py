@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+#
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+Test module for the LTTB downsampling of time-series scatter plots.
+"""
+
+import numpy
+import pandas
+from statscollectlibs.htmlreport import _ScatterPlot
+
+def _downsample(df, target):
+    """Downsample 'df' with the "Time" and "Val" columns to 'target' datapoints."""
+
+    plot = _ScatterPlot.ScatterPlot("Time", "Val", "/dev/null")
+    return plot.downsample_ts(df, "test", target)
+
+def test_lttb_keeps_shape():
+    """Test that LTTB keeps the first and the last datapoints and the spikes."""
+
+    vals = numpy.zeros(1000)
+    vals[123] = 100
+    vals[777] = -100
+    df = pandas.DataFrame({"Time": numpy.arange(1000, dtype=float), "Val": vals})
+
+    result = _downsample(df, 50)
+    assert len(result) == 50
+    assert list(result.index[[0, -1]]) == [0, 999]
+    assert {123, 777}.issubset(result.index)
+    assert result.index.is_monotonic_increasing
+
+def test_lttb_nothing_to_do():
+    """Test that small and non-numeric time-series are not downsampled."""
+
+    df = pandas.DataFrame({"Time": numpy.arange(10, dtype=float), "Val": numpy.arange(10)})
+    assert _downsample(df, 10) is df
+    assert _downsample(df, 2) is df
+
+    df = pandas.DataFrame({"Time": numpy.arange(100, dtype=float), "Val": ["x"] * 100})
+    assert _downsample(df, 10) is df
+
+def test_lttb_nan():
+    """Test that LTTB handles datapoints with missing values."""
+
+    vals = numpy.arange(1000, dtype=float)
+    vals[100:300] = numpy.nan
+    df = pandas.DataFrame({"Time": numpy.arange(1000, dtype=float), "Val": vals})
+
+    result = _downsample(df, 20)
+    assert len(result) == 20
+    assert result["Val"].notna().sum() > 10
@@ -216,11 +216,10 @@ def add_deploy_cmdline_args(toolname, deploy_info, subparsers, func, argcomplete
 
     if cats["bpfhelpers"]:
         text = """eBPF helpers sources consist of 2 components: the user-space component and the
-                  eBPF component. The user-space component is distributed as a source code, and must
-                  be compiled. The eBPF component is distributed as both source code and in binary
-                  (compiled) form. By default, the eBPF component is not re-compiled. This option is
-                  meant to be used by wult developers to re-compile the eBPF component if it was
-                  modified."""
+                  eBPF component. Both are distributed as source code and compiled on every
+                  deployment, so the build host (the SUT, or the local host with '--local-build')
+                  must have 'clang' and 'bpftool'. This option has no effect and is kept for
+                  compatibility."""
         parser.add_argument("--rebuild-bpf", action="store_true", help=text)
 
     text = f"""Build {what} locally, instead of building on HOSTNAME (the SUT)."""
@@ -778,21 +777,26 @@ class Deploy(_DeployBase):
             self._bpman.rsync(srcdir, self._btmpdir, remotesrc=False,
                               remotedst=self._bpman.is_remote)
 
-        if self._rebuild_bpf:
-            # In order to compile the eBPF components of eBPF helpers, the build host must have
-            # 'bpftool' and 'clang' available. These tools are used from the 'Makefile'. Let's check
-            # for themin order to generate a user-friendly message if one of them is not installed.
+        # The eBPF components are distributed only as source code, so they are always compiled.
+        # This requires 'bpftool' and 'clang' on the build host. These tools are used from the
+        # 'Makefile'. Let's check for them in order to generate a user-friendly message if one of
+        # them is not installed.
+        try:
             bpftool_path = self._tchk.check_tool("bpftool")
             clang_path = self._tchk.check_tool("clang")
+        except ErrorNotFound as err:
+            msg = f"{err}\n\nThe eBPF helpers have to be compiled with 'clang' and 'bpftool'."
+            if self._spman.is_remote and not self._lbuild:
+                msg += " Alternatively, use '--local-build' to compile them on the local host."
+            raise ErrorNotFound(msg) from err
 
-            # Build the eBPF components of eBPF helpers.
-            for bpfhelper in self._cats["bpfhelpers"]:
-                _LOG.info("Compiling the eBPF component of '%s'%s",
-                          bpfhelper, self._bpman.hostmsg)
-                cmd = f"make -C '{self._btmpdir}/{bpfhelper}' KSRC='{self._ksrc}' " \
-                      f"CLANG='{clang_path}' BPFTOOL='{bpftool_path}' bpf"
-                stdout, stderr = self._bpman.run_verify(cmd)
-                self._log_cmd_output(stdout, stderr)
+        # Build the eBPF components of eBPF helpers.
+        for bpfhelper in self._cats["bpfhelpers"]:
+            _LOG.info("Compiling the eBPF component of '%s'%s", bpfhelper, self._bpman.hostmsg)
+            cmd = f"make -C '{self._btmpdir}/{bpfhelper}' KSRC='{self._ksrc}' " \
+                  f"CLANG='{clang_path}' BPFTOOL='{bpftool_path}' bpf"
+            stdout, stderr = self._bpman.run_verify(cmd)
+            self._log_cmd_output(stdout, stderr)
 
         # Check for 'libbpf.a', which should come from the kernel source.
         try:
@@ -1076,8 +1080,8 @@ class Deploy(_DeployBase):
           * ksrc - path to the kernel sources to compile drivers against.
           * lbuild - by default, everything is built on the SUT, but if 'lbuild' is 'True', then
                      everything is built on the local host.
-          * rebuild_bpf - if 'toolname' comes with an eBPF helper, re-build the the eBPF component
-                           of the helper if this argument is 'True'. Do not re-build otherwise.
+          * rebuild_bpf - not used, the eBPF components of eBPF helpers are always compiled. Kept
+                          for compatibility.
           * tmpdir_path - if provided, use this path as a temporary directory (by default, a random
                            temporary directory is created).
           * keep_tmpdir - if 'False', remove the temporary directory when finished. If 'True', do
@@ -1090,7 +1094,6 @@ class Deploy(_DeployBase):
 
         self._ksrc = ksrc
         self._lbuild = lbuild
-        self._rebuild_bpf = rebuild_bpf
         self._tmpdir_path = tmpdir_path
         self._keep_tmpdir = keep_tmpdir
         self._debug = debug
@@ -24,7 +24,7 @@ from pepclibs.helperlibs.Exceptions import Error, ErrorNotFound, ErrorNotSupport
 from wultlibs import NetIface, LsPCI
 
 # All the possible wult/ndl device driver names in order suitable for unloading.
-ALL_DRVNAMES = ("ndl", "wult_igb", "wult_hrt", "wult_tdt")
+ALL_DRVNAMES = ("ndl", "wult_igb", "wult_hrt", "wult_hrt_soft", "wult_tdt")
 
 # The maximum expected device clock resolution in nanoseconds.
 _MAX_RESOLUTION = 100
@@ -75,6 +75,8 @@ class _DeviceBase(ClassHelpers.SimpleCloseContext):
         self._pman = pman
         self.drvname = drvname
         self.helpername = helpername
+        # Extra command line options for the helper tool.
+        self.helper_opts = None
 
         self.netif = None
         self.dmesg_obj = None
@@ -458,6 +460,23 @@ class _WultHRT(_HRTimerDeviceBase):
 
         self.info["descr"] = self.supported_devices["hrt"]
 
+class _WultHRTSoft(_HRTimerDeviceBase):
+    """
+    The High Resolution Timers device controlled by the 'wult_hrt_soft' driver. Same as '_WultHRT',
+    but the delayed event is completed in softirq context, and the datapoints include the softirq
+    time stamps too.
+    """
+
+    supported_devices = {"hrt-soft" : "Linux High Resolution Timer with softirq completion (via "
+                                      "kernel driver)"}
+
+    def __init__(self, devid, pman, dmesg=None):
+        """The class constructor. The arguments are the same as in '_DeviceBase.__init__()'."""
+
+        super().__init__(devid, pman, drvname="wult_hrt_soft", dmesg=dmesg)
+
+        self.info["descr"] = self.supported_devices["hrt-soft"]
+
 class _WultHRTimer(_HRTimerDeviceBase):
     """The High Resolution Timers device controlled by the 'wultrunner' eBPF program."""
 
@@ -470,6 +489,23 @@ class _WultHRTimer(_HRTimerDeviceBase):
 
         self.info["descr"] = self.supported_devices["hrtimer"]
 
+class _WultTimerFD(_HRTimerDeviceBase):
+    """
+    The Linux 'timerfd' timer waking up a user thread, controlled by the 'wultrunner' eBPF program.
+    In addition to the usual wult metrics, this device measures the time it takes for the user
+    thread to run after the timer expires.
+    """
+
+    supported_devices = {"timerfd" : "Linux timerfd waking a user thread (via eBPF, experimental)"}
+
+    def __init__(self, devid, pman, dmesg=None):
+        """The class constructor. The arguments are the same as in '_DeviceBase.__init__()'."""
+
+        super().__init__(devid, pman, helpername="wultrunner", dmesg=dmesg)
+
+        self.helper_opts = "--thread"
+        self.info["descr"] = self.supported_devices["timerfd"]
+
 def GetDevice(toolname, devid, pman, cpunum=0, dmesg=None):
     """
     The device object factory - creates and returns the correct type of device object
@@ -488,9 +524,15 @@ def GetDevice(toolname, devid, pman, cpunum=0, dmesg=None):
         if devid in _WultHRT.supported_devices:
             return _WultHRT(devid, pman, dmesg=dmesg)
 
+        if devid in _WultHRTSoft.supported_devices:
+            return _WultHRTSoft(devid, pman, dmesg=dmesg)
+
         if devid in _WultHRTimer.supported_devices:
             return _WultHRTimer(devid, pman, dmesg=dmesg)
 
+        if devid in _WultTimerFD.supported_devices:
+            return _WultTimerFD(devid, pman, dmesg=dmesg)
+
     if toolname == "wult":
         clsname = "_WultIntelI210"
     elif toolname == "ndl":
@@ -529,11 +571,21 @@ def scan_devices(toolname, pman):
                 with _WultHRT(devid, pman, dmesg=False) as timerdev:
                     yield timerdev.info
 
+        for devid in _WultHRTSoft.supported_devices:
+            with contextlib.suppress(Error):
+                with _WultHRTSoft(devid, pman, dmesg=False) as timerdev:
+                    yield timerdev.info
+
         for devid in _WultHRTimer.supported_devices:
             with contextlib.suppress(Error):
                 with _WultHRTimer(devid, pman, dmesg=False) as timerdev:
                     yield timerdev.info
 
+        for devid in _WultTimerFD.supported_devices:
+            with contextlib.suppress(Error):
+                with _WultTimerFD(devid, pman, dmesg=False) as timerdev:
+                    yield timerdev.info
+
     if toolname == "wult":
         clsname = "_WultIntelI210"
     elif toolname == "ndl":
@@ -149,6 +149,18 @@ RELOCATABLE_DESCR = """Generate a report which contains a copy of the raw test r
                        option, viewers of the report will also be able to browse raw statistics
                        files which are copied across with the raw test results."""
 
+# Description for the '--ts-points' option of the 'report' command.
+TS_POINTS_DESCR = """Maximum count of datapoints in the time-series diagrams of the statistics
+                       tabs (e.g., turbostat or IPMI statistics over time). Longer time-series are
+                       downsampled with the "Largest-Triangle-Three-Buckets" algorithm, which keeps
+                       their visual shape. Use '0' to disable downsampling. Default is 5000."""
+
+# Description for the '--turbostat-heatmaps' option of the 'report' command.
+TURBOSTAT_HEATMAPS_DESCR = """Include the "All CPUs" turbostat tab with CPU versus time heatmaps of
+                              per-CPU turbostat metrics into the report. Heatmaps of systems with
+                              many CPUs make the report considerably larger, so this tab is not
+                              generated by default."""
+
 # Description for the '--list-metrics' option of the 'report' and other commands.
 LIST_METRICS_DESCR = "Print the list of the available metrics and exit."
 
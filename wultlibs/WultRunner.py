@@ -18,7 +18,9 @@ from pepclibs import CStates
 from pepclibs.helperlibs.Exceptions import Error, ErrorTimeOut
 from pepclibs.helperlibs import ClassHelpers, LocalProcessManager
 from wultlibs import _WultRawDataProvider, _ProgressLine, _WultDpProcess, StatsCollect, Deploy
+from wultlibs import _PkgQuiesce, _Calibration, _FreqSweep
 from wultlibs.helperlibs import Human
+from statscollectlibs.helperlibs import ClockTable
 
 _LOG = logging.getLogger()
 
@@ -28,6 +30,51 @@ _MAX_FTRACE_BAD_LINES = 10
 class WultRunner(ClassHelpers.SimpleCloseContext):
     """Run wake latency measurement experiments."""
 
+    def _calibrate(self, datapoints):
+        """
+        Calibrate the measurement floor using raw datapoints from the 'datapoints' generator, and
+        save the results in the 'info.yml' file. Returns the SUT time in the 'AITS1' clock at the
+        end of the calibration, or 'None' if it cannot be read.
+        """
+
+        self._calib.start()
+        timeout = self._timeout * 1.5
+        start_time = time.time()
+        try:
+            for rawdp in datapoints:
+                self._dpp.add_raw_datapoint(rawdp)
+                if any(self._calib.add_datapoint(dp) for dp in
+                       self._dpp.get_processed_datapoints()):
+                    break
+                if not self._calib.get_dpcnt() and time.time() - start_time > timeout:
+                    raise ErrorTimeOut(f"no 'POLL' datapoints collected for {timeout} seconds "
+                                       f"during the measurement floor calibration")
+        except BaseException:
+            with contextlib.suppress(Error):
+                self._calib.close()
+            raise
+
+        self._res.info["calibration"] = self._calib.finish()
+        self._res.write_info()
+
+        # Drop the datapoints collected while the calibration was finishing, they may be for the
+        # 'POLL' state.
+        for _ in self._dpp.get_processed_datapoints():
+            pass
+
+        return self._get_sut_time()
+
+    def _get_sut_time(self):
+        """
+        Returns the current SUT time in nanoseconds, read from the same clock as the 'AITS1' raw
+        datapoint field. Returns 'None' if the SUT time cannot be read.
+        """
+
+        snapshot = ClockTable.take_remote_snapshot(self._pman)
+        if not snapshot:
+            return None
+        return snapshot.get(self._dp_clock)
+
     def _collect(self, dpcnt, tlimit, keep_rawdp):
         """
         Collect datapoints and stop when either the CSV file has 'dpcnt' datapoints in total or when
@@ -41,6 +88,21 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
         # second one.
         self._dpp.prepare(rawdp, keep_rawdp)
 
+        # More 'POLL' datapoints may be still in flight after the calibration. Drop raw datapoints
+        # for the wake ups before the C-states were restored. If the SUT time is unknown, drop
+        # 'POLL' datapoints until the first datapoint for another C-state instead, but for no longer
+        # than the datapoints timeout.
+        calib_end = drain_until = None
+        if self._calib:
+            calib_end = self._calibrate(datapoints)
+            if calib_end is None:
+                _LOG.debug("cannot read the SUT time, dropping 'POLL' datapoints after the "
+                           "calibration")
+                drain_until = time.time() + self._timeout
+
+        if self._fsweep:
+            self._fsweep.start()
+
         # At least one datapoint should be collected within the 'timeout' seconds interval.
         timeout = self._timeout * 1.5
         start_time = last_rawdp_time = time.time()
@@ -53,9 +115,27 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
                                    f"driver does produce them, they are being rejected. One "
                                    f"possible reason is that they do not pass filters/selectors.")
 
+            if calib_end is not None:
+                if rawdp["AITS1"] < calib_end:
+                    continue
+                calib_end = None
+
+            if self._fsweep:
+                self._fsweep.update()
+                freq = self._fsweep.get_freq(rawdp["AITS1"])
+                if freq is None:
+                    # The datapoint was measured too close to a frequency change, drop it.
+                    continue
+                rawdp["FreqSet"] = freq
+
             self._dpp.add_raw_datapoint(rawdp)
 
             for dp in self._dpp.get_processed_datapoints():
+                if drain_until:
+                    if dp["ReqCState"] == "POLL" and time.time() < drain_until:
+                        continue
+                    drain_until = None
+
                 if not self._res.csv.hdr:
                     # Add the first CSV header.
                     self._res.csv.add_header(dp.keys())
@@ -95,6 +175,21 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
                          fields will also be saved in the CSV file.
         """
 
+        if not self._pkgq:
+            self._run(dpcnt, tlimit, keep_rawdp)
+            return
+
+        # Quiesce the other CPUs of the package before starting the statistics collectors, so that
+        # their processes do not use the quiesced CPUs either.
+        self._pkgq.quiesce()
+        try:
+            self._run(dpcnt, tlimit, keep_rawdp)
+        finally:
+            self._pkgq.restore()
+
+    def _run(self, dpcnt, tlimit, keep_rawdp):
+        """Implements 'run()'."""
+
         self._res.write_info()
 
         if self._stcoll:
@@ -148,6 +243,11 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
                       self._res.cpunum, self._pman.hostmsg, duration)
             self._prov.stop()
 
+        if self._fsweep:
+            self._fsweep.restore()
+
+        self._save_overruns()
+
 
         # Check if there were any bug/warning messages in 'dmesg'.
         dmesg = ""
@@ -168,6 +268,28 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
             self._stcoll.stop()
             self._stcoll.copy_stats()
 
+    def _save_overruns(self):
+        """
+        Save the count of raw datapoints lost because of trace buffer overflows to the 'info.yml'
+        file.
+        """
+
+        if not hasattr(self._prov, "get_overruns"):
+            return
+
+        try:
+            overruns = self._prov.get_overruns()
+        except Error as err:
+            _LOG.debug("failed to get trace buffer overruns count:\n%s", err)
+            return
+
+        if overruns:
+            _LOG.warning("%d raw datapoints were lost because of trace buffer overflows, consider "
+                         "increasing the trace buffer size", overruns)
+
+        self._res.info["ftrace_overruns"] = overruns
+        self._res.write_info()
+
     def _get_cmdline(self):
         """Get kernel boot parameters."""
 
@@ -188,6 +310,17 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
         self._res.info["devdescr"] = self._dev.info["descr"]
         self._res.info["resolution"] = self._dev.info["resolution"]
         self._res.info["early_intr"] = self._early_intr
+        if self._pkgq:
+            self._res.info["pkg_quiesce"] = self._pkg_quiesce
+        if self._fsweep:
+            self._res.info["freq_sweep"] = self._freq_sweep
+
+        if self._calib and self._calibrate_mode == "cached":
+            calib = self._calib.get_cached()
+            if calib:
+                self._res.info["calibration"] = calib
+                self._calib.close()
+                self._calib = None
 
         # Initialize statistics collection.
         if self._stconf:
@@ -231,7 +364,8 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
                         f"only the following drivers are supported: {supported}")
 
     def __init__(self, pman, dev, res, ldist=None, early_intr=None, tsc_cal_time=10, rcsobj=None,
-                 stconf=None):
+                 stconf=None, trbufsize=None, pkg_quiesce=None, calibrate=None,
+                 idle_hist_raw=False, perf_events=None, freq_sweep=None, freq_sweep_period=None):
         """
         The class constructor. The arguments are as follows.
           * pman - the process manager object that defines the host to run the measurements on.
@@ -244,6 +378,23 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
           * rcsobj - the 'Cstates.ReqCStates()' object initialized for the measured system.
           * stconf - the statistics configuration, a dictionary describing the statistics that
                      should be collected. By default no statistics will be collected.
+          * trbufsize - the measured CPU trace buffer size in KiB.
+          * pkg_quiesce - the method of quiescing the other CPUs of the measured CPU package for the
+                          duration of the measurements, one of '_PkgQuiesce.METHODS'. This makes the
+                          package enter package C-states way more often. By default, the other CPUs
+                          are not quiesced.
+          * calibrate - the measurement floor calibration mode, one of '_Calibration.MODES'. The
+                        calibration runs right before the measurements, and the results are saved
+                        in the 'info.yml' file. By default, there is no calibration.
+          * idle_hist_raw - save the raw idle history of the measured CPU (the last idle durations
+                            preceding every datapoint) in addition to its summary.
+          * perf_events - list of 'NAME=SPEC' perf event specifications to read on idle entry and
+                          exit. Supported only by the eBPF-based delayed event devices.
+          * freq_sweep - list of frequencies in MHz to step the measured CPU frequency through
+                         during the measurements. Every datapoint is tagged with the frequency it
+                         was collected at. By default, the frequency is not changed.
+          * freq_sweep_period - the frequency step period in seconds, default is
+                                '_FreqSweep.DEFAULT_PERIOD'.
         """
 
         self._pman = pman
@@ -253,12 +404,20 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
         self._early_intr = early_intr
         self._stconf = stconf
         self._rcsobj = rcsobj
+        self._pkg_quiesce = pkg_quiesce
+        self._calibrate_mode = calibrate
+        self._freq_sweep = freq_sweep
 
         self._dpp = None
         self._prov = None
         self._timeout = 10
+        # The SUT clock the 'AITS1' raw datapoint field is read from.
+        self._dp_clock = "Boottime" if dev.helpername else "MonotonicRaw"
         self._progress = None
         self._stcoll = None
+        self._pkgq = None
+        self._calib = None
+        self._fsweep = None
 
         if res.info["toolname"] != "wult":
             raise Error(f"unsupported non-wult test result at {res.dirpath}.\nPlease, provide a "
@@ -269,8 +428,22 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
         if self._dev.drvname == "wult_tdt" and self._early_intr:
             raise Error("the 'tdt' driver does not support the early interrupt feature")
 
+        if perf_events and not dev.helpername:
+            raise Error(f"device '{dev.info['devid']}' does not support perf events, they are "
+                        f"supported only by eBPF-based delayed event devices")
+
         self._progress = _ProgressLine.ProgressLine(period=1)
 
+        if pkg_quiesce:
+            self._pkgq = _PkgQuiesce.PkgQuiesce(pman, res.cpunum, method=pkg_quiesce)
+
+        if calibrate:
+            self._calib = _Calibration.Calibration(pman, res.cpunum, dev.drvname)
+
+        if freq_sweep:
+            self._fsweep = _FreqSweep.FreqSweep(pman, res.cpunum, freq_sweep, self._dp_clock,
+                                                period=freq_sweep_period)
+
         if dev.helpername:
             wultrunner_path = Deploy.get_installed_helper_path(pman, "wult", dev.helpername)
         else:
@@ -280,15 +453,19 @@ class WultRunner(ClassHelpers.SimpleCloseContext):
                                                               wultrunner_path=wultrunner_path,
                                                               timeout=self._timeout,
                                                               ldist=self._ldist,
-                                                              early_intr=self._early_intr)
+                                                              early_intr=self._early_intr,
+                                                              trbufsize=trbufsize,
+                                                              idle_hist_raw=idle_hist_raw,
+                                                              perf_events=perf_events)
 
         self._dpp = _WultDpProcess.DatapointProcessor(res.cpunum, pman, self._dev.drvname,
                                                       early_intr=self._early_intr,
-                                                      tsc_cal_time=tsc_cal_time, rcsobj=rcsobj)
+                                                      tsc_cal_time=tsc_cal_time, rcsobj=rcsobj,
+                                                      perf_events=perf_events)
 
     def close(self):
         """Stop the measurements."""
 
-        close_attrs = ("_dpp", "_prov", "_stcoll")
+        close_attrs = ("_dpp", "_prov", "_stcoll", "_pkgq", "_calib", "_fsweep")
         unref_attrs = ("_res", "_dev", "_pman", "_rcsobj")
         ClassHelpers.close(self, close_attrs=close_attrs, unref_attrs=unref_attrs)
@@ -0,0 +1,217 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides API for calibrating the measurement floor - the latency wult measures when
+there is no C-state exit cost at all.
+
+During calibration, all C-states except for 'POLL' are disabled on the measured CPU, so the CPU
+busy-polls instead of entering a C-state. The latency measured in this case is the residual
+overhead of the delayed event device, the driver, and the time adjustments. Its distribution is
+stored in the test result 'info.yml' file and in a per-SUT cache, so that it can be reused.
+"""
+
+import os
+import time
+import logging
+from pathlib import Path
+import numpy
+from pepclibs.helperlibs import ClassHelpers, YAML
+from pepclibs.helperlibs.Exceptions import Error
+from wultlibs.helperlibs import KernelVersion
+
+_LOG = logging.getLogger()
+
+# The supported calibration modes.
+#   * run - always calibrate, and update the cache.
+#   * cached - use the cached calibration results, calibrate only if there are none.
+MODES = ("run", "cached")
+
+# Default count of datapoints to collect for calibration.
+DEFAULT_DPCNT = 10000
+
+# The metrics to calibrate.
+METRICS = ("WakeLatency", "IntrLatency")
+
+# The summary functions stored for every metric.
+_SMRY_FUNCS = {"min": numpy.min, "med": numpy.median, "avg": numpy.mean,
+               "99%": lambda vals: numpy.percentile(vals, 99),
+               "99.9%": lambda vals: numpy.percentile(vals, 99.9), "max": numpy.max}
+
+def get_cache_path(hostname, drvname, cpunum, kver):
+    """
+    Returns path to the calibration results cache file for SUT 'hostname', wult driver 'drvname',
+    measured CPU 'cpunum', and SUT kernel version 'kver'. The measurement floor depends on all of
+    them, so results calibrated for a different CPU or kernel are not reused.
+    """
+
+    basedir = os.environ.get("XDG_CACHE_HOME")
+    if not basedir:
+        basedir = Path.home() / ".cache"
+    return Path(basedir) / "wult" / "calibration" / f"{hostname}-{drvname}-cpu{cpunum}-{kver}.yml"
+
+class Calibration(ClassHelpers.SimpleCloseContext):
+    """
+    This class implements measurement floor calibration. Usage model.
+      1. Call 'get_cached()' to check if there are cached calibration results.
+      2. If there are none, call 'start()', then feed processed datapoints to 'add_datapoint()'
+         until it returns 'True', then call 'finish()' to get the results.
+    """
+
+    def get_cached(self):
+        """
+        Returns the cached calibration results dictionary, or 'None' if there are no cached
+        results.
+        """
+
+        if not self._cache_path.exists():
+            return None
+
+        try:
+            calib = YAML.load(self._cache_path)
+        except Error as err:
+            _LOG.warning("ignoring bad calibration cache file '%s':\n%s", self._cache_path, err)
+            return None
+
+        _LOG.info("Using cached calibration results from '%s' (calibrated on %s)",
+                  self._cache_path, calib.get("date"))
+        return calib
+
+    def _read_cstates(self):
+        """
+        Returns the '{state_dir: (name, disable)}' dictionary for the cpuidle states of the
+        measured CPU.
+        """
+
+        pattern = f"/sys/devices/system/cpu/cpu{self._cpunum}/cpuidle/state*"
+        cmd = f"grep -H . {pattern}/name {pattern}/disable"
+        stdout, _ = self._pman.run_verify(cmd, join=False)
+
+        states = {}
+        for line in stdout:
+            path, _, val = line.strip().partition(":")
+            statedir, _, fname = path.rpartition("/")
+            states.setdefault(statedir, {})[fname] = val
+
+        return {statedir: (info.get("name"), info.get("disable")) for statedir, info in
+                states.items()}
+
+    def _write_disable(self, statedir, val):
+        """Write 'val' to the 'disable' file of cpuidle state directory 'statedir'."""
+
+        with self._pman.open(f"{statedir}/disable", "w") as fobj:
+            fobj.write(val)
+
+    def start(self):
+        """Disable all C-states but 'POLL' on the measured CPU, and start collecting datapoints."""
+
+        _LOG.info("Calibrating the measurement floor on CPU %d%s, collecting %d datapoints with "
+                  "only the POLL state enabled", self._cpunum, self._pman.hostmsg, self._dpcnt)
+
+        states = self._read_cstates()
+        if not any(name == "POLL" for name, _ in states.values()):
+            raise Error(f"cannot calibrate the measurement floor: no POLL state on CPU "
+                        f"{self._cpunum}{self._pman.hostmsg}")
+
+        for statedir, (name, disable) in states.items():
+            if name != "POLL" and disable == "0":
+                self._write_disable(statedir, "1")
+                self._disabled.append(statedir)
+            elif name == "POLL" and disable != "0":
+                self._write_disable(statedir, "0")
+                self._enabled.append(statedir)
+
+    def add_datapoint(self, dp):
+        """
+        Add processed datapoint 'dp'. Returns 'True' when enough datapoints have been collected.
+        """
+
+        # Datapoints for other C-states may be still in the pipeline right after 'start()'.
+        if dp["ReqCState"] != "POLL":
+            return False
+
+        for metric in METRICS:
+            if metric in dp:
+                self._vals[metric].append(dp[metric])
+
+        return self.get_dpcnt() >= self._dpcnt
+
+    def get_dpcnt(self):
+        """Returns the count of datapoints collected so far."""
+        return len(self._vals[METRICS[0]])
+
+    def _restore(self):
+        """Restore the C-states changed by 'start()'."""
+
+        for statedir in self._disabled:
+            self._write_disable(statedir, "0")
+        for statedir in self._enabled:
+            self._write_disable(statedir, "1")
+        self._disabled = []
+        self._enabled = []
+
+    def finish(self):
+        """
+        Restore the C-states and return the calibration results dictionary. The results are also
+        saved in the cache.
+        """
+
+        self._restore()
+
+        calib = {"date": time.strftime("%d %b %Y"), "dpcnt": self.get_dpcnt()}
+        for metric, vals in self._vals.items():
+            if vals:
+                vals = numpy.asarray(vals)
+                calib[metric] = {fname: float(func(vals)) for fname, func in _SMRY_FUNCS.items()}
+
+        if not calib["dpcnt"]:
+            raise Error("no datapoints collected for the measurement floor calibration")
+
+        _LOG.info("Measurement floor: median 'WakeLatency' is %.2fus, 99%% is %.2fus",
+                  calib["WakeLatency"]["med"], calib["WakeLatency"]["99%"])
+
+        try:
+            self._cache_path.parent.mkdir(parents=True, exist_ok=True)
+            YAML.dump(calib, self._cache_path)
+        except (OSError, Error) as err:
+            _LOG.warning("failed to save calibration results to '%s':\n%s", self._cache_path, err)
+
+        return calib
+
+    def __init__(self, pman, cpunum, drvname, dpcnt=None):
+        """
+        The class constructor. The arguments are as follows.
+          * pman - the process manager object that defines the SUT.
+          * cpunum - the measured CPU number.
+          * drvname - name of the wult driver used for the measurements.
+          * dpcnt - count of datapoints to collect, default is 'DEFAULT_DPCNT'.
+        """
+
+        self._pman = pman
+        self._cpunum = cpunum
+        self._dpcnt = dpcnt if dpcnt else DEFAULT_DPCNT
+        kver = KernelVersion.get_kver(pman=pman)
+        self._cache_path = get_cache_path(pman.hostname, drvname, cpunum, kver)
+
+        # The cpuidle state directories changed by 'start()'.
+        self._disabled = []
+        self._enabled = []
+        # The collected metric values.
+        self._vals = {metric: [] for metric in METRICS}
+
+    def close(self):
+        """Restore the C-states and uninitialize the class object."""
+
+        if getattr(self, "_disabled", None) or getattr(self, "_enabled", None):
+            try:
+                self._restore()
+            except Error as err:
+                _LOG.warning("failed to restore C-states of CPU %d%s:\n%s", self._cpunum,
+                             self._pman.hostmsg, err)
+
+        ClassHelpers.close(self, unref_attrs=("_pman",))
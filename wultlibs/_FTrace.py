@@ -10,15 +10,25 @@
 This module provides API for dealing with Linux function trace buffer.
 """
 
+import os
+import re
+import queue
+import select
+import struct
 import logging
+import threading
 import contextlib
 from pepclibs.helperlibs import ClassHelpers
 from pepclibs.helperlibs.Exceptions import Error, ErrorNotSupported, ErrorTimeOut
 from statscollectlibs.helperlibs import ProcHelpers
+from wultlibs import _StreamShim
 from wultlibs.helperlibs import FSHelpers
 
 _LOG = logging.getLogger()
 
+# Default per-CPU trace buffer size in KiB for dedicated ftrace instances.
+DEFAULT_BUFSIZE = 8192
+
 class FTraceLine():
     """
     This class represents an ftrace buffer line. When an instance is created, the trace buffer line
@@ -61,6 +71,51 @@ class FTrace(ClassHelpers.SimpleCloseContext):
         with self._pman.open(self._paths["trace"], "w+") as fobj:
             fobj.write("0")
 
+    def get_overruns(self, cpunum):
+        """
+        Returns the count of events lost because of the trace buffer of CPU 'cpunum' overflowing.
+        """
+
+        path = self._tracing_dir / f"per_cpu/cpu{cpunum}/stats"
+        with self._pman.open(path, "r") as fobj:
+            for line in fobj:
+                key, _, val = line.partition(":")
+                if key.strip() == "overrun":
+                    return int(val)
+
+        raise Error(f"no overrun count in '{path}'{self._pman.hostmsg}")
+
+    def _setup_instance(self, cpunum, bufsize):
+        """
+        Create the dedicated ftrace instance, unless it already exists, and configure its buffer
+        size.
+        """
+
+        if not self._pman.is_dir(self._tracing_dir):
+            _LOG.debug("creating ftrace instance '%s'%s", self._tracing_dir, self._pman.hostmsg)
+            self._pman.mkdir(self._tracing_dir)
+            self._remove_instance = True
+
+        if bufsize is None:
+            bufsize = DEFAULT_BUFSIZE
+
+        if cpunum is None:
+            path = self._tracing_dir / "buffer_size_kb"
+        else:
+            # Only the measured CPU needs a large buffer, keep the other CPU buffers minimal to save
+            # memory.
+            with self._pman.open(self._tracing_dir / "buffer_size_kb", "w") as fobj:
+                fobj.write("4")
+            path = self._tracing_dir / f"per_cpu/cpu{cpunum}/buffer_size_kb"
+
+        _LOG.debug("setting trace buffer size to %d KiB", bufsize)
+        try:
+            with self._pman.open(path, "w") as fobj:
+                fobj.write(str(bufsize))
+        except Error as err:
+            raise Error(f"failed to set trace buffer size to {bufsize} KiB{self._pman.hostmsg}:\n"
+                        f"{err}") from err
+
     def getlines(self):
         """
         Yield trace buffer lines one-by-one. Wait for a trace line for maximum 'timeout' seconds.
@@ -80,33 +135,55 @@ class FTrace(ClassHelpers.SimpleCloseContext):
                 msg = self._reader.get_cmd_failure_msg(stdout, stderr, exitcode)
                 raise Error(f"the function trace reader process has exited unexpectedly:\n{msg}")
 
+            if self._decoder:
+                stdout = self._decoder.decode(stdout)
+
             for line in stdout:
                 if line.startswith("#"):
                     continue
                 self.raw_line = line.strip()
                 yield FTraceLine(line)
 
-    def __init__(self, pman, timeout=30):
+    def __init__(self, pman, timeout=30, instance=None, cpunum=None, bufsize=None, toolname=None):
         """
         Class constructor. The arguments are as follows.
           * pman - the process manager object that defines the host to operate on.
           * timeout - longest time in seconds to wait for data in the trace buffer.
+          * instance - name of the ftrace instance to use instead of the global trace buffer. The
+                       instance is created if it does not exist.
+          * cpunum - the CPU the traced events happen on. If specified, only this CPU trace buffer
+                     of the instance is sized to 'bufsize'.
+          * bufsize - trace buffer size in KiB for the ftrace instance, default is
+                      'DEFAULT_BUFSIZE'. Ignored if 'instance' is not specified.
+          * toolname - name of the tool the 'stream-shim' helper was deployed by. If specified, the
+                       trace buffer of a remote host is transferred in compressed batches via the
+                       helper (see '_StreamShim').
         """
 
         self._reader = None
+        self._decoder = None
         self._pman = pman
         self.timeout = timeout
+        self._toolname = toolname
 
         self._paths = {}
         self._debugfs_mntpoint = None
         self._unmount_debugfs = None
+        self._tracing_dir = None
+        self._remove_instance = False
         self._disable_tracing = None
         self.raw_line = None
 
         self._debugfs_mntpoint, self._unmount_debugfs = FSHelpers.mount_debugfs(pman=self._pman)
-        self._paths["trace"] = self._debugfs_mntpoint.joinpath("tracing/trace")
-        self._paths["trace_pipe"] = self._debugfs_mntpoint.joinpath("tracing/trace_pipe")
-        self._paths["tracing_on"] = self._debugfs_mntpoint.joinpath("tracing/tracing_on")
+
+        self._tracing_dir = self._debugfs_mntpoint / "tracing"
+        if instance:
+            self._tracing_dir = self._tracing_dir / "instances" / instance
+            self._setup_instance(cpunum, bufsize)
+
+        self._paths["trace"] = self._tracing_dir / "trace"
+        self._paths["trace_pipe"] = self._tracing_dir / "trace_pipe"
+        self._paths["tracing_on"] = self._tracing_dir / "tracing_on"
 
         for path in self._paths.values():
             if not self._pman.is_file(path):
@@ -125,6 +202,13 @@ class FTrace(ClassHelpers.SimpleCloseContext):
                 self._disable_tracing = True
 
         self._clear()
+        self._start_reader(cmd)
+
+    def _start_reader(self, cmd):
+        """Start the trace buffer reader process."""
+
+        if self._toolname:
+            cmd, self._decoder = _StreamShim.wrap_cmd(self._pman, cmd, self._toolname)
         self._reader = self._pman.run_async(cmd)
 
     def close(self):
@@ -143,8 +227,383 @@ class FTrace(ClassHelpers.SimpleCloseContext):
                     fobj.write("0")
                 self._disable_tracing = False
 
+        if getattr(self, "_remove_instance", None):
+            # This fails if the instance is still in use, e.g., by a loaded driver.
+            with contextlib.suppress(Error):
+                self._pman.run_verify(f"rmdir '{self._tracing_dir}'")
+            self._remove_instance = False
+
         if getattr(self, "_unmount_debugfs", None):
             with contextlib.suppress(Error):
                 self._pman.run(f"unmount {self._debugfs_mntpoint}")
 
         ClassHelpers.close(self, unref_attrs=("_reader", "_pman"))
+
+
+# The ring buffer event header 'type_len' values with special meaning (see 'events/header_event').
+_RB_TYPE_PADDING = 29
+_RB_TYPE_TIME_EXTEND = 30
+_RB_TYPE_TIME_STAMP = 31
+# The ring buffer page 'commit' field flags, the rest of the bits is the data size.
+_RB_MISSED_EVENTS = 1 << 31
+_RB_MISSED_STORED = 1 << 30
+_RB_COMMIT_SIZE_MASK = _RB_MISSED_STORED - 1
+
+# The ftrace format file field line regular expression.
+_FORMAT_FIELD_REGEX = re.compile(r"field:\s*(?P<type>.*?)\s*(?P<name>\w+)(\[\d*\])?;\s*"
+                                 r"offset:(?P<offset>\d+);\s*size:(?P<size>\d+);\s*"
+                                 r"signed:(?P<signed>\d+);")
+
+# 'struct' module format characters for unsigned and signed integers of various sizes.
+_INT_FMT = {1: "B", 2: "H", 4: "I", 8: "Q"}
+
+# How often the trace buffer reader thread checks for the stop request, in seconds.
+_READER_POLL_INTERVAL = 0.5
+
+class FTraceRawDecoder:
+    """
+    This class decodes the Linux function trace ring buffer pages and yields the records of a single
+    trace event. The ring buffer layout is described by the ftrace 'events/header_page' file and
+    the event format file, and this class takes their contents, so it does not access the host.
+    """
+
+    @staticmethod
+    def _parse_format(text):
+        """
+        Parse ftrace format file contents 'text' and return a tuple of the event ID (or 'None' if
+        there is no event ID) and a dictionary of fields. The dictionary keys are field names, the
+        values are '(offset, size, signed)' tuples.
+        """
+
+        evid = None
+        fields = {}
+
+        for line in text.splitlines():
+            line = line.strip()
+            if line.startswith("ID:"):
+                evid = int(line[3:])
+                continue
+
+            match = re.match(_FORMAT_FIELD_REGEX, line)
+            if match:
+                fields[match.group("name")] = (int(match.group("offset")),
+                                               int(match.group("size")),
+                                               match.group("signed") == "1")
+
+        return evid, fields
+
+    def _read_u32(self, page, off):
+        """Read a 32-bit integer at offset 'off' of ring buffer page 'page'."""
+
+        if off + 4 > len(page):
+            raise Error(f"bad ftrace ring buffer page{self._hostmsg}: offset {off} is beyond the "
+                        f"end of the page")
+        return int.from_bytes(page[off:off + 4], "little")
+
+    def decode_page(self, page):
+        """Decode ring buffer page 'page' and yield the records of the traced event."""
+
+        commit = int.from_bytes(page[self._commit_off:self._commit_off + self._commit_size],
+                                "little")
+        if commit & _RB_MISSED_EVENTS:
+            self.missed_pages += 1
+            if self.missed_pages == 1:
+                _LOG.warning("ftrace ring buffer overrun, some events were lost%s", self._hostmsg)
+
+        off = self._data_off
+        end = off + (commit & _RB_COMMIT_SIZE_MASK)
+        if end > len(page):
+            raise Error(f"bad ftrace ring buffer page{self._hostmsg}: data size is "
+                        f"{end - self._data_off} bytes, but the page is {len(page)} bytes")
+
+        while off < end:
+            hdr = self._read_u32(page, off)
+            type_len = hdr & 0x1f
+            off += 4
+            data_off = off
+
+            if type_len == _RB_TYPE_PADDING:
+                if not hdr >> 5:
+                    # Zero time delta means that the rest of the page is empty.
+                    break
+                # The padding length includes the length field itself.
+                length = self._read_u32(page, off)
+                minlen = 4
+            elif type_len in (_RB_TYPE_TIME_EXTEND, _RB_TYPE_TIME_STAMP):
+                length = minlen = 4
+            elif type_len == 0:
+                # The data length is in the first field of the record, which it also includes.
+                length = (self._read_u32(page, off) + 3) & ~3
+                data_off += 4
+                minlen = 8
+            else:
+                length = minlen = type_len * 4
+
+            if length < minlen or off + length > len(page):
+                raise Error(f"bad ftrace ring buffer record at offset {off - 4}{self._hostmsg}: "
+                            f"record type {type_len}, length {length} bytes, page size "
+                            f"{len(page)} bytes")
+
+            if type_len < _RB_TYPE_PADDING:
+                evid = int.from_bytes(page[data_off + self._evid_off:
+                                           data_off + self._evid_off + self._evid_size], "little")
+                if evid == self._evid:
+                    if off + length - data_off < self._struct.size:
+                        raise Error(f"bad '{self._event}' event record in the ftrace ring buffer"
+                                    f"{self._hostmsg}: record size is {off + length - data_off} "
+                                    f"bytes, expected at least {self._struct.size} bytes")
+                    yield dict(zip(self.fields, self._struct.unpack_from(page, data_off)))
+
+            off += length
+
+    def __init__(self, header_page, evformat, event, hostmsg=""):
+        """
+        Class constructor. The arguments are as follows.
+          * header_page - contents of the ftrace 'events/header_page' file.
+          * evformat - contents of the format file of the trace event to decode the records of.
+          * event - name of the trace event, used in messages.
+          * hostmsg - the host message to use in messages (e.g., "on host 'sut'").
+        """
+
+        self._event = event
+        self._hostmsg = hostmsg
+
+        # Names of the decoded event fields.
+        self.fields = []
+        # Count of ring buffer pages with the "missed events" flag.
+        self.missed_pages = 0
+
+        _, hdr_fields = self._parse_format(header_page)
+        try:
+            self._data_off, data_size, _ = hdr_fields["data"]
+            self._commit_off, self._commit_size, _ = hdr_fields["commit"]
+        except KeyError as err:
+            raise Error(f"bad ftrace ring buffer page header format{hostmsg}: no {err} "
+                        f"field") from None
+        # Size of a ring buffer page in bytes.
+        self.page_size = self._data_off + data_size
+
+        self._evid, fields = self._parse_format(evformat)
+        if self._evid is None:
+            raise Error(f"bad format of event '{event}'{hostmsg}: no event ID")
+        if "common_type" not in fields:
+            raise Error(f"bad format of event '{event}'{hostmsg}: no 'common_type' field")
+
+        # Build a 'struct' format for unpacking the event fields in one go. Skip the common fields,
+        # they are the same for all events and we do not need them.
+        fmt = "<"
+        pos = 0
+        for name, (offset, size, signed) in sorted(fields.items(), key=lambda item: item[1][0]):
+            if name.startswith("common_"):
+                continue
+            if size not in _INT_FMT:
+                _LOG.debug("skipping non-integer field '%s' of event '%s'", name, event)
+                continue
+
+            fmt += "x" * (offset - pos)
+            fmt += _INT_FMT[size].lower() if signed else _INT_FMT[size]
+            pos = offset + size
+            self.fields.append(name)
+
+        self._evid_off, self._evid_size, _ = fields["common_type"]
+        self._struct = struct.Struct(fmt)
+
+class FTraceRaw(FTrace):
+    """
+    This class represents the Linux function trace buffer of a single CPU, read in the binary
+    format via 'per_cpu/cpuN/trace_pipe_raw'. This class decodes the ring buffer pages and the
+    records of a single trace event, and yields numeric records without any text formatting.
+
+    The trace buffer of the local host is read directly. The trace buffer of a remote host is read
+    by a process running on the remote host, and transferred via the 'stream-shim' helper in the
+    binary mode, because the process manager carries only text.
+    """
+
+    def _init_decoder(self):
+        """
+        Read the ring buffer page header and the event format files and create the ring buffer page
+        decoder. This has to be done lazily, because the event may not exist when the class
+        instance is created (e.g., if it is a synthetic event created by a driver).
+        """
+
+        texts = []
+        for path in (self._paths["header_page"],
+                     self._debugfs_mntpoint / "tracing/events" / self._event / "format"):
+            with self._pman.open(path, "r") as fobj:
+                texts.append(fobj.read())
+
+        self._rbdecoder = FTraceRawDecoder(*texts, self._event, hostmsg=self._pman.hostmsg)
+
+    def _reader_thread(self):
+        """
+        The trace buffer reader thread. Read the ring buffer pages and put them to the queue. The
+        read operation blocks until there is data in the ring buffer, so it is done in a separate
+        thread in order to implement the timeout. The trace buffer file is polled with a timeout, so
+        that the thread notices the stop request of 'close()'.
+        """
+
+        try:
+            fd = os.open(self._paths["trace_pipe_raw"], os.O_RDONLY | os.O_NONBLOCK)
+        except OSError as err:
+            self._queue.put(err)
+            return
+
+        try:
+            while not self._stop_reader:
+                rlist, _, _ = select.select([fd], [], [], _READER_POLL_INTERVAL)
+                if not rlist:
+                    continue
+
+                try:
+                    page = os.read(fd, self._rbdecoder.page_size)
+                except BlockingIOError:
+                    continue
+
+                if page:
+                    self._queue.put(page)
+        except Exception as err: # pylint: disable=broad-except
+            self._queue.put(err)
+        finally:
+            os.close(fd)
+
+    def _get_local_pages(self):
+        """Yield ring buffer pages read from the local trace buffer by the reader thread."""
+
+        if not self._thread:
+            self._thread = threading.Thread(target=self._reader_thread, daemon=True)
+            self._thread.start()
+
+        while True:
+            try:
+                page = self._queue.get(timeout=self.timeout)
+            except queue.Empty:
+                raise ErrorTimeOut(f"no data in trace buffer for {self.timeout} seconds"
+                                   f"{self._pman.hostmsg}") from None
+
+            if isinstance(page, Exception):
+                raise Error(f"failed to read '{self._paths['trace_pipe_raw']}'"
+                            f"{self._pman.hostmsg}:\n{page}")
+
+            yield page
+
+    def _get_remote_pages(self):
+        """Yield ring buffer pages read from the remote trace buffer by the reader process."""
+
+        if not self._reader:
+            cmd = f"cat {self._paths['trace_pipe_raw']}"
+            name = "stale wult raw function trace reader process"
+            ProcHelpers.kill_processes(cmd, kill_children=True, log=True, name=name,
+                                       pman=self._pman)
+
+            cmd, self._decoder = _StreamShim.wrap_cmd(self._pman, cmd, self._toolname, binary=True)
+            if not self._decoder:
+                raise Error(f"BUG: the '{_StreamShim.SHIM_NAME}' helper is not available"
+                            f"{self._pman.hostmsg}")
+            self._reader = self._pman.run_async(cmd)
+
+        data = bytearray()
+        while True:
+            stdout, stderr, exitcode = self._reader.wait(timeout=self.timeout, lines=[32, None],
+                                                         join=False)
+            if not stdout and not stderr and exitcode is None:
+                raise ErrorTimeOut(f"no data in trace buffer for {self.timeout} seconds"
+                                   f"{self._pman.hostmsg}")
+
+            if exitcode is not None or stderr:
+                msg = self._reader.get_cmd_failure_msg(stdout, stderr, exitcode)
+                raise Error(f"the function trace reader process has exited unexpectedly:\n{msg}")
+
+            # Every read from 'trace_pipe_raw' returns a whole ring buffer page.
+            data += self._decoder.decode(stdout)
+            off = 0
+            page_size = self._rbdecoder.page_size
+            while len(data) - off >= page_size:
+                yield bytes(data[off:off + page_size])
+                off += page_size
+            del data[:off]
+
+    def getrecords(self):
+        """
+        Yield trace event records one-by-one. Each record is a dictionary with field names as keys
+        and integer field values as values. Wait for a record for maximum 'timeout' seconds.
+        """
+
+        if not self._rbdecoder:
+            self._init_decoder()
+
+        if self._pman.is_remote:
+            pages = self._get_remote_pages()
+        else:
+            pages = self._get_local_pages()
+
+        for page in pages:
+            yield from self._rbdecoder.decode_page(page)
+
+    def _start_reader(self, cmd):
+        """
+        The reader thread is started on the first 'getrecords()' call, because it needs the event
+        format, which may not be available yet.
+        """
+
+    def _stop_reader_thread(self):
+        """Stop the reader thread and wait for it to exit."""
+
+        self._stop_reader = True
+        if self._thread:
+            self._thread.join()
+            self._thread = None
+
+    def __init__(self, pman, cpunum, event, timeout=30, instance=None, bufsize=None,
+                 toolname=None):
+        """
+        Class constructor. The arguments are as follows.
+          * pman - the process manager object that defines the host to operate on.
+          * cpunum - number of the CPU to read the trace buffer of.
+          * event - the trace event to read the records of, in the "subsystem/name" format (e.g.,
+                    "synthetic/wult_cpu_idle"). Records of other events are ignored.
+          * timeout - longest time in seconds to wait for data in the trace buffer.
+          * instance - same as in 'FTrace.__init__()'.
+          * bufsize - same as in 'FTrace.__init__()'.
+          * toolname - same as in 'FTrace.__init__()'. Required for reading the trace buffer of a
+                       remote host.
+        """
+
+        self._cpunum = cpunum
+        self._event = event
+
+        self._thread = None
+        self._stop_reader = False
+        self._queue = queue.Queue()
+
+        self._rbdecoder = None
+
+        if pman.is_remote and not (toolname and _StreamShim.is_available(pman, toolname)):
+            raise ErrorNotSupported(f"reading the trace buffer in the binary format{pman.hostmsg} "
+                                    f"requires the '{_StreamShim.SHIM_NAME}' helper")
+
+        super().__init__(pman, timeout=timeout, instance=instance, cpunum=cpunum, bufsize=bufsize,
+                         toolname=toolname)
+
+        self._paths["header_page"] = self._debugfs_mntpoint / "tracing/events/header_page"
+        self._paths["trace_pipe_raw"] = self._tracing_dir / f"per_cpu/cpu{cpunum}/trace_pipe_raw"
+
+        for name in ("header_page", "trace_pipe_raw"):
+            if not self._pman.is_file(self._paths[name]):
+                self.close()
+                raise ErrorNotSupported(f"linux ftrace file '{self._paths[name]}' not found"
+                                        f"{self._pman.hostmsg}")
+
+        # Since Linux v6.1, polling the trace buffer waits until it is 'buffer_percent' full (50% by
+        # default). Make the dedicated instance wake the reader up as soon as there is any data.
+        path = self._tracing_dir / "buffer_percent"
+        if instance and self._pman.is_file(path):
+            with self._pman.open(path, "w") as fobj:
+                fobj.write("0")
+
+    def close(self):
+        """Stop reading the trace buffer."""
+
+        # Stop the reader thread before releasing the process manager and removing the instance.
+        if getattr(self, "_thread", None):
+            self._stop_reader_thread()
+        super().close()
@@ -0,0 +1,241 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides API for sweeping the measured CPU frequency during the measurements.
+
+Wake latency depends on the P-state the CPU resumes at. The frequency sweep pins the measured CPU
+frequency by setting both the minimum and the maximum cpufreq sysfs frequency limits to the same
+value, and steps this value through a list of frequencies during the measurements, so that a single
+test result includes datapoints for every frequency of the list.
+
+Datapoints are tagged with the frequency by their time-stamps, not by the time they are processed,
+because datapoints may reach the host long after they were measured (e.g., because of the trace
+buffer lag). Therefore, the SUT time is recorded right before and right after every frequency step,
+using the same SUT clock as the datapoint time-stamps.
+"""
+
+import re
+import time
+import logging
+from pepclibs.helperlibs import ClassHelpers, Trivial
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.helperlibs import ClockTable
+
+_LOG = logging.getLogger()
+
+# Default frequency step period in seconds.
+DEFAULT_PERIOD = 10
+
+# Datapoints measured during this amount of seconds after a frequency step are dropped, because
+# they may still be for the previous frequency.
+SETTLE_TIME = 0.1
+
+_FREQ_RE = re.compile(r"^(\d+(?:\.\d+)?)\s*(GHz|MHz|kHz)?$", re.IGNORECASE)
+_FREQ_MULT = {"ghz": 1000, "mhz": 1, "khz": 0.001}
+
+def parse_freqs(freqs):
+    """
+    Parse and validate the frequency sweep list ('--freq-sweep' option). The 'freqs' argument is a
+    string of comma-separated frequencies, which may include the "GHz", "MHz", or "kHz" specifiers,
+    the default is "MHz". Returns the list of frequencies as integers in MHz.
+    """
+
+    result = []
+    for freq in Trivial.split_csv_line(freqs):
+        match = _FREQ_RE.match(freq)
+        if not match:
+            raise Error(f"bad frequency '{freq}' in the frequency sweep list '{freqs}', use a "
+                        f"number with an optional 'GHz', 'MHz' or 'kHz' specifier")
+
+        mhz = int(float(match.group(1)) * _FREQ_MULT[(match.group(2) or "MHz").lower()])
+        if mhz <= 0:
+            raise Error(f"bad frequency '{freq}' in the frequency sweep list '{freqs}', should be "
+                        f"greater than zero")
+        result.append(mhz)
+
+    if not result:
+        raise Error("empty frequency sweep list")
+
+    return result
+
+class FreqSweep(ClassHelpers.SimpleCloseContext):
+    """
+    This class steps the measured CPU frequency through a list of frequencies, and restores the
+    original frequency limits afterwards.
+
+    Public methods overview.
+      * start() - set the first frequency of the list.
+      * update() - step to the next frequency if it is time.
+      * get_freq() - get the frequency a datapoint was measured at.
+      * restore() - restore the original frequency limits.
+    """
+
+    def _read_khz(self, fname):
+        """Read cpufreq sysfs file 'fname' of the measured CPU and return its value in kHz."""
+
+        path = f"{self._sysfs_base}/{fname}"
+        try:
+            with self._pman.open(path, "r") as fobj:
+                val = fobj.read().strip()
+        except Error as err:
+            raise Error(f"failed to read '{path}'{self._pman.hostmsg}:\n{err}") from None
+
+        if not Trivial.is_int(val):
+            raise Error(f"bad contents of '{path}'{self._pman.hostmsg}: '{val}', expected an "
+                        f"integer")
+        return int(val)
+
+    def _write_khz(self, fname, khz):
+        """Write 'khz' to cpufreq sysfs file 'fname' of the measured CPU."""
+
+        path = f"{self._sysfs_base}/{fname}"
+        try:
+            with self._pman.open(path, "w") as fobj:
+                fobj.write(str(khz))
+        except Error as err:
+            raise Error(f"failed to write '{khz}' to '{path}'{self._pman.hostmsg}:\n"
+                        f"{err}") from None
+
+    def _set_limits(self, min_khz, max_khz):
+        """
+        Set the minimum and maximum frequency limits of the measured CPU. The minimum limit cannot
+        be greater than the maximum limit, so the order of writes depends on the current limits.
+        """
+
+        if min_khz > self._cur_limits[1]:
+            self._write_khz("scaling_max_freq", max_khz)
+            self._write_khz("scaling_min_freq", min_khz)
+        else:
+            self._write_khz("scaling_min_freq", min_khz)
+            self._write_khz("scaling_max_freq", max_khz)
+
+        self._cur_limits = (min_khz, max_khz)
+
+    def _get_sut_time(self):
+        """Returns the current SUT time in nanoseconds in the clock of the datapoint time-stamps."""
+
+        snapshot = ClockTable.take_remote_snapshot(self._pman)
+        if not snapshot or self._clock not in snapshot:
+            raise Error(f"failed to read the '{self._clock}' clock{self._pman.hostmsg}, it is "
+                        f"required for tagging datapoints with the frequency sweep frequency")
+        return snapshot[self._clock]
+
+    def _step(self):
+        """Set the next frequency of the list."""
+
+        self._idx = (self._idx + 1) % len(self._freqs)
+        mhz = self._freqs[self._idx]
+
+        begin = self._get_sut_time()
+        self._set_limits(mhz * 1000, mhz * 1000)
+        end = self._get_sut_time()
+
+        self._steps.append((begin, end + int(SETTLE_TIME * 1000000000), mhz))
+        self._step_time = time.time()
+
+        _LOG.debug("set CPU %d frequency to %d MHz%s", self._cpunum, self._freqs[self._idx],
+                   self._pman.hostmsg)
+
+    def start(self):
+        """Save the original frequency limits of the measured CPU and set the first frequency."""
+
+        hw_min = self._read_khz("cpuinfo_min_freq")
+        hw_max = self._read_khz("cpuinfo_max_freq")
+        for mhz in self._freqs:
+            if not hw_min <= mhz * 1000 <= hw_max:
+                raise Error(f"frequency {mhz} MHz is out of the CPU {self._cpunum} frequency "
+                            f"range{self._pman.hostmsg}: {hw_min // 1000}-{hw_max // 1000} MHz")
+
+        self._orig_limits = (self._read_khz("scaling_min_freq"),
+                             self._read_khz("scaling_max_freq"))
+        self._cur_limits = self._orig_limits
+
+        freqs = ", ".join(f"{mhz} MHz" for mhz in self._freqs)
+        _LOG.info("Sweeping CPU %d frequency%s through %s, step period is %s seconds",
+                  self._cpunum, self._pman.hostmsg, freqs, self._period)
+
+        self._idx = -1
+        self._step()
+
+    def update(self):
+        """Step to the next frequency if the step period has expired."""
+
+        if time.time() - self._step_time >= self._period:
+            self._step()
+
+    def get_freq(self, tstamp):
+        """
+        Returns the frequency in MHz the datapoint with time-stamp 'tstamp' was measured at, or
+        'None' if it was measured before the first step or too close to a frequency step. The
+        'tstamp' argument is the SUT time in nanoseconds, in the clock passed to the constructor.
+        Datapoints are expected to come in the time-stamp order.
+        """
+
+        for idx in range(len(self._steps) - 1, -1, -1):
+            begin, settled, mhz = self._steps[idx]
+            if tstamp >= settled:
+                # Older steps are not needed for the following datapoints.
+                del self._steps[:idx]
+                return mhz
+            if tstamp >= begin:
+                return None
+
+        return None
+
+    def restore(self):
+        """Restore the original frequency limits of the measured CPU."""
+
+        if not self._orig_limits:
+            return
+
+        orig_limits = self._orig_limits
+        self._orig_limits = None
+        self._set_limits(*orig_limits)
+
+    def __init__(self, pman, cpunum, freqs, clock, period=None):
+        """
+        The class constructor. The arguments are as follows.
+          * pman - the process manager object that defines the SUT.
+          * cpunum - the measured CPU number.
+          * freqs - list of frequencies in MHz to step through (see 'parse_freqs()').
+          * clock - name of the SUT clock the datapoint time-stamps come from (e.g.,
+                    "MonotonicRaw", see 'ClockTable').
+          * period - the frequency step period in seconds, default is 'DEFAULT_PERIOD'. The
+                     frequencies are stepped through cyclically.
+        """
+
+        self._pman = pman
+        self._cpunum = cpunum
+        self._freqs = freqs
+        self._clock = clock
+        self._period = period if period else DEFAULT_PERIOD
+
+        self._sysfs_base = f"/sys/devices/system/cpu/cpu{cpunum}/cpufreq"
+
+        # The original and the current '(min, max)' frequency limits in kHz.
+        self._orig_limits = None
+        self._cur_limits = None
+        # Index of the current frequency in 'self._freqs' and the host time it was set.
+        self._idx = -1
+        self._step_time = 0
+        # The '(begin, settled, freq)' tuples for the frequency steps, where 'begin' is the SUT time
+        # before the step and 'settled' is the SUT time the datapoints are for 'freq' since.
+        self._steps = []
+
+    def close(self):
+        """Restore the frequency limits and uninitialize the class object."""
+
+        if getattr(self, "_orig_limits", None):
+            try:
+                self.restore()
+            except Error as err:
+                _LOG.warning("failed to restore CPU %d frequency limits%s:\n%s", self._cpunum,
+                             self._pman.hostmsg, err)
+
+        ClassHelpers.close(self, unref_attrs=("_pman",))
@@ -0,0 +1,321 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides API for quiescing the CPUs of a package. Package C-states are reached only when
+all CPUs of the package are idle, so while wult measures one CPU of the package, the other CPUs
+should stay idle as long as possible.
+
+The work is moved to the CPUs of the other packages, never to the measured CPU. Note, tasks forked
+during the measurements inherit the narrowed CPU affinity of their parents. 'restore()' finds such
+tasks and restores their CPU affinity too.
+"""
+
+import logging
+from pepclibs.helperlibs import ClassHelpers
+from pepclibs.helperlibs.Exceptions import Error
+
+_LOG = logging.getLogger()
+
+# The supported quiescing methods.
+#   * migrate - move IRQs, user-space tasks, and unbound workqueues off the other CPUs of the
+#               package, and enable all C-states on them.
+#   * offline - same as "migrate", and then offline the other CPUs of the package.
+METHODS = ("migrate", "offline")
+
+# Maximum count of commands to run in a single shell invocation.
+_MAX_BATCH = 256
+
+_SYSFS_CPU = "/sys/devices/system/cpu"
+_WQ_CPUMASK = "/sys/devices/virtual/workqueue/cpumask"
+
+def _parse_cpus(text):
+    """Parse a CPU list string like "0-3,8" and return the set of CPU numbers."""
+
+    cpus = set()
+    for item in text.strip().split(","):
+        if not item:
+            continue
+        first, _, last = item.partition("-")
+        try:
+            cpus.update(range(int(first), int(last if last else first) + 1))
+        except ValueError:
+            raise Error(f"bad CPU list '{text.strip()}'") from None
+    return cpus
+
+def _format_cpus(cpus):
+    """Format CPU numbers iterable 'cpus' as a CPU list string like "0-3,8"."""
+
+    ranges = []
+    for cpu in sorted(cpus):
+        if ranges and ranges[-1][1] == cpu - 1:
+            ranges[-1][1] = cpu
+        else:
+            ranges.append([cpu, cpu])
+    return ",".join(str(first) if first == last else f"{first}-{last}" for first, last in ranges)
+
+def _format_cpumask(cpus):
+    """Format CPU numbers iterable 'cpus' as a hexadecimal CPU mask with 32-bit comma groups."""
+
+    mask = 0
+    for cpu in cpus:
+        mask |= 1 << cpu
+
+    digits = f"{mask:x}"
+    digits = "0" * (-len(digits) % 8) + digits
+    return ",".join(digits[idx:idx + 8] for idx in range(0, len(digits), 8))
+
+class PkgQuiesce(ClassHelpers.SimpleCloseContext):
+    """
+    This class quiesces the CPUs of a package other than the measured CPU, and restores the original
+    settings afterwards.
+
+    Public methods overview.
+      * quiesce() - quiesce the other CPUs of the measured CPU package.
+      * restore() - restore the original settings.
+    """
+
+    def _run_batched(self, cmds):
+        """
+        Run shell commands 'cmds' on the SUT, batching them to limit the count of shell invocations.
+        Returns the list of output lines.
+        """
+
+        lines = []
+        for idx in range(0, len(cmds), _MAX_BATCH):
+            cmd = "; ".join(cmds[idx:idx + _MAX_BATCH])
+            stdout, _ = self._pman.run_verify(f"sh -c '{cmd}'", join=False)
+            lines += [line.strip() for line in stdout if line.strip()]
+        return lines
+
+    def _write(self, writes, what):
+        """
+        Write values to files on the SUT. The arguments are as follows.
+          * writes - list of '(path, value, orig_value)' tuples, 'orig_value' is written back by
+                     'restore()'.
+          * what - description of the written files for the messages.
+        """
+
+        cmds = [f"echo {val} > {path} 2>/dev/null || echo {path}" for path, val, _ in writes]
+        failed = set(self._run_batched(cmds))
+        if failed:
+            _LOG.debug("failed to change %d out of %d %s%s", len(failed), len(writes), what,
+                       self._pman.hostmsg)
+
+        for path, _, orig in writes:
+            if path not in failed:
+                self._undo.append(f"echo {orig} > {path} 2>/dev/null")
+
+        return len(writes) - len(failed)
+
+    def _read(self, pattern):
+        """
+        Read files matching shell pattern 'pattern' on the SUT. Returns the '{path: contents}'
+        dictionary. The files are expected to contain a single line.
+        """
+
+        stdout, _ = self._pman.run_verify(f"grep -H . {pattern} 2>/dev/null || true", join=False)
+
+        result = {}
+        for line in stdout:
+            path, sep, val = line.strip().partition(":")
+            if sep:
+                result[path] = val
+        return result
+
+    def _get_cpus(self):
+        """Find the other CPUs of the measured CPU package, and the CPUs to move the work to."""
+
+        topology = f"{_SYSFS_CPU}/cpu{self._cpunum}/topology"
+        for name in ("package_cpus_list", "core_siblings_list"):
+            pkg_cpus = self._read(f"{topology}/{name}")
+            if pkg_cpus:
+                pkg_cpus = _parse_cpus(next(iter(pkg_cpus.values())))
+                break
+        else:
+            raise Error(f"failed to find the package of CPU {self._cpunum}{self._pman.hostmsg}")
+
+        online = self._read(f"{_SYSFS_CPU}/online")
+        online = _parse_cpus(next(iter(online.values()))) if online else pkg_cpus
+
+        self._others = (pkg_cpus & online) - {self._cpunum}
+        # Never move the work to the measured CPU, it would disturb the measurements.
+        self._allowed = online - self._others - {self._cpunum}
+
+    def _migrate_irqs(self):
+        """Move IRQs off the other CPUs of the package."""
+
+        writes = []
+        for path, val in self._read("/proc/irq/*/smp_affinity_list").items():
+            cpus = _parse_cpus(val)
+            if not cpus & self._others:
+                continue
+            new = cpus & self._allowed
+            writes.append((path, _format_cpus(new if new else self._allowed), val))
+
+        cnt = self._write(writes, "IRQ affinities")
+        _LOG.info("Moved %d IRQs off CPUs %s", cnt, _format_cpus(self._others))
+
+    def _get_task_cpus(self):
+        """Return the '{tid: cpus}' dictionary with the CPU list strings of the SUT tasks."""
+
+        stdout, _ = self._pman.run_verify("grep -H Cpus_allowed_list /proc/[0-9]*/task/*/status "
+                                          "2>/dev/null || true", join=False)
+
+        result = {}
+        for line in stdout:
+            path, _, val = line.strip().partition(":Cpus_allowed_list:")
+            if val:
+                result[path.split("/")[4]] = val.strip()
+        return result
+
+    def _get_forked_tasks_undo(self):
+        """
+        Tasks forked by the migrated tasks during the measurements inherit the narrowed CPU
+        affinity. Find the tasks which did not exist at 'quiesce()' time and have one of the
+        narrowed CPU lists, and return the shell commands restoring the original CPU list for them.
+        """
+
+        cmds = []
+        for tid, val in self._get_task_cpus().items():
+            if tid not in self._tids and val in self._narrowed:
+                cmds.append(f"taskset -p -c {self._narrowed[val]} {tid} >/dev/null 2>&1")
+        return cmds
+
+    def _migrate_tasks(self):
+        """Move user-space tasks off the other CPUs of the package."""
+
+        # Kernel threads bound to a CPU cannot be moved, the 'taskset' fails for them.
+
+        cmds = []
+        origs = []
+        for tid, val in self._get_task_cpus().items():
+            self._tids.add(tid)
+            cpus = _parse_cpus(val)
+            if not cpus & self._others:
+                continue
+            new = cpus & self._allowed
+            if not new:
+                # The task is bound to the CPUs of the package.
+                continue
+
+            new = _format_cpus(new)
+            cmds.append(f"taskset -p -c {new} {tid} >/dev/null 2>&1 || echo {tid}")
+            origs.append((tid, val))
+            self._narrowed.setdefault(new, val)
+
+        failed = set(self._run_batched(cmds))
+        for tid, val in origs:
+            if tid not in failed:
+                self._undo.append(f"taskset -p -c {val} {tid} >/dev/null 2>&1")
+
+        _LOG.info("Moved %d tasks off CPUs %s", len(origs) - len(failed),
+                  _format_cpus(self._others))
+
+    def _migrate_workqueues(self):
+        """Move unbound workqueues off the other CPUs of the package."""
+
+        orig = self._read(_WQ_CPUMASK)
+        if orig:
+            self._write([(_WQ_CPUMASK, _format_cpumask(self._allowed), orig[_WQ_CPUMASK])],
+                        "unbound workqueue CPU masks")
+
+    def _enable_cstates(self):
+        """Enable all C-states on the other CPUs of the package."""
+
+        writes = []
+        for path, val in self._read(f"{_SYSFS_CPU}/cpu*/cpuidle/state*/disable").items():
+            # The path is like '/sys/devices/system/cpu/cpu5/cpuidle/state2/disable'.
+            cpu = path.split("/")[5][len("cpu"):]
+            if val != "0" and int(cpu) in self._others:
+                writes.append((path, "0", val))
+
+        if writes:
+            cnt = self._write(writes, "disabled C-states")
+            _LOG.info("Enabled %d disabled C-states on CPUs %s", cnt, _format_cpus(self._others))
+
+    def _offline_cpus(self):
+        """Offline the other CPUs of the package."""
+
+        writes = [(f"{_SYSFS_CPU}/cpu{cpu}/online", "0", "1") for cpu in sorted(self._others)]
+        cnt = self._write(writes, "CPUs")
+        _LOG.info("Offlined %d CPUs: %s", cnt, _format_cpus(self._others))
+
+    def quiesce(self):
+        """Quiesce the other CPUs of the measured CPU package."""
+
+        self._get_cpus()
+        if not self._others:
+            _LOG.notice("CPU %d is the only online CPU in its package%s, nothing to quiesce",
+                        self._cpunum, self._pman.hostmsg)
+            return
+
+        if not self._allowed:
+            raise Error(f"cannot quiesce the package of CPU {self._cpunum}{self._pman.hostmsg}: "
+                        f"there are no online CPUs in other packages to move the work to")
+
+        self._migrate_irqs()
+        self._migrate_tasks()
+        self._migrate_workqueues()
+        self._enable_cstates()
+        if self._method == "offline":
+            self._offline_cpus()
+
+    def restore(self):
+        """Restore the settings changed by 'quiesce()'."""
+
+        if not self._undo:
+            return
+
+        _LOG.info("Restoring settings of CPUs %s%s", _format_cpus(self._others),
+                  self._pman.hostmsg)
+
+        # Restore in the reverse order, e.g. online the CPUs before restoring the IRQ affinities.
+        undo = self._undo[::-1]
+        self._undo = []
+        if self._narrowed:
+            undo += self._get_forked_tasks_undo()
+        self._run_batched([f"{cmd} || true" for cmd in undo])
+
+    def __init__(self, pman, cpunum, method="migrate"):
+        """
+        The class constructor. The arguments are as follows.
+          * pman - the process manager object that defines the SUT.
+          * cpunum - the measured CPU number.
+          * method - the quiescing method, one of 'METHODS'.
+        """
+
+        if method not in METHODS:
+            methods = ", ".join(METHODS)
+            raise Error(f"bad package quiescing method '{method}', use one of: {methods}")
+
+        self._pman = pman
+        self._cpunum = cpunum
+        self._method = method
+
+        # The other CPUs of the measured CPU package, and the CPUs the work is moved to.
+        self._others = set()
+        self._allowed = set()
+        # IDs of the tasks which existed at 'quiesce()' time, and the '{new: orig}' dictionary of
+        # the narrowed task CPU lists and the original CPU lists they were narrowed from.
+        self._tids = set()
+        self._narrowed = {}
+        # Shell commands restoring the changed settings.
+        self._undo = []
+
+    def close(self):
+        """Restore the settings and uninitialize the class object."""
+
+        if getattr(self, "_undo", None):
+            try:
+                self.restore()
+            except Error as err:
+                _LOG.warning("failed to restore settings of CPUs %s%s:\n%s",
+                             _format_cpus(self._others), self._pman.hostmsg, err)
+
+        ClassHelpers.close(self, unref_attrs=("_pman",))
@@ -14,7 +14,7 @@ import logging
 from pepclibs.helperlibs.Exceptions import Error, ErrorTimeOut
 from pepclibs.helperlibs import ClassHelpers, KernelModule
 from statscollectlibs.helperlibs import ProcHelpers
-from wultlibs import Devices
+from wultlibs import Devices, _StreamShim
 from wultlibs.helperlibs import FSHelpers
 
 _LOG = logging.getLogger()
@@ -185,6 +185,9 @@ class HelperRawDataProviderBase(RawDataProviderBase):
                 raise ErrorTimeOut(f"{self._error_pfx()} did not provide any output for "
                                    f"{self._timeout} seconds")
 
+            if self._decoder:
+                stdout = self._decoder.decode(stdout)
+
             for line in stdout:
                 yield line
 
@@ -192,6 +195,8 @@ class HelperRawDataProviderBase(RawDataProviderBase):
         """Start the helper program."""
 
         cmd = f"{self._helper_path} {self._helper_opts}"
+        if self._toolname:
+            cmd, self._decoder = _StreamShim.wrap_cmd(self._pman, cmd, self._toolname)
         self._proc = self._pman.run_async(cmd)
 
     def _exit_helper(self):
@@ -231,10 +236,13 @@ class HelperRawDataProviderBase(RawDataProviderBase):
         ProcHelpers.kill_processes(regex, log=True, name=f"stale '{self._helpername}' process",
                                    pman=self._pman)
 
-    def __init__(self, dev, pman, helper_path=None, timeout=None, **kwargs):
+    def __init__(self, dev, pman, helper_path=None, timeout=None, toolname=None, **kwargs):
         """
         Initialize a class instance. The arguments are as follows.
           * helper_path - path to the helper program which provides the datapoints.
+          * toolname - name of the tool the helper program belongs to. If specified, the output of
+                       the helper program on a remote host is transferred in compressed batches via
+                       the 'stream-shim' helper deployed by the tool (see '_StreamShim').
           * All other arguments are the same as in 'RawDataProviderBase.__init__()'.
 
         Note, the reason for 'kwargs' is the same as described in
@@ -246,9 +254,11 @@ class HelperRawDataProviderBase(RawDataProviderBase):
         super().__init__(dev, pman, timeout=timeout, **kwargs)
 
         self._helper_path = helper_path
+        self._toolname = toolname
 
         self._helper_opts = None # The helper program command line options.
         self._proc = None        # The helper process.
+        self._decoder = None     # The compressed helper output decoder.
 
         self._helpername = dev.helpername
 
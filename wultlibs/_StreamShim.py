@@ -0,0 +1,114 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Author: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides API for transferring text or binary streams from remote SUTs in compressed
+batches. The SUT side is the 'stream-shim' helper program, which runs the actual command, batches
+its output, and prints every batch as a single base64-encoded line of zlib-compressed data.
+"""
+
+import zlib
+import base64
+import binascii
+import logging
+from pepclibs.helperlibs.Exceptions import Error, ErrorNotFound
+from wultlibs import Deploy
+
+_LOG = logging.getLogger()
+
+SHIM_NAME = "stream-shim"
+
+def _get_shim_path(pman, toolname):
+    """
+    Return path to the 'stream-shim' helper deployed by tool 'toolname' on the host defined by
+    'pman', or 'None' if it is not worth using the helper or it is not installed.
+    """
+
+    if not pman.is_remote:
+        return None
+
+    try:
+        return Deploy.get_installed_helper_path(pman, toolname, SHIM_NAME)
+    except ErrorNotFound as err:
+        _LOG.debug("not using compressed transport%s:\n%s", pman.hostmsg, err)
+        return None
+
+def is_available(pman, toolname):
+    """
+    Return 'True' if commands run on the host defined by 'pman' can be wrapped into the
+    'stream-shim' helper deployed by tool 'toolname', and 'False' otherwise.
+    """
+
+    return _get_shim_path(pman, toolname) is not None
+
+def wrap_cmd(pman, cmd, toolname, binary=False):
+    """
+    Wrap command 'cmd' into the 'stream-shim' helper command if it is worth it and possible. Returns
+    a '(cmd, decoder)' tuple, where 'cmd' is the command to run, and 'decoder' is a 'Decoder' object
+    for decoding the command output, or 'None' if the command was not wrapped. The arguments are as
+    follows.
+      * pman - the process manager object that defines the host to run 'cmd' on.
+      * cmd - the command to wrap.
+      * toolname - name of the tool the 'stream-shim' helper was deployed by.
+      * binary - 'cmd' prints binary data rather than text lines.
+
+    The command is wrapped only when 'pman' defines a remote host and the 'stream-shim' helper is
+    installed on it. Otherwise the original command is returned.
+    """
+
+    shim_path = _get_shim_path(pman, toolname)
+    if not shim_path:
+        return cmd, None
+
+    if binary:
+        return f"{shim_path} --binary -- {cmd}", Decoder(binary=True)
+    return f"{shim_path} -- {cmd}", Decoder()
+
+class Decoder:
+    """
+    This class decodes the output of the 'stream-shim' helper program. The compression context spans
+    the entire stream, so a separate object has to be used for every stream.
+    """
+
+    def decode(self, lines):
+        """
+        Decode a list of 'stream-shim' output lines 'lines' and return the list of the original
+        lines. In the binary mode, return the original data as 'bytes'.
+        """
+
+        result = []
+        for line in lines:
+            line = line.strip()
+            if not line:
+                continue
+
+            try:
+                data = self._decompobj.decompress(base64.b64decode(line))
+            except (binascii.Error, zlib.error) as err:
+                raise Error(f"failed to decode '{SHIM_NAME}' output line:\n{err}\nThe line is: "
+                            f"{line[:128]}") from None
+
+            if self._binary:
+                result.append(data)
+                continue
+
+            text = data.decode("utf-8", errors="replace")
+            result += text.splitlines(keepends=True)
+
+        if self._binary:
+            return b"".join(result)
+        return result
+
+    def __init__(self, binary=False):
+        """
+        The class constructor. The 'binary' argument should be 'True' if the 'stream-shim' helper
+        was run in the binary mode.
+        """
+
+        self._binary = binary
+        self._decompobj = zlib.decompressobj()
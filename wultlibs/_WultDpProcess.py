@@ -10,15 +10,19 @@
 This module provides the 'DatapointProcessor' class which implements raw datapoint processing.
 """
 
+import re
 import logging
 from pepclibs import CStates
-from pepclibs.helperlibs import ClassHelpers
+from pepclibs.helperlibs import ClassHelpers, Trivial
 from pepclibs.helperlibs.Exceptions import Error
 from wultlibs import WultDefs
 from wultlibs.helperlibs import Human
 
 _LOG = logging.getLogger()
 
+# The raw idle history fields, which the driver includes only if requested.
+_IDLE_HIST_RAW_RE = re.compile(r"^IdleHist(\d+|WultMask)$")
+
 class _CStates(ClassHelpers.SimpleCloseContext):
     """
     This is an internal class used only by the 'DatapointProcessor'. This class encapsulates all the
@@ -41,15 +45,18 @@ class _CStates(ClassHelpers.SimpleCloseContext):
         for csname, cstate in self._rcsinfo.items():
             self._idx2name[cstate["index"]] = csname
 
-    def _get_req_cstate_name(self, rawdp):
-        """Returns requestable C-state name for raw datapoint 'rawdp'."""
+    def _get_cstate_name(self, rawdp, field):
+        """
+        Returns requestable C-state name for the C-state index in the 'field' field of raw
+        datapoint 'rawdp'.
+        """
 
         try:
-            return self._idx2name[rawdp["ReqCState"]]
+            return self._idx2name[rawdp[field]]
         except KeyError:
             # Supposedly an bad C-state index.
             idx2name_str = ", ".join(f"{idx} ({name})" for idx, name in self._idx2name.items())
-            raise Error(f"bad C-state index '{rawdp['ReqCState']}' in the following datapoint:\n"
+            raise Error(f"bad C-state index '{rawdp[field]}' in the following datapoint:\n"
                         f"{Human.dict2str(rawdp)}\nAllowed indexes are:\n{idx2name_str}") from None
 
     @staticmethod
@@ -109,7 +116,9 @@ class _CStates(ClassHelpers.SimpleCloseContext):
         are yielded by 'get_raw_datapoint()'.
         """
 
-        csname = rawdp["ReqCState"] = self._get_req_cstate_name(rawdp)
+        csname = rawdp["ReqCState"] = self._get_cstate_name(rawdp, "ReqCState")
+        if "EntCState" in rawdp:
+            rawdp["EntCState"] = self._get_cstate_name(rawdp, "EntCState")
 
         if self._early_intr:
             # When the "early interrupts" feature is used, wult enables interrupts before the
@@ -354,6 +363,23 @@ class DatapointProcessor(ClassHelpers.SimpleCloseContext):
         """Returns 'True' if the 'dp' datapoint contains the POLL idle state data."""
         return dp["ReqCState"] == "POLL"
 
+    def _get_core_cstate(self, dp):
+        """
+        Returns name of the core C-state the CPU actually entered during the idle period of
+        datapoint 'dp'. This is the deepest core C-state with non-zero residency. It may be
+        different to the requested C-state, because the hardware may demote or promote C-states.
+        """
+
+        for cyc_field in self._cc_cyc_fields:
+            if dp[cyc_field] > 0:
+                return WultDefs.get_csname(cyc_field)
+
+        # No residency in any of the core C-states which have a counter. Not every platform has a
+        # CC1 counter, so assume CC1, unless this is the POLL state.
+        if self._is_poll_idle(dp):
+            return "CC0"
+        return "CC1"
+
     def _process_cstates(self, dp):
         """
         Validate various datapoint 'dp' fields related to C-states. Populate the processed
@@ -394,6 +420,9 @@ class DatapointProcessor(ClassHelpers.SimpleCloseContext):
                                    "datapoint is:\n%s", csname, dp[field], Human.dict2str(dp))
                 dp[field] = 100.0
 
+        if self._cc_cyc_fields:
+            dp["CoreCState"] = self._get_core_cstate(dp)
+
         if self._has_cstates and not self._is_poll_idle(dp):
             # Populate 'CC1Derived%' - the software-calculated CC1 residency, which is useful to
             # have because not every Intel platform has a hardware CC1 counter. Calculated as total
@@ -567,6 +596,35 @@ class DatapointProcessor(ClassHelpers.SimpleCloseContext):
 
             dp["WakeLatency"] -= overhead
 
+        if "TSoftIntr" in dp:
+            # The 'wult_hrt_soft' driver completes the delayed event in softirq context. The softirq
+            # runs after wult's interrupt handler, and after 'after_idle()' if interrupts were
+            # disabled, so both add overhead to the softirq latency.
+            overhead = dp["IntrTS2"] - dp["IntrTS1"]
+            if dp["IntrOff"]:
+                overhead += dp["AITS2"] - dp["AITS1"]
+
+            dp["SoftIntrLatency"] = dp["TSoftIntr"] - dp["LTime"] - overhead
+
+            if dp["SoftIntrLatency"] < dp["IntrLatency"]:
+                _LOG.debug("'SoftIntrLatency' is smaller than 'IntrLatency', even though the "
+                           "softirq runs after the interrupt handler. The datapoint is:\n%s\n"
+                           "The overhead is: %f\nDropping this datapoint\n",
+                           Human.dict2str(dp), overhead)
+                return None
+
+        if "TThread" in dp:
+            # The 'timerfd' device wakes up a user thread, and 'TThread' is the time the thread
+            # started running after the timer expired. The thread runs after the CPU exits the
+            # C-state, so it cannot be earlier than 'TAI'.
+            if dp["TThread"] <= dp["TAI"]:
+                _LOG.debug("'TThread' is not greater than 'TAI', even though the thread runs after "
+                           "the idle exit. The datapoint is:\n%s\nDropping this datapoint\n",
+                           Human.dict2str(dp))
+                return None
+
+            dp["ThreadLatency"] = dp["TThread"] - dp["LTime"]
+
         if self._drvname == "wult_tdt":
             # The 'wult_tdt' driver cannot really be used for measuring Interrupt latency, because
             # it measures 'WakeLatency' for the next TSC deadline timer, which is not necessarily
@@ -668,6 +726,7 @@ class DatapointProcessor(ClassHelpers.SimpleCloseContext):
         defs = WultDefs.WultDefs(raw_fields)
 
         self._cs_fields = []
+        self._cc_cyc_fields = []
         self._has_cstates = False
 
         for field in raw_fields:
@@ -678,20 +737,36 @@ class DatapointProcessor(ClassHelpers.SimpleCloseContext):
             self._has_cstates = True
             self._cs_fields.append(WultDefs.get_csres_metric(csname))
 
+            if csname.startswith("CC") and Trivial.is_int(csname[2:]) and int(csname[2:]) > 0:
+                self._cc_cyc_fields.append(field)
+
+        # Core C-state cycle fields from the deepest to the shallowest C-state.
+        self._cc_cyc_fields.sort(key=lambda field: int(WultDefs.get_csname(field)[2:]),
+                                 reverse=True)
+
         self._us_fields_set = {field for field, vals in defs.info.items() \
                                if vals.get("unit") == "microsecond"}
 
         # Form the preliminary list of fields in processed datapoints. Fields from the "defs" file
-        # go first. The list (but we use dictionary in this case) will be amended later.
+        # go first. The list (but we use dictionary in this case) will be amended later. Derived
+        # metrics are calculated when the datapoints are loaded, so they are not included.
         self._fields = {}
-        for field in defs.info:
-            self._fields[field] = None
+        for field, vals in defs.info.items():
+            if "expr" not in vals:
+                self._fields[field] = None
 
         if keep_rawdp:
             for field in raw_fields:
                 self._fields[field] = None
+        else:
+            # The raw idle history and the user perf event fields are present only if they were
+            # requested, keep them.
+            for field in raw_fields:
+                if _IDLE_HIST_RAW_RE.match(field) or field in self._perf_fields:
+                    self._fields[field] = None
 
-    def __init__(self, cpunum, pman, drvname, early_intr=None, tsc_cal_time=10, rcsobj=None):
+    def __init__(self, cpunum, pman, drvname, early_intr=None, tsc_cal_time=10, rcsobj=None,
+                 perf_events=None):
         """
         The class constructor. The arguments are as follows.
           * cpunum - the measured CPU number.
@@ -700,6 +775,8 @@ class DatapointProcessor(ClassHelpers.SimpleCloseContext):
           * early_intr - enable interrupts before entering the C-state.
           * tsc_cal_time - amount of seconds to use for calculating TSC rate.
           * rcsobj - the 'Cstates.ReqCStates()' object initialized for the measured system.
+          * perf_events - list of 'NAME=SPEC' user perf event specifications, the 'NAME' fields of
+                          raw datapoints are kept in processed datapoints.
         """
 
         self._cpunum = cpunum
@@ -718,7 +795,12 @@ class DatapointProcessor(ClassHelpers.SimpleCloseContext):
         self._dps = []
         self._has_cstates = None
         self._cs_fields = None
+        self._cc_cyc_fields = None
         self._us_fields_set = None
+        # Names of the user perf event fields.
+        self._perf_fields = set()
+        if perf_events:
+            self._perf_fields = {event.split("=", 1)[0] for event in perf_events}
 
         self._csobj = _CStates(self._cpunum, self._pman, rcsobj=rcsobj, early_intr=early_intr)
         self._tscrate = _TSCRate(self._drvname, tsc_cal_time)
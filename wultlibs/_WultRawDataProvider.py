@@ -10,13 +10,54 @@
 This module provides API for reading raw wult datapoints, as well as initializing wult devices.
 """
 
+import shlex
 import logging
 from pepclibs.helperlibs import Trivial, ClassHelpers, Systemctl, Human
-from pepclibs.helperlibs.Exceptions import Error, ErrorTimeOut
-from wultlibs import _FTrace, _RawDataProvider
+from pepclibs.helperlibs.Exceptions import Error, ErrorTimeOut, ErrorNotSupported
+from wultlibs import _FTrace, _RawDataProvider, WultDefs
 
 _LOG = logging.getLogger()
 
+# The wult driver synthetic trace event.
+_WULT_TRACE_EVENT = "synthetic/wult_cpu_idle"
+# Name of the dedicated ftrace instance for the wult driver events. Keep in sync with the driver.
+_WULT_TRACE_INSTANCE = "wult"
+
+# The raw datapoint fields 'wultrunner' always prints. Keep in sync with 'output_vars' in
+# 'wultrunner.c'.
+_BPF_RAW_FIELDS = ("LTime", "LDist", "ReqCState", "EntCState", "TBI", "TAI", "TIntr", "AITS1",
+                   "AITS2", "IntrTS1", "IntrTS2", "TotCyc", "SMICnt", "CC0Cyc")
+
+# Maximum length of a perf event name, see 'PERF_EVENT_NAME_LEN' in 'wultrunner.c'.
+_PERF_EVENT_NAME_MAXLEN = 63
+
+def parse_perf_events(perf_events):
+    """
+    Validate the list of 'NAME=SPEC' perf event specifications ('--perf-event' option) and return
+    it. The 'SPEC' part is validated by 'wultrunner'. 'NAME' becomes a CSV column, so it must not
+    collide with the raw datapoint fields, the metrics, or the other perf events.
+    """
+
+    defs = WultDefs.WultDefs([])
+    names = set()
+
+    for event in perf_events:
+        name, _, spec = event.partition("=")
+        if not name or not spec or "," in name or len(name) > _PERF_EVENT_NAME_MAXLEN:
+            raise Error(f"bad perf event '{event}', expected 'NAME=SPEC', where 'NAME' is up to "
+                        f"{_PERF_EVENT_NAME_MAXLEN} characters long and has no commas")
+
+        if name in _BPF_RAW_FIELDS or name in defs.info or name.startswith("IdleHist") or \
+           name == "TThread" or WultDefs.get_csname(name, must_get=False):
+            raise Error(f"bad perf event '{event}': name '{name}' is already used by a "
+                        "wult datapoint field or metric")
+
+        if name in names:
+            raise Error(f"bad perf event '{event}': name '{name}' is used more than once")
+        names.add(name)
+
+    return perf_events
+
 class _WultDrvRawDataProvider(_RawDataProvider.DrvRawDataProviderBase):
     """
     The raw data provider class implementation for devices which are controlled by a wult kernel
@@ -33,13 +74,37 @@ class _WultDrvRawDataProvider(_RawDataProvider.DrvRawDataProviderBase):
            not all(f1 == f2 for f1, f2 in zip(fields, self._fields)):
             old_fields = ", ".join(self._fields)
             new_fields = ", ".join(fields)
-            raise Error(f"the very first raw datapoint has different fields comparing to a new "
-                        f"datapoint\n"
-                        f"First datapoint fields count: {len(fields)}\n"
-                        f"New datapoint fields count: {len(self._fields)}\n"
-                        f"Fist datapoint fields:\n{old_fields}\n"
-                        f"New datapoint fields:\n{new_fields}\n\n"
-                        f"New datapoint full ftrace line:\n{self._ftrace.raw_line}")
+            msg = f"the very first raw datapoint has different fields comparing to a new " \
+                  f"datapoint\n" \
+                  f"First datapoint fields count: {len(fields)}\n" \
+                  f"New datapoint fields count: {len(self._fields)}\n" \
+                  f"Fist datapoint fields:\n{old_fields}\n" \
+                  f"New datapoint fields:\n{new_fields}"
+            if self._ftrace.raw_line:
+                msg += f"\n\nNew datapoint full ftrace line:\n{self._ftrace.raw_line}"
+            raise Error(msg)
+
+    def _get_raw_datapoints(self):
+        """
+        Same as 'get_datapoints()', but reads the trace buffer in the binary format using the
+        'FTraceRaw' reader.
+        """
+
+        yielded_dps = 0
+
+        try:
+            for dp in self._ftrace.getrecords():
+                fields = tuple(dp)
+                if self._fields:
+                    self._validate_datapoint(fields, tuple(dp.values()))
+                else:
+                    self._fields = fields
+
+                yielded_dps += 1
+                yield dp
+        except ErrorTimeOut as err:
+            raise ErrorTimeOut(f"{err}\nCount of wult ftrace records read so far: {yielded_dps}") \
+                  from err
 
     def get_datapoints(self):
         """
@@ -47,6 +112,10 @@ class _WultDrvRawDataProvider(_RawDataProvider.DrvRawDataProviderBase):
         dictionary keys are the ftrace field names, the values are the integer values of the fields.
         """
 
+        if isinstance(self._ftrace, _FTrace.FTraceRaw):
+            yield from self._get_raw_datapoints()
+            return
+
         last_line = None
         yielded_lines = 0
 
@@ -81,6 +150,14 @@ class _WultDrvRawDataProvider(_RawDataProvider.DrvRawDataProviderBase):
                 msg = f"{msg}\nLast seen wult ftrace line:\n{last_line}"
             raise ErrorTimeOut(msg) from err
 
+    def get_overruns(self):
+        """
+        Returns the count of raw datapoints lost because of the measured CPU trace buffer
+        overflowing.
+        """
+
+        return self._ftrace.get_overruns(self._cpunum)
+
     def start(self):
         """Start the measurements."""
 
@@ -162,13 +239,19 @@ class _WultDrvRawDataProvider(_RawDataProvider.DrvRawDataProviderBase):
                 self._sysctl.stop("irqbalance")
                 self._irqbalance_stopped = True
 
-    def __init__(self, dev, pman, cpunum, timeout=None, ldist=None, early_intr=None):
+    def __init__(self, dev, pman, cpunum, timeout=None, ldist=None, early_intr=None,
+                 trbufsize=None, idle_hist_raw=False):
         """Initialize a class instance. The arguments are the same as in 'WultRawDataProvider'."""
 
-        drvinfo = { "wult" : { "params" : f"cpunum={cpunum}" },
+        params = f"cpunum={cpunum}"
+        if idle_hist_raw:
+            params += " idle_hist_raw=1"
+
+        drvinfo = { "wult" : { "params" : params },
                      dev.drvname : { "params" : None }}
         super().__init__(dev, pman, drvinfo=drvinfo, timeout=timeout)
 
+        self._cpunum = cpunum
         self._ldist = ldist
         self._early_intr = early_intr
 
@@ -180,7 +263,19 @@ class _WultDrvRawDataProvider(_RawDataProvider.DrvRawDataProviderBase):
         self._enabled_path = None
         self._fields = None
 
-        self._ftrace = _FTrace.FTrace(pman=self._pman, timeout=self._timeout)
+        # Prefer reading the trace buffer in the binary format, which is a lot cheaper than
+        # formatting and parsing text. Fall back to the text format if it is not supported.
+        # Use a dedicated ftrace instance in order to avoid interfering with other tracing users.
+        # It has to exist before the driver is loaded, because the driver looks it up.
+        try:
+            self._ftrace = _FTrace.FTraceRaw(self._pman, cpunum, _WULT_TRACE_EVENT,
+                                             timeout=self._timeout, instance=_WULT_TRACE_INSTANCE,
+                                             bufsize=trbufsize, toolname="wult")
+        except ErrorNotSupported as err:
+            _LOG.debug("%s, using the text trace buffer reader", err)
+            self._ftrace = _FTrace.FTrace(pman=self._pman, timeout=self._timeout,
+                                          instance=_WULT_TRACE_INSTANCE, cpunum=cpunum,
+                                          bufsize=trbufsize, toolname="wult")
 
         self._basedir = self.debugfs_mntpoint / "wult"
         self._enabled_path = self._basedir / "enabled"
@@ -200,8 +295,11 @@ class _WultDrvRawDataProvider(_RawDataProvider.DrvRawDataProviderBase):
                 _LOG.warning("failed to start the previously stopped 'irqbalance' service:\n%s",
                              err)
 
-        ClassHelpers.close(self, close_attrs=("_sysctl", "_ftrace"))
+        ClassHelpers.close(self, close_attrs=("_sysctl",))
         super().close()
+        # Close the trace buffer after the drivers have been unloaded, because the wult driver
+        # holds a reference to the wult ftrace instance, which cannot be removed until then.
+        ClassHelpers.close(self, close_attrs=("_ftrace",))
 
 
 class _WultBPFRawDataProvider(_RawDataProvider.HelperRawDataProviderBase):
@@ -268,19 +366,29 @@ class _WultBPFRawDataProvider(_RawDataProvider.HelperRawDataProviderBase):
 
         ldist_str = ",".join([str(val) for val in self._ldist])
         self._helper_opts = f"-c {self._cpunum} -l {ldist_str}"
-
-    def __init__(self, dev, pman, cpunum, wultrunner_path, timeout=None, ldist=None):
+        if self._idle_hist_raw:
+            self._helper_opts += " --idle-hist-raw"
+        for event in self._perf_events:
+            self._helper_opts += f" --perf-event {shlex.quote(event)}"
+        if self.dev.helper_opts:
+            self._helper_opts += f" {self.dev.helper_opts}"
+
+    def __init__(self, dev, pman, cpunum, wultrunner_path, timeout=None, ldist=None,
+                 idle_hist_raw=False, perf_events=None):
         """Initialize a class instance. The arguments are the same as in 'WultRawDataProvider'."""
 
-        super().__init__(dev, pman, helper_path=wultrunner_path, timeout=timeout)
+        super().__init__(dev, pman, helper_path=wultrunner_path, timeout=timeout,
+                         toolname="wult")
 
         self._cpunum = cpunum
         self._ldist = ldist
+        self._idle_hist_raw = idle_hist_raw
+        self._perf_events = perf_events if perf_events else []
 
         self._wult_lines = None
 
 def WultRawDataProvider(dev, pman, cpunum, wultrunner_path=None, timeout=None, ldist=None,
-                        early_intr=None):
+                        early_intr=None, trbufsize=None, idle_hist_raw=False, perf_events=None):
     """
     Create and return a raw data provider class suitable for a delayed event device 'dev'. The
     arguments are as follows.
@@ -293,12 +401,21 @@ def WultRawDataProvider(dev, pman, cpunum, wultrunner_path=None, timeout=None, l
       * ldist - a pair of numbers specifying the launch distance range in nanosecods. The default
                 value is specific to the delayed event device.
       * early_intr - enable interrupts before entering the C-state.
+      * trbufsize - the measured CPU trace buffer size in KiB. Used only for devices which are
+                    controlled by a wult kernel driver.
+      * idle_hist_raw - include the raw idle history of the measured CPU into the raw datapoints,
+                        in addition to its summary.
+      * perf_events - list of 'NAME=SPEC' perf event specifications to read on idle entry and exit
+                      (see 'wultrunner --help'). Used only for devices which are controlled by the
+                      'wultrunner' eBPF helper.
     """
 
     if dev.drvname:
         return _WultDrvRawDataProvider(dev, pman, cpunum, timeout=timeout, ldist=ldist,
-                                       early_intr=early_intr)
+                                       early_intr=early_intr, trbufsize=trbufsize,
+                                       idle_hist_raw=idle_hist_raw)
     if not wultrunner_path:
         raise Error("BUG: the 'wultrunner' program path was not specified")
 
-    return _WultBPFRawDataProvider(dev, pman, cpunum, wultrunner_path, timeout=timeout, ldist=ldist)
+    return _WultBPFRawDataProvider(dev, pman, cpunum, wultrunner_path, timeout=timeout, ldist=ldist,
+                                   idle_hist_raw=idle_hist_raw, perf_events=perf_events)
@@ -35,4 +35,8 @@ class WultReport(_ReportBase.ReportBase):
                          yaxes=args["yaxes"], hist=args["hist"], chist=args["chist"],
                          exclude_xaxes=Trivial.split_csv_line(WultReportParams.EXCLUDE_XAXES),
                          exclude_yaxes=Trivial.split_csv_line(WultReportParams.EXCLUDE_YAXES),
-                         smry_funcs=WultReportParams.SMRY_FUNCS)
+                         smry_funcs=WultReportParams.SMRY_FUNCS,
+                         rolling=Trivial.split_csv_line(WultReportParams.ROLLING),
+                         binned=Trivial.split_csv_line(WultReportParams.BINNED),
+                         binned_shares=Trivial.split_csv_line(WultReportParams.BINNED_SHARES),
+                         governor=True)
@@ -39,6 +39,16 @@ DEFAULT_CHIST = SMALL_CHIST
 EXCLUDE_XAXES = "LDist"
 EXCLUDE_YAXES = "SilentTime"
 
+# Regular expressions for metrics to show the percentiles over a sliding window of datapoints for.
+ROLLING = "WakeLatency"
+
+# Tabs of Y-axis metrics include diagrams of the metric percentiles versus bins of the 'BINNED'
+# metrics, followed by diagrams of per-bin shares of every value of the 'BINNED_SHARES' metrics.
+# Binning by the effective frequency reports latency per frequency band. Metrics absent in any of
+# the results (e.g., 'EffFreq' in the eBPF helper results) are skipped.
+BINNED = "LDist,EffFreq,FreqSet"
+BINNED_SHARES = "ReqCState"
+
 # Defines which summary functions should be calculated and included in the report for each metric.
 # Metrics are represented by their name or a regular expression and paired with a list of summary
 # functions.
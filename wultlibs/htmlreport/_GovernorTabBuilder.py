@@ -0,0 +1,228 @@
+# -*- coding: utf-8 -*-
+# vim: ts=4 sw=4 tw=100 et ai si
+#
+# Copyright (C) 2019-2022 Intel Corporation
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Authors: Artem Bityutskiy <artem.bityutskiy@linux.intel.com>
+
+"""
+This module provides the capability of populating the idle governor analysis data tab.
+
+Every datapoint includes the C-state requested by the idle governor ('ReqCState') and the time the
+CPU actually spent idle before the delayed event ('SilentTime'). Given the C-states 'latency' and
+'target_residency' values from the cpuidle sysfs snapshot of the SysInfo statistics, the ideal
+C-state for a datapoint is the deepest enabled C-state with target residency not exceeding
+'SilentTime'. The governor request is "too deep" if the requested C-state is deeper than the ideal
+one, "too shallow" if it is shallower, and "correct" otherwise.
+"""
+
+import re
+import logging
+import numpy
+from pepclibs.helperlibs.Exceptions import Error
+from statscollectlibs.htmlreport import _SummaryTable
+from statscollectlibs.htmlreport.tabs import _Tabs
+
+_LOG = logging.getLogger()
+
+# The cpuidle sysfs snapshots, relative to the statistics directory. The "before" snapshot is
+# preferred, because it reflects the settings the measurements started with.
+_CPUIDLE_FILES = ("sysinfo/sys-cpuidle.before.raw.txt", "sysinfo/sys-cpuidle.after.raw.txt")
+
+_CPUIDLE_PATH_RE = re.compile(r"/sys/devices/system/cpu/cpu(\d+)/cpuidle/state\d+/"
+                              r"(name|latency|target_residency|disable):$")
+
+# The table rows: '(name, unit, description, format)' tuples.
+_ROWS = (("Correct", "%", "Share of requests for the ideal C-state.", "{:.1f}"),
+         ("Too shallow", "%", "Share of requests for a C-state shallower than the ideal one. Such "
+                              "requests waste energy.", "{:.1f}"),
+         ("Too deep", "%", "Share of requests for a C-state deeper than the ideal one. Such "
+                           "requests add exit latency and may waste energy on C-state entry and "
+                           "exit.", "{:.1f}"),
+         ("Extra exit latency", "us", "Average difference between the exit latency of the "
+                                      "requested C-state and the ideal C-state for too deep "
+                                      "requests, according to cpuidle sysfs.", "{:.2f}"),
+         ("Residency shortfall", "us", "Average difference between the target residency of the "
+                                       "requested C-state and the time actually spent idle for "
+                                       "too deep requests.", "{:.2f}"),
+         ("Missed deeper residency", "%", "Share of idle time spent in a too shallow C-state, "
+                                          "while a deeper one was worth it. This is an estimate of "
+                                          "the energy cost of too shallow requests.", "{:.1f}"))
+
+def parse_cpuidle(path, cpunum):
+    """
+    Parse the cpuidle sysfs snapshot file at 'path' and return the C-states information for CPU
+    'cpunum'. Returns the '{csname: {"latency": latency, "residency": residency, "disable": bool}}'
+    dictionary, the latency and residency are in microseconds.
+    """
+
+    states = {}
+    key = None
+
+    try:
+        with open(path, "r", encoding="utf-8") as fobj:
+            for line in fobj:
+                line = line.strip()
+                match = _CPUIDLE_PATH_RE.match(line)
+                if match:
+                    key = None
+                    if int(match.group(1)) == cpunum:
+                        statedir = line.rpartition("/")[0]
+                        key = (statedir, match.group(2))
+                    continue
+
+                if key and line:
+                    states.setdefault(key[0], {})[key[1]] = line
+                    key = None
+    except OSError as err:
+        raise Error(f"failed to read cpuidle information from '{path}':\n{err}") from None
+
+    result = {}
+    for info in states.values():
+        try:
+            result[info["name"]] = {"latency": int(info["latency"]),
+                                    "residency": int(info["target_residency"]),
+                                    "disable": info.get("disable", "0") != "0"}
+        except (KeyError, ValueError):
+            continue
+
+    return result
+
+def classify(df, cstates):
+    """
+    Classify the idle governor requests in 'pandas.DataFrame' 'df' using the C-states information
+    'cstates' (see 'parse_cpuidle()'). Returns the '{row: {csname: value}}' dictionary, where 'row'
+    is a '_ROWS' row name, and 'csname' is a requested C-state name or "All".
+    """
+
+    # Enabled C-states sorted from the shallowest to the deepest.
+    enabled = sorted((info["residency"], info["latency"], csname)
+                     for csname, info in cstates.items() if not info["disable"])
+    if not enabled:
+        raise Error("no enabled C-states")
+
+    residencies = numpy.array([residency for residency, _, _ in enabled], dtype=float)
+    latencies = numpy.array([latency for _, latency, _ in enabled], dtype=float)
+    depth = {csname: idx for idx, (_, _, csname) in enumerate(enabled)}
+
+    reqcs = df["ReqCState"].to_numpy()
+    known = numpy.isin(reqcs, list(depth))
+    reqcs = reqcs[known]
+    silent = df["SilentTime"].to_numpy(dtype=float)[known]
+    if not len(reqcs):
+        raise Error("none of the requested C-states is in the cpuidle information")
+
+    req = numpy.array([depth[csname] for csname in reqcs])
+    ideal = numpy.maximum(numpy.searchsorted(residencies, silent, side="right") - 1, 0)
+
+    shallow = req < ideal
+    deep = req > ideal
+
+    result = {row[0]: {} for row in _ROWS}
+    csnames = [csname for _, _, csname in enabled if csname in set(reqcs)]
+    for csname in csnames + ["All"]:
+        mask = numpy.ones(len(req), dtype=bool) if csname == "All" else reqcs == csname
+        cnt = mask.sum()
+        dmask = mask & deep
+        smask = mask & shallow
+
+        result["Correct"][csname] = (cnt - dmask.sum() - smask.sum()) / cnt * 100
+        result["Too shallow"][csname] = smask.sum() / cnt * 100
+        result["Too deep"][csname] = dmask.sum() / cnt * 100
+
+        if dmask.any():
+            extra = latencies[req[dmask]] - latencies[ideal[dmask]]
+            shortfall = residencies[req[dmask]] - silent[dmask]
+            result["Extra exit latency"][csname] = extra.mean()
+            result["Residency shortfall"][csname] = shortfall.mean()
+        else:
+            result["Extra exit latency"][csname] = 0.0
+            result["Residency shortfall"][csname] = 0.0
+
+        idle = silent[mask].sum()
+        missed = silent[smask].sum()
+        result["Missed deeper residency"][csname] = missed / idle * 100 if idle else 0.0
+
+    return result
+
+class GovernorTabBuilder:
+    """
+    This class provides the capability of populating the idle governor analysis data tab.
+
+    Public methods overview:
+    1. Generate a '_Tabs.DTabDC' instance with the idle governor analysis table.
+        * 'get_tab()'
+    """
+
+    name = "Governor"
+
+    def _get_cstates(self, res):
+        """Returns the C-states information for the measured CPU of test result 'res'."""
+
+        stats_path = self._stats_paths.get(res.reportid)
+        if not stats_path:
+            raise Error(f"no statistics for '{res.reportid}'")
+
+        for fname in _CPUIDLE_FILES:
+            path = stats_path / fname
+            if path.exists():
+                cstates = parse_cpuidle(path, int(res.info["cpunum"]))
+                if cstates:
+                    return cstates
+
+        raise Error(f"no cpuidle information for CPU {res.info['cpunum']} found in "
+                    f"'{stats_path}'")
+
+    def get_tab(self):
+        """
+        Returns a '_Tabs.DTabDC' instance with the idle governor analysis table. Raises 'Error' if
+        the table cannot be generated for any of the results.
+        """
+
+        results = {}
+        for res in self._rsts:
+            if "ReqCState" not in res.df or "SilentTime" not in res.df:
+                raise Error(f"no 'ReqCState' or 'SilentTime' data in '{res.reportid}'")
+            try:
+                results[res.reportid] = classify(res.df, self._get_cstates(res))
+            except Error as err:
+                raise Error(f"cannot analyze idle governor requests in '{res.reportid}':\n"
+                            f"{err}") from None
+
+        # The C-states requested in any of the results, the order is the first result order.
+        csnames = []
+        for result in results.values():
+            csnames += [csname for csname in result["Correct"]
+                        if csname not in csnames and csname != "All"]
+        csnames.append("All")
+
+        smrytbl = _SummaryTable.SummaryTable()
+        for row, unit, descr, fmt in _ROWS:
+            smrytbl.add_metric(row, unit, descr, fmt=fmt)
+            for reportid, result in results.items():
+                for csname in csnames:
+                    fdescr = "all requests" if csname == "All" else f"{csname} requests"
+                    val = float(result[row].get(csname, numpy.nan))
+                    smrytbl.add_smry_func(reportid, row, csname, val, descr=fdescr)
+
+        self._outdir.mkdir(parents=True, exist_ok=True)
+        smry_path = self._outdir / "governor-table.txt"
+        smrytbl.generate(smry_path)
+
+        return _Tabs.DTabDC(self.name, smrytblpath=smry_path.relative_to(self._basedir))
+
+    def __init__(self, rsts, outdir, stats_paths):
+        """
+        The class constructor. The arguments are as follows.
+         * rsts - a list of 'RORawResult' instances to analyze.
+         * outdir - the report output directory, the tab files are stored in its "Governor"
+                    sub-directory.
+         * stats_paths - a '{reportid: stats_path}' dictionary with the statistics directories
+                         containing the SysInfo cpuidle snapshots.
+        """
+
+        self._rsts = rsts
+        self._basedir = outdir
+        self._outdir = outdir / self.name
+        self._stats_paths = stats_paths
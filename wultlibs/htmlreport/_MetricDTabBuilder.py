@@ -15,7 +15,7 @@ reports.
 
 from pepclibs.helperlibs import Trivial
 from pepclibs.helperlibs.Exceptions import Error
-from statscollectlibs.htmlreport import _SummaryTable
+from statscollectlibs.htmlreport import _SummaryTable, _RollingPercentiles, _BinnedStats
 from statscollectlibs.htmlreport.tabs import _DTabBuilder
 
 class MetricDTabBuilder(_DTabBuilder.DTabBuilder):
@@ -28,6 +28,8 @@ class MetricDTabBuilder(_DTabBuilder.DTabBuilder):
        * 'add_smrytbl()'
     2. Add plots to the tab.
        * 'add_plots()'
+       * 'add_rolling_percentiles()'
+       * 'add_binned_stats()'
     3. Generate '_Tabs.DTabDC' instance.
        * 'get_tab()'
     """
@@ -96,6 +98,77 @@ class MetricDTabBuilder(_DTabBuilder.DTabBuilder):
 
         return super()._add_histogram(mdef, cumulative, xbins)
 
+    def add_rolling_percentiles(self, mdef, percentiles=None, window=None):
+        """
+        Add a diagram of metric percentiles over a sliding window of datapoints, which shows how the
+        metric changes over the duration of the test run. The arguments are as follows.
+         * mdef - definitions dictionary of the metric.
+         * percentiles - an iterable collection of percentiles to show, default is
+                         '_RollingPercentiles.DEFAULT_PERCENTILES'.
+         * window - size of the sliding window in datapoints, default is 2% of the datapoints.
+        """
+
+        if self._skip_metric_plot("rolling percentiles diagram", mdef):
+            return
+
+        if percentiles is None:
+            percentiles = _RollingPercentiles.DEFAULT_PERCENTILES
+
+        path = self._outdir / f"Percentiles-{mdef['fsname']}-vs-Datapoint.json"
+        plot = _RollingPercentiles.RollingPercentiles(mdef["name"], path,
+                                                      yaxis_label=mdef.get("title"),
+                                                      yaxis_unit=mdef.get("short_unit"))
+
+        # Datapoints are stored in the order they were measured, so the datapoint index is the
+        # measurement progress.
+        for res in self._rsts:
+            plot.add_data(res.df[mdef["name"]].to_numpy(), res.reportid, percentiles=percentiles,
+                          window=window)
+
+        plot.generate()
+        self._ppaths.append(path)
+
+    def add_binned_stats(self, xdef, ydef):
+        """
+        Add a diagram of per-bin statistics of metric 'ydef' versus bins of metric 'xdef'. The
+        statistics are percentiles for a numeric metric, and shares of every value otherwise (see
+        '_BinnedStats.BinnedStats'). The arguments are as follows.
+         * xdef - definitions dictionary of the metric to bin the datapoints by.
+         * ydef - definitions dictionary of the metric to calculate the statistics for.
+
+        Returns path to the generated diagram, or 'None' if it was not generated.
+        """
+
+        if self._skip_metric_plot("binned statistics diagram", xdef, ydef):
+            return None
+
+        if ydef.get("type") == "str":
+            yaxis_label = f"{ydef.get('title', ydef['name'])} share"
+            yaxis_unit = "%"
+        else:
+            yaxis_label = ydef.get("title")
+            yaxis_unit = ydef.get("short_unit")
+
+        path = self._outdir / f"{ydef['fsname']}-vs-{xdef['fsname']}-Binned.json"
+        plot = _BinnedStats.BinnedStats(xdef["name"], ydef["name"], path,
+                                        xaxis_label=xdef.get("title"), yaxis_label=yaxis_label,
+                                        xaxis_unit=xdef.get("short_unit"), yaxis_unit=yaxis_unit)
+
+        for res in self._rsts:
+            plot.add_df(res.df, res.reportid)
+
+        plot.generate()
+        self._ppaths.append(path)
+        return path
+
+    def add_plot_path(self, path):
+        """
+        Add a diagram which was already generated for another tab (e.g., by 'add_binned_stats()'),
+        so that it is not generated again. The 'path' argument is path to the diagram file.
+        """
+
+        self._ppaths.append(path)
+
     def __init__(self, rsts, outdir, metric_def, basedir=None):
         """
         The class constructor. Arguments as follows:
@@ -20,14 +20,16 @@ from pathlib import Path
 from pepclibs.helperlibs import Trivial, LocalProcessManager
 from pepclibs.helperlibs.Exceptions import Error, ErrorNotFound
 from statscollectlibs.helperlibs import ToolHelpers
-from statscollectlibs.htmlreport import _IntroTable
+from statscollectlibs.htmlreport import _HoverData, _IntroTable, _Plot
 from statscollectlibs.htmlreport.tabs import _ACPowerTabBuilder, _IPMITabBuilder, _Tabs
+from statscollectlibs.htmlreport.tabs import _InterruptsTabBuilder
 from statscollectlibs.htmlreport.tabs.sysinfo import (_CPUFreqTabBuilder, _CPUIdleTabBuilder,
     _DMIDecodeTabBuilder, _DmesgTabBuilder, _LspciTabBuilder, _MiscTabBuilder, _PepcTabBuilder)
 from statscollectlibs.htmlreport.tabs.sysinfo import _TurbostatTabBuilder as _SysInfoTstatTabBuilder
 from statscollectlibs.htmlreport.tabs.turbostat import _TurbostatTabBuilder
 from wultlibs.helperlibs import FSHelpers
-from wultlibs.htmlreport import _MetricDTabBuilder
+from wultlibs.rawresultlibs import RORawResult
+from wultlibs.htmlreport import _MetricDTabBuilder, _GovernorTabBuilder
 
 _LOG = logging.getLogger()
 
@@ -123,6 +125,23 @@ class ReportBase:
                 devid_text += f" ({res.info['devdescr']})"
             devid_row.add_cell(res.reportid, devid_text)
 
+        # Add the measurement floor calibration results.
+        if any("calibration" in res.info for res in self.rsts):
+            hovertext = "Wake latency measured with only the POLL state enabled, which is the " \
+                        "overhead of the delayed event device and the measurement tool."
+            floor_row = self._intro_tbl.create_row("Measurement Floor", hovertext=hovertext)
+            for res in self.rsts:
+                calib = res.info.get("calibration", {})
+                floor = calib.get("WakeLatency")
+                if floor:
+                    text = f"median {floor['med']:.2f}us, 99% {floor['99%']:.2f}us"
+                    hovertext = f"Calibrated on {calib.get('date')} using {calib.get('dpcnt')} " \
+                                f"datapoints, 'WakeLatency' range is {floor['min']:.2f}-" \
+                                f"{floor['max']:.2f}us"
+                    floor_row.add_cell(res.reportid, text, hovertext=hovertext)
+                else:
+                    floor_row.add_cell(res.reportid, None)
+
         # Add links to the stats directories.
         self._add_intro_tbl_links("Statistics", stats_paths)
         # Add links to the logs directories.
@@ -250,11 +269,18 @@ class ReportBase:
         tab_metrics += self.chist + self.hist
         tab_metrics = Trivial.list_dedup(tab_metrics)
 
-        # Convert 'self._hov_metrics' to contain definitions for each metric.
-        hover_defs = {}
-        reports = {res.reportid: res for res in self.rsts}
-        for reportid, metrics in self._hov_metrics.items():
-            hover_defs[reportid] = [reports[reportid].defs.info[m] for m in metrics]
+        # Scatter plots refer to the hover data files with the details of the datapoints for the
+        # metrics in 'self._hov_metrics', instead of including the details. The files are generated
+        # after the plots, for the datapoints which are left on the plots after density reduction.
+        hover_data = {}
+        for res in self.rsts:
+            hover_data[res.reportid] = Path("hover-data") / res.reportid
+        hover_indices = {}
+
+        # The share diagrams (e.g., "ReqCState" shares versus "LDist" bins) do not depend on the
+        # tab metric. Generate them once and refer to them from the other tabs. This is the
+        # '{(xmetric, share_metric): path}' dictionary.
+        share_paths = {}
 
         for metric in tab_metrics:
             _LOG.info("Generating %s tab.", metric)
@@ -290,10 +316,34 @@ class ReportBase:
             metric_def = self._refres.defs.info.get(metric + base_col_suffix, metric_def)
             hist_metrics = [metric_def] if metric in self.hist else []
             chist_metrics = [metric_def] if metric in self.chist else []
-            dtab_bldr.add_plots(tab_plots, hist_metrics, chist_metrics, hover_defs)
+            dtab_bldr.add_plots(tab_plots, hist_metrics, chist_metrics, hover_data)
+            for reportid, index in dtab_bldr.hover_indices.items():
+                if reportid in hover_indices:
+                    index = hover_indices[reportid].union(index)
+                hover_indices[reportid] = index
+            if metric in self._rolling_metrics:
+                dtab_bldr.add_rolling_percentiles(metric_def)
+            if metric in self.yaxes:
+                defs_info = self._refres.defs.info
+                for xmetric in self._binned_xaxes:
+                    if xmetric == metric:
+                        continue
+                    xdef = defs_info.get(xmetric + base_col_suffix, defs_info[xmetric])
+                    dtab_bldr.add_binned_stats(xdef, metric_def)
+                    for smetric in self._binned_shares:
+                        key = (xmetric, smetric)
+                        if key not in share_paths:
+                            share_paths[key] = dtab_bldr.add_binned_stats(xdef, defs_info[smetric])
+                        elif share_paths[key]:
+                            dtab_bldr.add_plot_path(share_paths[key])
 
             dtabs.append(dtab_bldr.get_tab())
 
+        for res in self.rsts:
+            hover_defs = [res.defs.info[m] for m in self._hov_metrics[res.reportid]]
+            df = res.df.loc[hover_indices.get(res.reportid, [])]
+            _HoverData.generate(df, hover_defs, self.outdir / hover_data[res.reportid])
+
         return dtabs
 
     def _generate_stats_tabs(self, stats_paths):
@@ -314,8 +364,10 @@ class ReportBase:
 
         tab_builders = {
             _ACPowerTabBuilder.ACPowerTabBuilder: {},
-            _TurbostatTabBuilder.TurbostatTabBuilder: {"measured_cpus": mcpus},
-            _IPMITabBuilder.IPMITabBuilder: {}
+            _TurbostatTabBuilder.TurbostatTabBuilder: {"measured_cpus": mcpus,
+                                                       "all_cpus": self.turbostat_heatmaps},
+            _IPMITabBuilder.IPMITabBuilder: {},
+            _InterruptsTabBuilder.InterruptsTabBuilder: {"measured_cpus": mcpus},
         }
 
         tabs = []
@@ -329,6 +381,9 @@ class ReportBase:
                 _LOG.debug(err)
                 continue
 
+            if self.ts_points is not None:
+                tbldr.ts_points = self.ts_points
+
             _LOG.info("Generating '%s' tab.", tbldr.name)
             try:
                 tabs.append(tbldr.get_tab())
@@ -395,6 +450,7 @@ class ReportBase:
         stats_paths, logs_paths = self._copy_raw_data()
         for src, descr in self._assets:
             self._copy_asset(Path(src), descr, self.outdir / src)
+        _Plot.write_plotlyjs(self.outdir / "js" / "dist" / "plotly.min.js")
 
         # 'report_info' stores data used by the Javascript to generate the main report page
         # including the intro table, the file path of the tabs JSON dump and the toolname.
@@ -404,6 +460,15 @@ class ReportBase:
 
         results_tabs = self._generate_results_tabs()
 
+        if self.governor:
+            try:
+                gov_bldr = _GovernorTabBuilder.GovernorTabBuilder(self.rsts, self.outdir,
+                                                                  stats_paths)
+                results_tabs.append(gov_bldr.get_tab())
+            except Error as err:
+                _LOG.info("Skipping '%s' tab: %s", _GovernorTabBuilder.GovernorTabBuilder.name,
+                          err)
+
         try:
             stats_tabs = self._generate_stats_tabs(stats_paths)
         except Error as err:
@@ -503,8 +568,11 @@ class ReportBase:
 
             minclude = Trivial.list_dedup(self._smry_metrics + metrics)
             res.set_minclude(minclude)
-            res.load_df()
 
+        # Read the datapoints CSV files in parallel.
+        RORawResult.load_dfs(self.rsts)
+
+        for res in self.rsts:
             # We'll be dropping columns and adding temporary columns, so we'll affect the original
             # 'pandas.DataFrame'. This is more efficient than creating copies.
             self._mangle_loaded_res(res)
@@ -538,6 +606,15 @@ class ReportBase:
         for res in self.rsts:
             self._hov_metrics[res.reportid] = res.find_metrics(regexs, must_find_any=False)
 
+    def _find_common_metrics(self, regexs):
+        """
+        Returns the list of metrics matching regular expressions in 'regexs' and present in all test
+        results.
+        """
+
+        metrics = self._refres.find_metrics(regexs, must_find_any=False)
+        return [metric for metric in metrics if all(metric in res.metrics_set for res in self.rsts)]
+
     def _drop_absent_metrics(self):
         """
         Verify that test results provide the metrics in 'xaxes', 'yaxes', 'hist' and 'chist'. Drop
@@ -603,6 +680,24 @@ class ReportBase:
         if not self.xaxes or not self.yaxes:
             self.xaxes = self.yaxes = []
 
+        # Rolling percentiles diagrams are added to the metric tabs, so only metrics which get a tab
+        # are relevant.
+        if self.rolling:
+            tab_metrics = set(self.yaxes + self.hist + self.chist)
+            rolling = self._refres.find_metrics(self.rolling, must_find_any=False)
+            self._rolling_metrics = [metric for metric in rolling if metric in tab_metrics]
+
+        # The binning metrics are optional (e.g., 'EffFreq' is provided only by the wult drivers,
+        # and 'FreqSet' only with the frequency sweep), so use only those present in all results.
+        if self.binned and self.yaxes:
+            self._binned_xaxes = self._find_common_metrics(self.binned)
+            if self._binned_xaxes and self.binned_shares:
+                self._binned_shares = self._find_common_metrics(self.binned_shares)
+            self._more_metrics += self._binned_xaxes + self._binned_shares
+
+        if self.governor:
+            self._more_metrics += ["ReqCState", "SilentTime"]
+
     def _init_assets(self):
         """
         'Assets' are the CSS and JS files which supplement the HTML which makes up the report.
@@ -696,7 +791,8 @@ class ReportBase:
                             self._smry_funcs[metric].append(func)
 
     def __init__(self, rsts, outdir, title_descr=None, xaxes=None, yaxes=None, hist=None,
-                 chist=None, exclude_xaxes=None, exclude_yaxes=None, smry_funcs=None):
+                 chist=None, exclude_xaxes=None, exclude_yaxes=None, smry_funcs=None,
+                 rolling=None, binned=None, binned_shares=None, governor=False):
         """
         The class constructor. The arguments are as follows.
           * rsts - list of 'RORawResult' objects representing the raw test results to generate the
@@ -731,6 +827,18 @@ class ReportBase:
                          summary functions to be calculated for metrics represented by the regular
                          expression 'regex'. Default value of 'None' will not generate any summary
                          tables.
+          * rolling - list of regular expressions matching metrics to create a rolling percentiles
+                      diagram for (percentiles over a sliding window of datapoints). The diagrams
+                      are added only to the tabs of these metrics. Default is no such diagrams.
+          * binned - list of regular expressions matching metrics to bin the datapoints by. Tabs of
+                     Y-axis metrics get a diagram of the tab metric percentiles versus the bins of
+                     every matching metric. Unlike scatter plots, these diagrams include only the
+                     per-bin statistics. Default is no such diagrams.
+          * binned_shares - list of regular expressions matching non-numeric metrics (e.g.,
+                            "ReqCState") to add a diagram of per-bin shares of every value for,
+                            next to every diagram added because of 'binned'.
+          * governor - if 'True', add the idle governor analysis tab, which evaluates the requested
+                       C-states against the time actually spent idle (see '_GovernorTabBuilder').
         """
 
         self.rsts = rsts
@@ -742,10 +850,19 @@ class ReportBase:
         self.exclude_yaxes = exclude_yaxes
         self.hist = hist
         self.chist = chist
+        self.rolling = rolling
+        self.binned = binned
+        self.binned_shares = binned_shares
+        self.governor = governor
 
         # Users can change this to 'True' to make the reports relocatable. In which case the raw
         # results files will be copied from the test result directories to the output directory.
         self.relocatable = False
+        # Users can change this to limit the count of datapoints in time-series diagrams of the
+        # statistics tabs. 'None' means the default limit, '0' means no limit.
+        self.ts_points = None
+        # Users can change this to 'True' to include turbostat heatmaps of all CPUs to the report.
+        self.turbostat_heatmaps = False
 
         # The first result is the 'reference' result.
         self._refres = rsts[0]
@@ -766,6 +883,11 @@ class ReportBase:
         self._hov_metrics = {}
         # Additional metrics to load, if the results contain data for them.
         self._more_metrics = []
+        # Names of metrics to create rolling percentiles diagrams for.
+        self._rolling_metrics = []
+        # Names of metrics to bin the datapoints by, and of metrics to show per-bin shares for.
+        self._binned_xaxes = []
+        self._binned_shares = []
 
         self._validate_init_args()
         self._init_metrics()
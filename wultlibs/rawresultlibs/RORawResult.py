@@ -10,9 +10,11 @@
 This module provides API for reading raw test results.
 """
 
+import os
 import builtins
 import re
 import logging
+import concurrent.futures
 from pathlib import Path
 import pandas
 from pepclibs.helperlibs import YAML
@@ -23,6 +25,71 @@ from wultlibs.rawresultlibs import _RawResultBase
 
 _LOG = logging.getLogger()
 
+# The functions which can be used in derived metric expressions (the 'expr' key of a metric
+# definition). These are supported by both 'numexpr' and 'python' engines of 'pandas.eval()'. Note,
+# 'pandas.eval()' supports only a fixed set of math functions, so 'numexpr' functions like 'where()'
+# are not usable.
+_EXPR_FUNCS = {"abs", "sqrt", "log", "log10", "exp"}
+
+def _read_csv(path, dtype, kwargs):
+    """
+    Read datapoints CSV file at 'path' into a 'pandas.DataFrame' and return it. The 'dtype' and
+    'kwargs' arguments are passed to 'pandas.read_csv()'.
+    """
+
+    try:
+        return pandas.read_csv(path, dtype=dtype, **kwargs)
+    except Exception as err:
+        raise Error(f"failed to load CSV file {path}:\n{err}") from None
+
+def _read_csv_columns(path, dtype, kwargs):
+    """
+    Same as '_read_csv()', but returns the '{colname: numpy.ndarray}' dictionary. This function is
+    executed in a worker process, and passing plain column arrays back to the parent process is
+    cheaper than pickling a 'pandas.DataFrame'.
+    """
+
+    df = _read_csv(path, dtype, kwargs)
+    return {colname: df[colname].to_numpy() for colname in df.columns}
+
+def load_dfs(rsts, jobs=None):
+    """
+    Load datapoints of multiple test results. This is the same as calling 'load_df()' for every
+    test result, but the datapoints CSV files are read in parallel. The arguments are as follows.
+      * rsts - an iterable collection of 'RORawResult' objects.
+      * jobs - maximum count of worker processes to use. Default is the count of CPUs available to
+               this process.
+    """
+
+    # pylint: disable=protected-access
+    rsts = list(rsts)
+    todo = [res for res in rsts if res.df is None]
+
+    if jobs is None:
+        jobs = len(os.sched_getaffinity(0))
+    jobs = min(jobs, len(todo))
+
+    if jobs > 1:
+        _LOG.debug("loading %d test results using %d worker processes", len(todo), jobs)
+        try:
+            with concurrent.futures.ProcessPoolExecutor(max_workers=jobs) as pool:
+                futures = []
+                for res in todo:
+                    _LOG.info("Loading test result '%s'.", res.dp_path)
+                    kwargs = {"usecols": res._get_csv_usecols()}
+                    futures.append(pool.submit(_read_csv_columns, res.dp_path,
+                                               res._get_csv_dtype(), kwargs))
+
+                for res, future in zip(todo, futures):
+                    res._load_df(columns=future.result())
+        except concurrent.futures.process.BrokenProcessPool as err:
+            raise Error(f"failed to load test results in worker processes:\n{err}") from err
+
+    # Load the rest of the results and apply the filters to the results which were already loaded.
+    for res in rsts:
+        if jobs <= 1 or res not in todo:
+            res.load_df()
+
 class RORawResult(_RawResultBase.RawResultBase):
     """This class represents a read-only raw test result."""
 
@@ -60,6 +127,18 @@ class RORawResult(_RawResultBase.RawResultBase):
         """Returns 'True' if metric 'metric' has numeric values, otherwise returns 'False'."""
         return metric in self.get_numeric_metrics(metrics=[metric])
 
+    def _get_metrics_regex(self):
+        """
+        Returns a compiled regular expression which matches metric names in 'pandas' python
+        expressions.
+        """
+
+        # Match longer names first, so that, for example, 'WakeLatencyRaw' is not matched as
+        # 'WakeLatency'. Names in quotes are not metrics, but string values.
+        names = sorted(self.metrics, key=len, reverse=True)
+        return re.compile(r"(?<![\w'])(" + "|".join(re.escape(name) for name in names) +
+                          r")(?![\w'])")
+
     def _mangle_eval_expr(self, expr):
         """
         Mangle a 'pandas' python expression that we use for row filters and selectors. Some of the
@@ -70,13 +149,101 @@ class RORawResult(_RawResultBase.RawResultBase):
         if expr is None:
             return None
 
-        expr = str(expr)
-        for colname in self.metrics:
-            expr = expr.replace(colname, f"self.df['{colname}']")
+        expr = self._get_metrics_regex().sub(lambda mo: f"self.df['{mo.group(1)}']", str(expr))
         # The special 'index' name represents the row number (first data row has index '0').
         expr = re.sub("(?!')index(?!')", "self.df.index", expr)
         return expr
 
+    def _eval_expr(self, expr):
+        """
+        Evaluate mangled 'pandas' python expression 'expr' (see '_mangle_eval_expr()') and return
+        the result.
+        """
+
+        try:
+            try:
+                return pandas.eval(expr)
+            except ValueError as err:
+                # For some reasons on some distros the default "numexpr" engine fails with
+                # various errors, such as:
+                #   * ValueError: data type must provide an itemsize
+                #   * ValueError: unknown type str128
+                #
+                # We are not sure how to properly fix these, but we noticed that often the
+                # "python" engine works fine. Therefore, re-trying with the "python" engine.
+                _LOG.debug("pandas.eval(engine='numexpr') failed: %s\nTrying "
+                           "pandas.eval(engine='python')", str(err))
+                return pandas.eval(expr, engine="python")
+        except Exception as err:
+            raise Error(f"failed to evaluate expression '{expr}': {err}\nMake sure you use "
+                        f"correct metric names, which are also case-sensitive.") from err
+
+    def _init_derived_metrics(self):
+        """
+        Find the derived metrics which can be calculated for this test result and add them to
+        'self.metrics'. Derived metrics are not stored in the datapoints CSV file. Instead, their
+        definitions include the 'expr' key with an expression over other metrics, and they are
+        calculated when the CSV file is loaded.
+        """
+
+        for metric, mdef in self.defs.info.items():
+            if "expr" not in mdef or metric in self.metrics_set:
+                continue
+
+            deps = set(self._get_metrics_regex().findall(mdef["expr"]))
+            if not deps:
+                _LOG.debug("derived metric '%s' does not refer to any available metric, skip it",
+                           metric)
+                continue
+
+            # A derived metric may refer to other derived metrics defined before it.
+            csv_deps = set()
+            for dep in deps:
+                csv_deps.update(self._derived[dep][1] if dep in self._derived else (dep,))
+
+            # Make sure all the other names in the expression are supported functions. Otherwise
+            # the expression refers to a metric this test result does not have.
+            rest = self._get_metrics_regex().sub(" ", mdef["expr"])
+            unknown = set(re.findall(r"(?<![\w.])[A-Za-z_][\w%]*", rest)) - _EXPR_FUNCS
+            if unknown:
+                _LOG.debug("derived metric '%s' depends on unavailable metric(s) '%s', skip it",
+                           metric, "', '".join(unknown))
+                continue
+
+            self._derived[metric] = (mdef["expr"], csv_deps)
+            self.metrics.append(metric)
+            self.metrics_set.add(metric)
+
+    def _calc_derived_metrics(self):
+        """Calculate the derived metrics which depend only on metrics present in 'self.df'."""
+
+        for metric, (expr, csv_deps) in self._derived.items():
+            if metric in self.df or not csv_deps.issubset(self.df.columns):
+                continue
+
+            _LOG.debug("calculating derived metric '%s': %s", metric, expr)
+            vals = self._eval_expr(self._mangle_eval_expr(expr))
+            try:
+                self.df[metric] = vals.astype(self.defs.info[metric]["type"])
+            except (TypeError, ValueError) as err:
+                raise Error(f"bad result type of derived metric '{metric}' expression '{expr}':\n"
+                            f"{err}") from err
+
+    def _get_csv_metrics(self, metrics):
+        """
+        Returns the list of datapoints CSV file metrics which are required for calculating metrics
+        in the 'metrics' list.
+        """
+
+        csv_metrics = []
+        for metric in metrics:
+            if metric in self._derived:
+                csv_metrics += self._derived[metric][1]
+            else:
+                csv_metrics.append(metric)
+
+        return list(dict.fromkeys(csv_metrics))
+
     def set_exclude(self, exclude):
         """
         Set the datapoints to exclude: the datapoints matching the 'exclude' expression will be
@@ -179,18 +346,41 @@ class RORawResult(_RawResultBase.RawResultBase):
         for metric in metrics:
             self.smrys[metric] = self._calc_smry(metric, funcnames)
 
-    def _load_csv(self, **kwargs):
-        """Read the datapoints CSV file into a 'pandas.DataFrame' and validate it."""
-
-        _LOG.info("Loading test result '%s'.", self.dp_path)
+    def _get_csv_dtype(self):
+        """Returns the datapoints CSV file columns types dictionary for 'pandas.read_csv()'."""
 
         # Enforce the types we expect.
-        dtype = {colname : colinfo["type"] for colname, colinfo in self.defs.info.items()}
+        return {colname : colinfo["type"] for colname, colinfo in self.defs.info.items()
+                if colname not in self._derived}
 
-        try:
-            self.df = pandas.read_csv(self.dp_path, dtype=dtype, **kwargs)
-        except Exception as err:
-            raise Error(f"failed to load CSV file {self.dp_path}:\n{err}") from None
+    def _get_csv_usecols(self):
+        """
+        Returns the list of datapoints CSV file columns which have to be loaded in order to apply
+        the filters and selectors, or 'None' if all columns have to be loaded.
+        """
+
+        # Datapoint filter may refer to any column.
+        if self._get_dp_filter():
+            return None
+
+        metrics = self._get_filtered_metrics(self.metrics)
+        if not metrics:
+            return None
+
+        return self._get_csv_metrics(metrics)
+
+    def _load_csv(self, columns=None, **kwargs):
+        """
+        Read the datapoints CSV file into a 'pandas.DataFrame' and validate it. If 'columns' is
+        provided, it is a '{colname: numpy.ndarray}' dictionary with the already read CSV file
+        columns (see 'load_dfs()').
+        """
+
+        if columns is None:
+            _LOG.info("Loading test result '%s'.", self.dp_path)
+            self.df = _read_csv(self.dp_path, self._get_csv_dtype(), kwargs)
+        else:
+            self.df = pandas.DataFrame(columns, copy=False)
 
         # Check datapoints for too few values.
         if self.df.isnull().values.any():
@@ -200,46 +390,33 @@ class RORawResult(_RawResultBase.RawResultBase):
         if self.df.empty:
             raise Error(f"no data in CSV file '{self.dp_path}'")
 
-    def _load_df(self, force_reload=False, **kwargs):
+        self._calc_derived_metrics()
+
+    def _load_df(self, force_reload=False, columns=None, **kwargs):
         """
         Apply all the filters and selectors to 'self.df'. Load it from the datapoints CSV file if it
         has not been loaded yet. If 'force_reload' is 'True', always load 'self.df' from the CSV
-        file.
+        file. If 'columns' is provided, use it instead of reading the CSV file (see '_load_csv()').
         """
 
         dpfilter = self._get_dp_filter()
         metrics = self._get_filtered_metrics(self.metrics)
 
-        load_csv = force_reload or self.df is None
+        load_csv = force_reload or self.df is None or columns is not None
+
+        if load_csv:
+            # Note, if there is a datapoint filter, columns cannot be dropped yet, because the
+            # filter may refer to them.
+            self._load_csv(columns=columns, usecols=self._get_csv_usecols(), **kwargs)
 
         if not dpfilter:
-            if load_csv:
-                self._load_csv(usecols=metrics, **kwargs)
-            metrics = None
-        else:
-            # We cannot drop columns yet, because datapoint filter may refer to the columns.
-            if load_csv:
-                self._load_csv(**kwargs)
+            # Drop the columns which were loaded only for calculating derived metrics.
+            if not load_csv or not metrics or set(self.df.columns) == set(metrics):
+                metrics = None
 
         if dpfilter:
             _LOG.debug("applying datapoint filter: %s", dpfilter)
-            try:
-                try:
-                    expr = pandas.eval(dpfilter)
-                except ValueError as err:
-                    # For some reasons on some distros the default "numexpr" engine fails with
-                    # various errors, such as:
-                    #   * ValueError: data type must provide an itemsize
-                    #   * ValueError: unknown type str128
-                    #
-                    # We are not sure how to properly fix these, but we noticed that often the
-                    # "python" engine works fine. Therefore, re-trying with the "python" engine.
-                    _LOG.debug("pandas.eval(engine='numexpr') failed: %s\nTrying "
-                               "pandas.eval(engine='python')", str(err))
-                    expr = pandas.eval(dpfilter, engine="python")
-            except Exception as err:
-                raise Error(f"failed to evaluate expression '{dpfilter}': {err}\nMake sure you use "
-                            f"correct metric names, which are also case-sensitive.") from err
+            expr = self._eval_expr(dpfilter)
 
             self.df = self.df[expr].reset_index(drop=True)
             if self.df.empty:
@@ -332,8 +509,10 @@ class RORawResult(_RawResultBase.RawResultBase):
         path = dirpath.joinpath(self.info_path.name)
         YAML.dump(info, path)
 
+        # Derived metrics are calculated when the CSV file is loaded, do not store them.
         path = dirpath.joinpath(self.dp_path.name)
-        self.df.to_csv(path, index=False, header=True)
+        derived = [metric for metric in self._derived if metric in self.df]
+        self.df.drop(columns=derived).to_csv(path, index=False, header=True)
 
     @staticmethod
     def _convert_col_to_base_unit(df, mdef, base_col_suffix):
@@ -427,6 +606,10 @@ class RORawResult(_RawResultBase.RawResultBase):
         self.smrys = None
         self.metrics = []
         self.metrics_set = set()
+        # The derived metrics dictionary: '{metric: (expr, csv_deps)}', where 'expr' is the
+        # expression to calculate the metric, and 'csv_deps' is the set of datapoints CSV file
+        # metrics it depends on.
+        self._derived = {}
 
         self.info = YAML.load(self.info_path)
         if reportid:
@@ -462,3 +645,4 @@ class RORawResult(_RawResultBase.RawResultBase):
                 self.metrics.append(metric)
 
         self.metrics_set = set(self.metrics)
+        self._init_derived_metrics()
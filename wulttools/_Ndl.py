@@ -155,6 +155,9 @@ def _build_arguments_parser():
     subpars.add_argument("--reportids", help=ToolsCommon.REPORTIDS_DESCR)
     subpars.add_argument("--title-descr", help=ToolsCommon.TITLE_DESCR)
     subpars.add_argument("--relocatable", action="store_true", help=ToolsCommon.RELOCATABLE_DESCR)
+    subpars.add_argument("--ts-points", type=int, help=ToolsCommon.TS_POINTS_DESCR)
+    subpars.add_argument("--turbostat-heatmaps", action="store_true",
+                         help=ToolsCommon.TURBOSTAT_HEATMAPS_DESCR)
     subpars.add_argument("--list-metrics", action="store_true", help=ToolsCommon.LIST_METRICS_DESCR)
 
     text = f"""One or multiple {_OWN_NAME} test result paths."""
@@ -11,6 +11,7 @@ This module includes the "report" 'ndl' command implementation.
 """
 
 from pepclibs.helperlibs import Trivial
+from pepclibs.helperlibs.Exceptions import Error
 from wultlibs import ToolsCommon
 from wultlibs.htmlreport import NdlReport
 
@@ -26,6 +27,9 @@ def report_command(args):
             else:
                 setattr(args, name, Trivial.split_csv_line(val))
 
+    if args.ts_points is not None and args.ts_points < 0:
+        raise Error(f"bad '--ts-points' value '{args.ts_points}', should be a non-negative integer")
+
     rsts = ToolsCommon.open_raw_results(args.respaths, args.toolname, reportids=args.reportids)
 
     if args.list_metrics:
@@ -44,4 +48,6 @@ def report_command(args):
                               xaxes=args.xaxes, yaxes=args.yaxes, hist=args.hist,
                               chist=args.chist)
     rep.relocatable = args.relocatable
+    rep.ts_points = args.ts_points
+    rep.turbostat_heatmaps = args.turbostat_heatmaps
     rep.generate()
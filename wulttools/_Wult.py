@@ -22,7 +22,7 @@ except ImportError:
 
 from pepclibs.helperlibs import Logging, Human, ArgParse
 from pepclibs.helperlibs.Exceptions import Error
-from wultlibs import Deploy, ToolsCommon
+from wultlibs import Deploy, ToolsCommon, _FTrace, _PkgQuiesce, _Calibration, _FreqSweep
 from wulttools import _WultCommon
 
 _VERSION = "1.10.25"
@@ -34,11 +34,12 @@ _WULT_DEPLOY_INFO = {
         "wult" : {
             "category" : "drivers",
             "minkver"  : "5.6",
-            "deployables" : ("wult", "wult_igb", "wult_tdt", "wult_hrt", ),
+            "deployables" : ("wult", "wult_igb", "wult_tdt", "wult_hrt", "wult_hrt_soft", ),
         },
         "stc-agent" : {
             "category" : "pyhelpers",
-            "deployables" : ("stc-agent", "ipmi-helper", ),
+            "deployables" : ("stc-agent", "ipmi-helper", "stream-shim", "interrupts-helper",
+                             "ipmi-inband-helper", ),
         },
         "wultrunner" : {
             "category" : "bpfhelpers",
@@ -193,6 +194,66 @@ def _build_arguments_parser():
               enable interrupts before linux enters the C-state."""
     subpars.add_argument("--early-intr", action="store_true", help=text)
 
+    text = f"""{_OWN_NAME.title()} drivers send raw datapoints to user-space via a dedicated Linux
+               function trace buffer instance ('tracing/instances/wult'). This option defines the
+               measured CPU trace buffer size in KiB, default is {_FTrace.DEFAULT_BUFSIZE} KiB.
+               Raw datapoints are lost if the trace buffer overflows, in which case {_OWN_NAME}
+               prints a warning and you may want to increase the trace buffer size."""
+    subpars.add_argument("--trace-buf-size", dest="trbufsize", type=int, help=text)
+
+    text = f"""Package C-states are reached only when all CPUs of the package are idle, so they are
+               rarely measured. This option makes {_OWN_NAME} quiesce the other CPUs of the measured
+               CPU package for the duration of the measurements. The "migrate" method moves IRQs,
+               user-space tasks, and unbound workqueues off these CPUs to the CPUs of the other
+               packages (never to the measured CPU), and enables all C-states on them. The
+               "offline" method does the same and then offlines these CPUs. The original settings
+               are restored when the measurements are done."""
+    subpars.add_argument("--quiesce-pkg", dest="pkg_quiesce", metavar="METHOD",
+                         choices=_PkgQuiesce.METHODS, help=text)
+
+    text = f"""Calibrate the measurement floor before the measurements: collect
+               {_Calibration.DEFAULT_DPCNT} datapoints with all C-states but POLL disabled on the
+               measured CPU. There is no C-state exit cost in this case, so the measured latency is
+               the overhead of the delayed event device and {_OWN_NAME} itself. The results are
+               saved in the 'info.yml' file and shown in the report, and cached per SUT, driver,
+               measured CPU, and kernel version. With the "run" mode, the calibration always runs
+               and updates the cache. With the "cached" mode, the cached results are used, and the
+               calibration runs only if there are no cached results."""
+    subpars.add_argument("--calibrate", metavar="MODE", choices=_Calibration.MODES, help=text)
+
+    text = f"""Every datapoint includes a summary of the last 8 idle periods of the measured CPU
+               preceding the measured one ('IdleHistLast', 'IdleHistAvg', etc). The idle governor
+               picks C-states basing on recent idle durations, so this helps explaining its
+               decisions. With this option, {_OWN_NAME} also saves the raw idle history: the idle
+               durations in nanoseconds in the 'IdleHist1' (most recent) to 'IdleHist8' CSV
+               columns, and the 'IdleHistWultMask' column with bit 'N-1' set if 'IdleHistN' idle
+               period was ended by the {_OWN_NAME} delayed event."""
+    subpars.add_argument("--idle-hist-raw", action="store_true", help=text)
+
+    text = """Read a perf event on the measured CPU on idle entry and exit, and save the delta in
+              the 'NAME' CSV column. 'SPEC' is either 'PMU/TERMS' (e.g., 'cpu/event=0x3c,umask=0'),
+              'PMU/ALIAS' (an event name from the PMU 'events' sysfs directory), or 'TYPE:CONFIG'
+              (raw numeric perf event type and config). 'NAME' must differ from the names of the
+              other datapoint fields and metrics (e.g., 'LTime' or 'CC1Cyc'). Can be specified
+              multiple times. Supported only by eBPF-based delayed event devices, like
+              'hrtimer'."""
+    subpars.add_argument("--perf-event", metavar="NAME=SPEC", action="append", dest="perf_events",
+                         help=text)
+
+    text = f"""Wake latency depends on the P-state the CPU resumes at. This option makes {_OWN_NAME}
+               step the measured CPU frequency through a list of frequencies during the
+               measurements, by setting both the minimum and the maximum cpufreq frequency limits to
+               the same value. The list is comma-separated, frequencies may include the 'GHz',
+               'MHz', or 'kHz' specifiers, the default is 'MHz'. Every datapoint is tagged with the
+               frequency in the 'FreqSet' CSV column. The original frequency limits are restored
+               when the measurements are done."""
+    subpars.add_argument("--freq-sweep", metavar="FREQS", help=text)
+
+    text = f"""The frequency sweep step period, default is {_FreqSweep.DEFAULT_PERIOD} seconds. The
+               frequencies are stepped through cyclically. Specifiers like 's' or 'm' are
+               allowed."""
+    subpars.add_argument("--freq-sweep-period", metavar="PERIOD", help=text)
+
     subpars.add_argument("--report", action="store_true", help=ToolsCommon.START_REPORT_DESCR)
     subpars.add_argument("--force", action="store_true", help=ToolsCommon.START_FORCE_DESCR)
 
@@ -229,6 +290,9 @@ def _build_arguments_parser():
     subpars.add_argument("--reportids", help=ToolsCommon.REPORTIDS_DESCR)
     subpars.add_argument("--title-descr", help=ToolsCommon.TITLE_DESCR)
     subpars.add_argument("--relocatable", action="store_true", help=ToolsCommon.RELOCATABLE_DESCR)
+    subpars.add_argument("--ts-points", type=int, help=ToolsCommon.TS_POINTS_DESCR)
+    subpars.add_argument("--turbostat-heatmaps", action="store_true",
+                         help=ToolsCommon.TURBOSTAT_HEATMAPS_DESCR)
     subpars.add_argument("--list-metrics", action="store_true", help=ToolsCommon.LIST_METRICS_DESCR)
 
     text = """Generate HTML report with a pre-defined set of diagrams and histograms. Possible
@@ -42,6 +42,9 @@ def report_command(args):
             else:
                 setattr(args, name, None)
 
+    if args.ts_points is not None and args.ts_points < 0:
+        raise Error(f"bad '--ts-points' value '{args.ts_points}', should be a non-negative integer")
+
     rsts = ToolsCommon.open_raw_results(args.respaths, args.toolname, reportids=args.reportids)
 
     if args.list_metrics:
@@ -60,5 +63,7 @@ def report_command(args):
                                 xaxes=args.xaxes, yaxes=args.yaxes, hist=args.hist,
                                 chist=args.chist)
     rep.relocatable = args.relocatable
+    rep.ts_points = args.ts_points
+    rep.turbostat_heatmaps = args.turbostat_heatmaps
     rep.set_hover_metrics(_WultCommon.HOVER_METRIC_REGEXS)
     rep.generate()
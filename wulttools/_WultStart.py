@@ -19,7 +19,8 @@ from pepclibs.msr import PowerCtl
 from pepclibs import CStates, CPUInfo
 from wultlibs.helperlibs import Human
 from wultlibs.rawresultlibs import WORawResult
-from wultlibs import Deploy, StatsCollect, ToolsCommon, Devices, WultRunner
+from wultlibs import Deploy, StatsCollect, ToolsCommon, Devices, WultRunner, _FreqSweep
+from wultlibs import _WultRawDataProvider
 from wulttools import _WultCommon
 
 _LOG = logging.getLogger()
@@ -116,9 +117,24 @@ def start_command(args):
             raise Error(f"bad datapoints count '{args.dpcnt}', should be a positive integer")
         args.dpcnt = int(args.dpcnt)
 
+        if args.trbufsize is not None and args.trbufsize <= 0:
+            raise Error(f"bad trace buffer size '{args.trbufsize}', should be a positive integer")
+
         args.tsc_cal_time = Human.parse_duration(args.tsc_cal_time, default_unit="s",
                                                  name="TSC calculation time")
 
+        if args.perf_events:
+            args.perf_events = _WultRawDataProvider.parse_perf_events(args.perf_events)
+
+        if args.freq_sweep:
+            args.freq_sweep = _FreqSweep.parse_freqs(args.freq_sweep)
+        if args.freq_sweep_period:
+            if not args.freq_sweep:
+                raise Error("the '--freq-sweep-period' option requires '--freq-sweep'")
+            args.freq_sweep_period = Human.parse_duration(args.freq_sweep_period,
+                                                          default_unit="s",
+                                                          name="frequency sweep period")
+
         cpuinfo = CPUInfo.CPUInfo(pman=pman)
         stack.enter_context(cpuinfo)
 
@@ -146,7 +162,12 @@ def start_command(args):
         _check_settings(pman, dev, csinfo, args.cpunum, args.devid)
 
         runner = WultRunner.WultRunner(pman, dev, res, ldist=args.ldist, early_intr=args.early_intr,
-                                       tsc_cal_time=args.tsc_cal_time, rcsobj=rcsobj, stconf=stconf)
+                                       tsc_cal_time=args.tsc_cal_time, rcsobj=rcsobj, stconf=stconf,
+                                       trbufsize=args.trbufsize, pkg_quiesce=args.pkg_quiesce,
+                                       calibrate=args.calibrate, idle_hist_raw=args.idle_hist_raw,
+                                       perf_events=args.perf_events,
+                                       freq_sweep=args.freq_sweep,
+                                       freq_sweep_period=args.freq_sweep_period)
         stack.enter_context(runner)
 
         runner.unload = not args.no_unload